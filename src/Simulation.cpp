@@ -9,21 +9,26 @@
 
 #include "Simulation.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <iterator>
 #include <random>
+#include <tuple>
 #include "lib/utils/Utils.h"
 
 // ╔════════════════════════════════════════╗
 // ║             Constructors               ║
 // ╚════════════════════════════════════════╝
 
-Simulation::Simulation(double stepSize, std::ostream &errStream) : stepSize(stepSize), _initCheck(this) {
+Simulation::Simulation(double stepSize, std::ostream &errStream) :
+    rng(std::random_device()()), stepSize(stepSize), _initCheck(this) {
     REQUIRE(stepSize > 0, "Stepsize cannot be negative or zero");
     ENSURE(properlyInitialized(), "Simulation is properly initialized");
 }
 
 Simulation::Simulation(std::istream &xmlStream, double stepSize, std::ostream &errStream) :
-    stepSize(stepSize), _initCheck(this) {
+    rng(std::random_device()()), stepSize(stepSize), _initCheck(this) {
     REQUIRE(stepSize > 0, "Stepsize cannot be negative or zero");
 
     // validate the xml and parse the returned valmap
@@ -48,16 +53,22 @@ void Simulation::parse(const Validator::ValMap &valMap) {
             "Simulation is empty");
     REQUIRE(properlyInitialized(), "Simulation is properly initialized");
     REQUIRE(!valMap.empty(), "Valmap contains validated input");
+    SIM_TRACE_SCOPE("Simulation::parse");
 
     // Initialize roads first since other objects reference roads
     for (const Validator::Object &road : valMap.at(Validator::EObjectTypes::kRoad)) {
         const id currentId = idGen.next();
         // extract attributes
-        const std::string name = road.at(Validator::EAttributes(Validator::ERoadAttributes::kName));
-        const unsigned int length = std::stoi(road.at(Validator::EAttributes(Validator::ERoadAttributes::kLength)));
+        const std::string &name = road.at(Validator::EAttributes(Validator::ERoadAttributes::kName));
+        const unsigned int length = road.at(Validator::EAttributes(Validator::ERoadAttributes::kLength)).toInt();
+        const Validator::Object::const_iterator level =
+          road.find(Validator::EAttributes(Validator::ERoadAttributes::kLevel));
+        const bool mesoscopic = level != road.end() && level->second == "meso";
 
         // insert object into correct map
-        roads.insert({currentId, RoadObject(currentId, name, length)});
+        roads.insert(
+          {currentId, RoadObject(currentId, name, length, mesoscopic ? ERoadLevel::kMeso : ERoadLevel::kMicro)});
+        if (mesoscopic) mesoLinks.insert({currentId, MesoLinkEntity(currentId, stepSize, length, MesoLinkProfile::get())});
 
         // keep a map of roadName mapped to id
         roadMap.insert({name, currentId});
@@ -66,9 +77,22 @@ void Simulation::parse(const Validator::ValMap &valMap) {
         lightsOnRoads[currentId] = {};
         busStopsOnRoads[currentId] = {};
         crossRoadsOnRoads[currentId] = {};
+        generatorsOnRoads[currentId] = {};
+        activeRoadSlots[currentId] = -1;
+        roadEpochs[currentId] = 0;
+        roadRates[currentId] = {1, 0, 0, 0};
+        coasterSlots[currentId] = -1;
     }
 
-    for (const std::pair<Validator::EObjectTypes, std::vector<Validator::Object>> objects : valMap) {
+    // every road can become active and carry a coasting vehicle, reserve now so updating them never allocates
+    activeRoads.reserve(roads.size());
+    coasters.reserve(roads.size());
+    wokenSteps.reserve(roads.size());
+
+    // vehicles on mesoscopic roads are placed once the crossroads on those roads are known
+    std::vector<std::tuple<id, double, EVehicleEntityTypes>> mesoVehicles;
+
+    for (const std::pair<const Validator::EObjectTypes, std::vector<Validator::Object>> &objects : valMap) {
         // get type of current object class
         const Validator::EObjectTypes type = objects.first;
 
@@ -82,10 +106,10 @@ void Simulation::parse(const Validator::ValMap &valMap) {
 
             if (type == Validator::EObjectTypes::kLight) {
                 const unsigned int lightCycle =
-                  std::stoi(object.at(Validator::EAttributes(Validator::ELightAttributes::kCycleTime)));
+                  object.at(Validator::EAttributes(Validator::ELightAttributes::kCycleTime)).toInt();
 
                 const unsigned int position =
-                  std::stoi(object.at(Validator::EAttributes(Validator::ELightAttributes::kPosition)));
+                  object.at(Validator::EAttributes(Validator::ELightAttributes::kPosition)).toInt();
 
                 const id roadId = roadMap.at(object.at(Validator::EAttributes(Validator::ELightAttributes::kRoadName)));
 
@@ -93,7 +117,7 @@ void Simulation::parse(const Validator::ValMap &valMap) {
 
             } else if (type == Validator::EObjectTypes::kVehicle) {
                 const unsigned int position =
-                  std::stoi(object.at(Validator::EAttributes(Validator::EVehicleAttributes::kPosition)));
+                  object.at(Validator::EAttributes(Validator::EVehicleAttributes::kPosition)).toInt();
 
                 const id roadId =
                   roadMap.at(object.at(Validator::EAttributes(Validator::EVehicleAttributes::kRoadName)));
@@ -102,11 +126,14 @@ void Simulation::parse(const Validator::ValMap &valMap) {
                 const EVehicleEntityTypes vehicleType = vehicleTypeStringToEnumVariant(
                   object.at(Validator::EAttributes(Validator::EVehicleAttributes::kType)));
 
-                spawnVehicle(roadId, position, vehicleType);
+                if (mesoLinks.find(roadId) != mesoLinks.end())
+                    mesoVehicles.emplace_back(roadId, position, vehicleType);
+                else
+                    spawnVehicle(roadId, position, vehicleType);
 
             } else if (type == Validator::EObjectTypes::kVehicleGenerator) {
                 const unsigned int generatorFrequency =
-                  std::stoi(object.at(Validator::EAttributes(Validator::EVehicleGeneratorAttributes::kFrequency)));
+                  object.at(Validator::EAttributes(Validator::EVehicleGeneratorAttributes::kFrequency)).toInt();
 
                 const id roadId =
                   roadMap.at(object.at(Validator::EAttributes(Validator::EVehicleGeneratorAttributes::kRoadName)));
@@ -118,20 +145,22 @@ void Simulation::parse(const Validator::ValMap &valMap) {
                   {currentId, VehicleGeneratorEntity(currentId, stepSize, generatorFrequency, vehicleType)});
                 // FIXME 0 is a placeholder since at the moment vehicle generators can
                 // only spawn here.
-                world.insert({currentId, {roadId, 0}});
+                staticWorld.insert({currentId, {roadId, 0}});
+
+                generatorsOnRoads[roadId].push_back(currentId);
 
             } else if (type == Validator::EObjectTypes::kBusStop) {
                 const id roadId =
                   roadMap.at(object.at(Validator::EAttributes(Validator::EBusStopAttributes::kRoadName)));
 
                 const unsigned int position =
-                  std::stoi(object.at(Validator::EAttributes(Validator::EBusStopAttributes::kPosition)));
+                  object.at(Validator::EAttributes(Validator::EBusStopAttributes::kPosition)).toInt();
 
                 const unsigned int haltTime =
-                  std::stoi(object.at(Validator::EAttributes(Validator::EBusStopAttributes::kHaltTime)));
+                  object.at(Validator::EAttributes(Validator::EBusStopAttributes::kHaltTime)).toInt();
 
-                busstops.insert({currentId, BusStopEntity(currentId, haltTime, stepSize)});
-                world.insert({currentId, {roadId, position}});
+                busstops.insert({currentId, BusStopEntity(currentId, haltTime)});
+                staticWorld.insert({currentId, {roadId, position}});
 
                 busStopsOnRoads[roadId].push_back(currentId);
 
@@ -144,13 +173,13 @@ void Simulation::parse(const Validator::ValMap &valMap) {
 
                 // get positions on both roads
                 const unsigned int posFirstRoad =
-                  std::stoi(object.at(Validator::EAttributes(Validator::ECrossRoadAttributes::kFirstRoadPosition)));
+                  object.at(Validator::EAttributes(Validator::ECrossRoadAttributes::kFirstRoadPosition)).toInt();
                 const unsigned int posSecondRoad =
-                  std::stoi(object.at(Validator::EAttributes(Validator::ECrossRoadAttributes::kSecondRoadPosition)));
+                  object.at(Validator::EAttributes(Validator::ECrossRoadAttributes::kSecondRoadPosition)).toInt();
 
                 // get lightCycle time: -1 if no lights wanted
                 const int lightCycle =
-                  Utils::stoi(object.at(Validator::EAttributes(Validator::ECrossRoadAttributes::kLights)));
+                  object.at(Validator::EAttributes(Validator::ECrossRoadAttributes::kLights)).toInt();
 
                 if (lightCycle != -1) {
                     spawnLightCrossroad(roadIdOne, posFirstRoad, roadIdTwo, posSecondRoad, lightCycle);
@@ -161,8 +190,8 @@ void Simulation::parse(const Validator::ValMap &valMap) {
                     crossRoads.insert({currentId, CrossRoadObject(currentId, crossRoadTwoId)});
                     crossRoads.insert({crossRoadTwoId, CrossRoadObject(crossRoadTwoId, currentId)});
 
-                    world.insert({currentId, {roadIdOne, posFirstRoad}});
-                    world.insert({crossRoadTwoId, {roadIdTwo, posSecondRoad}});
+                    staticWorld.insert({currentId, {roadIdOne, posFirstRoad}});
+                    staticWorld.insert({crossRoadTwoId, {roadIdTwo, posSecondRoad}});
 
                     crossRoadsOnRoads[roadIdOne].push_back(currentId);
                     crossRoadsOnRoads[roadIdTwo].push_back(crossRoadTwoId);
@@ -174,6 +203,24 @@ void Simulation::parse(const Validator::ValMap &valMap) {
         }
     }
 
+    buildRoadFeatures();
+    buildSnapshotLayout();
+
+    for (std::pair<const id, MesoLinkEntity> &link : mesoLinks) {
+        for (const CrossRoadFeature &crossRoad : roadFeatures.at(link.first).crossRoads) {
+            link.second.addCrossRoad(crossRoad.position, crossRoad.crossRoadId);
+        }
+    }
+    for (const std::tuple<id, double, EVehicleEntityTypes> &vehicle : mesoVehicles) {
+        mesoLinks.at(std::get<0>(vehicle)).place(std::get<2>(vehicle), std::get<1>(vehicle), 0);
+    }
+
+    // a tick only refills the buckets (in place) when vehicles come or go
+    fillVehicleBuckets();
+
+    // the vehicles of the scenario are not counted as spawns
+    profiler.reset();
+
     ENSURE(!getRoads().empty(), "Roads database cannot be empty");
 }
 
@@ -182,124 +229,188 @@ void Simulation::godTick() {
     REQUIRE(properlyInitialized(), "Simulation is properly initialized");
 
     const unsigned int prevIteration = iteration;
+    SIM_TRACE_SCOPE("godTick");
+
+    // simulation time at the end of this tick
+    const double now = (iteration + 1) * stepSize;
+
+    // ╔════════════════════════════════════════╗
+    // ║             Vehicle phases             ║
+    // ╚════════════════════════════════════════╝
+    // Every vehicle sees the state of the previous tick: the inputs of all vehicles are gathered before any vehicle
+    // is updated and the new positions are only written back to the world after all vehicles are updated. The result
+    // does not depend on the order the vehicles are visited in, so the first two phases can run on several threads.
+
+    // vehicles removed between the ticks
+    if (removedSteps > 0) compactVehicleSteps();
+
+    // coasting vehicles about to reach freeUntil are stepped again, like the ones woken since the last tick
+    if (iteration >= nextHorizon) wakeCoasters(iteration);
+    if (!wokenSteps.empty()) mergeWokenSteps();
+    coastingVehicles = coasters.size();
+    if (!bucketsValid) fillVehicleBuckets();
+
+    // the commits below write into the snapshot of the views, at the slots of the current layout
+    if (snapshot.inSync) syncSnapshot();
+
+    SIM_PROFILE_CLOCK(clock, profiler);
+
+    // when stepping adaptively, busy roads are updated several times this tick, one substep per pass
+    const unsigned int passes = maxSubsteps > 1 ? planSubsteps() : 1;
+
+    for (unsigned int pass = 0; pass < passes; ++pass) {
+        // gather the inputs of every vehicle from the previous state (read only), sleeping vehicles only check if
+        // something they depend on changed
+        workers.parallelFor(vehicleSteps.size(), [this, pass, passes](std::size_t begin, std::size_t end) {
+            SIM_TRACE_SCOPE("gatherChunk");
+            for (std::size_t i = begin; i < end; ++i) {
+                VehicleStep &step = vehicleSteps[i];
+                if (pass == 0) step.updated = false;
+                if (passes > 1 && pass >= roadRates.at(step.roadId).substeps) continue;
+                if (step.asleep && sleeping && !shouldWake(step)) continue;
+                step.asleep = false;
+
+                // still on a free road, the inputs are the ones of an empty road
+                if (step.freeFlowing) {
+                    const std::pair<id, double> &location = world.at(step.vehicleId);
+                    if (roadEpochs.at(location.first) == step.roadEpoch && location.second < step.freeUntil) {
+                        step.oldPos = location.second;
+                        step.distToLight = std::numeric_limits<double>::infinity();
+                        continue;
+                    }
+                }
 
-    // go over all vehicles
-    for (std::unordered_map<id, VehicleEntity>::iterator vehicleEntry = vehicles.begin();
-         vehicleEntry != vehicles.end();) {
-        // get the entry with position from world
-        std::pair<id, double> &vehicleLocationEntry = world.at(vehicleEntry->first);
-
-        // get id of vehicle in front
-        const id vehicleInFront = getVehicleInFront(vehicleEntry->first);
-        const id lightInFront = getLightInFront(vehicleEntry->first);
-
-        // set default values for all parameters
-        double distToLight = std::numeric_limits<double>::infinity(),
-               distToVehicle = std::numeric_limits<double>::infinity(),
-               velVehicleInFront = std::numeric_limits<double>::infinity(),
-               distToBusStop = std::numeric_limits<double>::infinity();
-        int busHaltTime = std::numeric_limits<int>::infinity();
-        id busStopInFront = std::numeric_limits<id>::infinity();
-        bool priorityVehicleInFront = false;
-
-        if (lightInFront != vehicleEntry->first && !lights.at(lightInFront).isGreen()) {
-            distToLight = world.at(lightInFront).second - world.at(vehicleEntry->first).second;
-        }
-        if (vehicleInFront != vehicleEntry->first) {
-            distToVehicle = world.at(vehicleInFront).second - world.at(vehicleEntry->first).second -
-                            vehicles.at(vehicleInFront).getLength();
-            velVehicleInFront = vehicles.at(vehicleInFront).getVelocity();
-            const EVehicleEntityTypes vehicleType = vehicles.at(vehicleInFront).getType();
-            const VehicleEntity &vehicleInFrontObject = vehicles.at(vehicleInFront);
-
-            if ((vehicleType == EVehicleEntityTypes::kAmbulance || vehicleType == EVehicleEntityTypes::kFireTruck ||
-                vehicleType == EVehicleEntityTypes::kPoliceCruiser) &&
-                  vehicleInFrontObject.getAcceleration() == vehicleInFrontObject.getMaxAcceleration()) {
-                priorityVehicleInFront = true;
+                gatherVehicleStep(step);
             }
-        }
-        if (vehicleEntry->second.getType() == EVehicleEntityTypes::kBus) {
-            busStopInFront = getBusStopInFront(vehicleEntry->first);
-
-            if (busStopInFront != vehicleEntry->first) {
-                distToBusStop = world.at(busStopInFront).second - world.at(vehicleEntry->first).second;
-                busHaltTime = busstops.at(busStopInFront).getHaltTime();
+        });
+        SIM_PROFILE_LAP(clock, EPhase::kGather, vehicleSteps.size());
+
+        // update every vehicle, a vehicle only changes its own state. Every class has its own loop, so the rules of
+        // the other classes are not checked per vehicle.
+        updateVehicleBucket<RegularVehiclePolicy>(pass, passes);
+        updateVehicleBucket<BusPolicy>(pass, passes);
+        updateVehicleBucket<PriorityVehiclePolicy>(pass, passes);
+        SIM_PROFILE_LAP(clock, EPhase::kUpdate, vehicleSteps.size());
+
+        // commit the new positions, the next pass sees them
+        for (const VehicleStep &step : vehicleSteps) {
+            if (step.asleep) continue;
+            if (passes > 1) {
+                RoadRate &rate = roadRates.at(step.roadId);
+                if (pass >= rate.substeps) continue;
+                rate.acceleration = std::max(rate.acceleration, step.acceleration);
+                rate.jerk = std::max(rate.jerk, step.jerk);
+            }
+            world.at(step.vehicleId).second = step.newPos;
+            if (snapshot.inSync) {
+                snapshot.positions[step.viewSlot] = step.newPos;
+                snapshot.velocities[step.viewSlot] = step.velocity;
             }
         }
+        SIM_PROFILE_LAP(clock, EPhase::kCommit, vehicleSteps.size());
+    }
+    committedTicks = iteration + 1;
+
+    sleepingVehicles = 0;
+    freeFlowingVehicles = coastingVehicles;
+    SIM_PROFILE_COUNT(const std::size_t movedVehicles = vehicleSteps.size());
+
+    // crossroads and despawning change the databases, these are done serially in id order
+    for (std::size_t stepIndex = 0; stepIndex < vehicleSteps.size(); ++stepIndex) {
+        // sleeping vehicles did not move
+        if (!vehicleSteps[stepIndex].updated) {
+            ++sleepingVehicles;
+            continue;
+        }
+        if (vehicleSteps[stepIndex].freeFlowing) ++freeFlowingVehicles;
 
-        const double oldPos = vehicleLocationEntry.second;
-
-        // FIXME distances wrong when turned at crossroads.
-        vehicleLocationEntry.second +=
-          vehicleEntry->second.update(distToVehicle, velVehicleInFront, distToLight, distToBusStop, busHaltTime,
-                                      busStopInFront, priorityVehicleInFront);
-
-        const double newPos = vehicleLocationEntry.second;
+        const id vehicleId = vehicleSteps[stepIndex].vehicleId;
+        const double oldPos = vehicleSteps[stepIndex].startPos;
+        const double newPos = vehicleSteps[stepIndex].newPos;
+        std::pair<id, double> &vehicleLocationEntry = world.at(vehicleId);
 
         // crossroad logic
 
-        std::vector<id> validCrossRoadIds;
-        // make list of all crossroads in traversed range on road this tick
-        for (std::list<id>::const_iterator crossRoadsId = crossRoadsOnRoads.at(vehicleLocationEntry.first).begin();
-             crossRoadsId != crossRoadsOnRoads.at(vehicleLocationEntry.first).end(); ++crossRoadsId) {
-            const double currentCrossRoadPos = world.at(*crossRoadsId).second;
-
-            if (currentCrossRoadPos > oldPos && currentCrossRoadPos < newPos) {
-                // crossroad in range
-                validCrossRoadIds.push_back(*crossRoadsId);
-            }
-        }
-
-        // Find closest crossroad to car
-        if (!validCrossRoadIds.empty()) {
-            id currentLargest = validCrossRoadIds[0];
-            for (unsigned int i = 1; i < validCrossRoadIds.size(); ++i) {
-                // FIXME: skipped all previous crossroads
-
-                if (world.at(currentLargest).second < world.at(validCrossRoadIds[i]).second) {
-                    currentLargest = validCrossRoadIds[i];
-                }
+        // the furthest crossroad traversed this tick (the first one added when several share that position)
+        // FIXME: skipped all previous crossroads
+        const std::vector<CrossRoadFeature> &roadCrossRoads = roadFeatures.at(vehicleLocationEntry.first).crossRoads;
+        std::vector<CrossRoadFeature>::const_iterator crossRoad = std::lower_bound(
+          roadCrossRoads.begin(), roadCrossRoads.end(), newPos,
+          [](const CrossRoadFeature &feature, const double position) { return feature.position < position; });
+        const bool crossed = crossRoad != roadCrossRoads.begin() && std::prev(crossRoad)->position > oldPos;
+        if (crossed) {
+            --crossRoad;
+            while (crossRoad != roadCrossRoads.begin() && std::prev(crossRoad)->position == crossRoad->position) {
+                --crossRoad;
             }
 
             // choose direction to proceed in
-            // god damn std::rand() not providing enough entropy...
-            // rand gen source: grepper
-            std::random_device rd;   // obtain a random number from hardware
-            std::mt19937 gen(rd());  // seed the generator
             std::uniform_int_distribution distr(0, 1);
 
-            const int n = distr(gen);
+            const int n = distr(rng);
             // 0 = turn, 1 = straight ahead
             if (n == 0) {
-                const id otherCrossRoadId = crossRoads.at(currentLargest).getCounterPart();
-                const id newRoadId = world.at(otherCrossRoadId).first;
-                const double newVehiclePos = world.at(otherCrossRoadId).second;
-
-                moveVehicle(newRoadId, newVehiclePos, vehicleEntry->first);
+                const id newRoadId = crossRoad->otherRoadId;
+                const double newVehiclePos = crossRoad->otherPosition;
+                const std::map<id, MesoLinkEntity>::iterator link = mesoLinks.find(newRoadId);
+
+                if (link != mesoLinks.end()) {
+                    // the vehicle leaves the microscopic part of the network, only the queue of the link keeps it
+                    if (link->second.canEnter()) {
+                        link->second.enter(vehicles.at(vehicleId).getType(), newVehiclePos, now);
+                        deleteVehicle(vehicleId);
+                        continue;
+                    }
+                } else if (moveVehicle(newRoadId, newVehiclePos, vehicleId)) {
+                    // the surroundings on the new road are unknown
+                    vehicleSteps[stepIndex].roadId = newRoadId;
+                    vehicleSteps[stepIndex].freeFlowing = false;
+                }
             }
         }
 
         // get the length of the road the vehicle is on
         const double roadLength = roads.at(vehicleLocationEntry.first).getLength();
 
-        // delete vehicle if it is out of bound
+        // delete vehicle if it is out of bound, from object storage and from world entry (this marks its step removed)
         if (vehicleLocationEntry.second > roadLength) {
-            const id vehicleId = vehicleEntry->first;
-
-            // delete vehicle from object storage and from world entry
-            vehicleEntry = vehicles.erase(vehicleEntry);
             deleteVehicle(vehicleId);
+            continue;
+        }
+
+        // alone on a free road, the vehicle may skip the next ticks (this marks its step removed as well)
+        if (vehicleSteps[stepIndex].freeFlowing) startCoasting(vehicleSteps[stepIndex]);
+    }
 
-        } else {
-            ++vehicleEntry;
+    // the steps of the vehicles that left are dropped at once, instead of shifting the steps for every one of them
+    if (removedSteps > 0) compactVehicleSteps();
+    SIM_PROFILE_LAP(clock, EPhase::kCrossRoads, movedVehicles);
+
+    // mesoscopic roads: vehicles that reached their crossroad or the end of their road leave the queue
+    for (std::pair<const id, MesoLinkEntity> &link : mesoLinks) {
+        link.second.update();
+        while (link.second.hasDeparture(now)) {
+            const MesoLinkEntity::Vehicle vehicle = link.second.depart(now);
+
+            // at the end of the road the vehicle leaves the simulation
+            if (vehicle.crossRoad == link.first) continue;
+
+            if (!turnMesoVehicle(vehicle, now)) link.second.pass(vehicle, now);
         }
     }
+    SIM_PROFILE_LAP(clock, EPhase::kMesoLinks, mesoLinks.size());
 
     // got over all lights
     for (std::unordered_map<id, LightEntity>::iterator lightEntry = lights.begin(); lightEntry != lights.end();
          ++lightEntry) {
         lightEntry->second.update();
     }
+    if (snapshot.inSync) {
+        for (std::size_t light = 0; light < snapshot.lightEntities.size(); ++light) {
+            snapshot.lightsGreen[light] = snapshot.lightEntities[light]->isGreen() ? 1 : 0;
+        }
+    }
+    SIM_PROFILE_LAP(clock, EPhase::kLights, lights.size());
 
     // for all vehicle generators
     for (std::unordered_map<id, VehicleGeneratorEntity>::iterator vehicleGeneratorEntity = vehicleGenerators.begin();
@@ -312,9 +423,11 @@ void Simulation::godTick() {
         const EVehicleEntityTypes vehicleType = vehicleGeneratorEntity->second.getVehicleType();
 
         // FIXME length hardcoded
-        const id roadId = world.at(vehicleGeneratorEntity->second.getId()).first;
+        const id roadId = staticWorld.at(vehicleGeneratorEntity->second.getId()).first;
 
-        const std::list<id> vehicleIds = vehiclesOnRoads.at(roadId);
+        const std::list<id> &vehicleIds = vehiclesOnRoads.at(roadId);
+        const long coaster = coasterSlots.at(roadId);
+        if (coaster != -1) settleCoaster(coasters[coaster]);
 
         bool canSpawn = true;
         for (std::list<id>::const_iterator it = vehicleIds.begin(); it != vehicleIds.end(); ++it) {
@@ -330,12 +443,78 @@ void Simulation::godTick() {
             // spawn vehicle
             spawnVehicle(roadId, 0, vehicleType);
     }
+    SIM_PROFILE_LAP(clock, EPhase::kGenerators, vehicleGenerators.size());
 
     ++iteration;
+    ++stateVersion;
 
     ENSURE(getIteration() == prevIteration + 1, "The simulation is ticked");
 }
 
+void Simulation::setSeed(unsigned int seed) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    rng.seed(seed);
+}
+
+void Simulation::setThreadCount(unsigned int threads) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(threads > 0, "at least one thread");
+    workers.resize(threads);
+    ENSURE(getThreadCount() == threads, "thread count is set");
+}
+
+void Simulation::godTicks(const unsigned int ticks) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    const unsigned int prevIteration = iteration;
+    for (unsigned int tick = 0; tick < ticks; ++tick) godTick();
+    ENSURE(getIteration() == prevIteration + ticks, "The simulation is ticked");
+}
+
+std::optional<id> Simulation::injectVehicle(const id roadId, const double position, const EVehicleEntityTypes type) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid");
+    REQUIRE(position >= 0, "position is positive or zero");
+
+    // vehicles of a mesoscopic road have no id, they only exist in the queue of its link
+    if (mesoLinks.find(roadId) != mesoLinks.end() || position > roads.at(roadId).getLength()) return std::nullopt;
+
+    // checked before the vehicle exists, so a vehicle that does not fit uses no id
+    const double length = VehicleProfile::of(type).length;
+    if (!isRoadFree(roadId, position - length, length)) return std::nullopt;
+
+    const id vehicleId = idGen.next();
+    addVehicle(VehicleEntity(vehicleId, type), roadId, position);
+    return vehicleId;
+}
+
+bool Simulation::removeVehicle(const id vehicleId) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    if (world.find(vehicleId) == world.end()) return false;
+    deleteVehicle(vehicleId);
+    ENSURE(getVehicles().find(vehicleId) == getVehicles().end(), "vehicle is not in the simulation");
+    return true;
+}
+
+RoadView Simulation::getRoadView(const id roadId) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid");
+    refreshSnapshot();
+
+    const std::size_t slot = snapshot.roadSlots.at(roadId);
+    const std::size_t first = snapshot.vehicleOffsets[slot];
+    const std::size_t count = snapshot.vehicleCounts[slot];
+    const std::size_t firstLight = snapshot.lightOffsets[slot];
+    const std::size_t lightCount = snapshot.lightOffsets[slot + 1] - firstLight;
+    return {roads.at(roadId),
+            {snapshot.vehicleIds.data() + first, count},
+            {snapshot.positions.data() + first, count},
+            {snapshot.velocities.data() + first, count},
+            {snapshot.types.data() + first, count},
+            {snapshot.lightIds.data() + firstLight, lightCount},
+            {snapshot.lightPositions.data() + firstLight, lightCount},
+            {snapshot.lightsGreen.data() + firstLight, lightCount}};
+}
+
 // private function members
 
 // ╔════════════════════════════════════════╗
@@ -352,12 +531,94 @@ bool Simulation::spawnVehicle(const unsigned int roadId, const double position,
     // check if spawn position is within road length
     if (position > roadLength) { return false; }
 
+    // vehicles on a mesoscopic road only exist in the queue of its link
+    const std::map<id, MesoLinkEntity>::iterator link = mesoLinks.find(roadId);
+    if (link != mesoLinks.end()) {
+        if (!link->second.canEnter()) return false;
+        link->second.enter(type, position, iteration * stepSize);
+        return true;
+    }
+
     const unsigned int currentId = idGen.next();
-    vehicles.insert({currentId, {currentId, stepSize, type}});
+    addVehicle(VehicleEntity(currentId, type), roadId, position);
+    return true;
+}
+
+void Simulation::addVehicle(const VehicleEntity &vehicle, const id roadId, const double position) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(getVehicles().find(vehicle.getId()) == getVehicles().end(), "vehicle is new");
+    REQUIRE(mesoLinks.find(roadId) == mesoLinks.end(), "road is microscopic");
+
+    // the vehicle that coasted on the road is no longer alone
+    wakeCoaster(roadId);
+
+    const id vehicleId = vehicle.getId();
+    vehicles.insert({vehicleId, vehicle});
+
+    world.insert({vehicleId, {roadId, position}});
+
+    vehiclesOnRoads[roadId].push_back(vehicleId);
+    ++roadEpochs.at(roadId);
+    updateRoadActivity(roadId);
+    markSnapshotRoad(roadId);
+    ++stateVersion;
+    SIM_PROFILE_COUNT(profiler.countSpawn());
+
+    // ids only go up, so the steps stay sorted
+    VehicleStep step{};
+    step.vehicleId = vehicleId;
+    step.vehicleClass = vehicle.getClass();
+    step.roadId = roadId;
+    vehicleSteps.push_back(step);
+    bucketsValid = false;
+}
+
+bool Simulation::materializeVehicle(const id roadId, const double position, const EVehicleEntityTypes type) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(mesoLinks.find(roadId) == mesoLinks.end(), "road is microscopic");
+
+    VehicleEntity vehicle(idGen.next(), type);
+    if (!isRoadFree(roadId, position, vehicle.getLength())) return false;
 
-    world.insert({currentId, {roadId, position}});
+    // the link let the vehicle drive at its maximal velocity, like moveVehicle the front is placed after the crossroad
+    vehicle.setVelocity(vehicle.getMaxVelocity());
+    addVehicle(vehicle, roadId, position + vehicle.getLength());
+    return true;
+}
+
+bool Simulation::turnMesoVehicle(const MesoLinkEntity::Vehicle &vehicle, const double now) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(getCrossRoads().find(vehicle.crossRoad) != getCrossRoads().end(), "vehicle reached a crossroad");
+
+    // 0 = turn, 1 = straight ahead
+    std::uniform_int_distribution distr(0, 1);
+    if (distr(rng) != 0) return false;
+
+    const id otherCrossRoadId = crossRoads.at(vehicle.crossRoad).getCounterPart();
+    const id newRoadId = staticWorld.at(otherCrossRoadId).first;
+    const double newPosition = staticWorld.at(otherCrossRoadId).second;
+
+    const std::map<id, MesoLinkEntity>::iterator link = mesoLinks.find(newRoadId);
+    if (link == mesoLinks.end()) return materializeVehicle(newRoadId, newPosition, vehicle.type);
+
+    if (!link->second.canEnter()) return false;
+    link->second.enter(vehicle.type, newPosition, now);
+    return true;
+}
+
+bool Simulation::isRoadFree(const id roadId, const double position, const double length) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
 
-    vehiclesOnRoads[roadId].push_back(currentId);
+    const long coaster = coasterSlots.at(roadId);
+    if (coaster != -1) settleCoaster(coasters[coaster]);
+
+    for (std::list<id>::const_iterator otherVehicle = vehiclesOnRoads.at(roadId).begin();
+         otherVehicle != vehiclesOnRoads.at(roadId).end(); ++otherVehicle) {
+        if (world.at(*otherVehicle).second - vehicles.at(*otherVehicle).getLength() - position < length &&
+            world.at(*otherVehicle).second >= position - (length + vehicles.at(*otherVehicle).getMinimalFollow())) {
+            return false;
+        }
+    }
     return true;
 }
 
@@ -366,8 +627,8 @@ bool Simulation::spawnLightCrossroad(const id roadIdOne, const double posOne, co
     REQUIRE(properlyInitialized(), "Simulation is properly initialized");
     REQUIRE(getRoads().find(roadIdOne) != getRoads().end(), "roadIdOne is valid");
     REQUIRE(posOne >= 1, "position one is 1 or more");
-    REQUIRE(getRoads().find(roadIdOne) != getRoads().end(), "roadIdTwo is valid");
-    REQUIRE(posOne >= 1, "position two is 1 or more");
+    REQUIRE(getRoads().find(roadIdTwo) != getRoads().end(), "roadIdTwo is valid");
+    REQUIRE(posTwo >= 1, "position two is 1 or more");
 
     // generate id's for crossroads
     id idOne = idGen.next();
@@ -377,8 +638,8 @@ bool Simulation::spawnLightCrossroad(const id roadIdOne, const double posOne, co
     crossRoads.insert({idOne, CrossRoadObject(idOne, idTwo)});
     crossRoads.insert({idTwo, CrossRoadObject(idTwo, idOne)});
 
-    world.insert({idOne, {roadIdOne, posOne}});
-    world.insert({idTwo, {roadIdTwo, posTwo}});
+    staticWorld.insert({idOne, {roadIdOne, posOne}});
+    staticWorld.insert({idTwo, {roadIdTwo, posTwo}});
 
     crossRoadsOnRoads[roadIdOne].push_back(idOne);
     crossRoadsOnRoads[roadIdTwo].push_back(idTwo);
@@ -401,7 +662,7 @@ bool Simulation::spawnLight(const id road, const double pos, const int cycle, bo
 
     lights.insert({currentId, light});
 
-    world.insert({currentId, {road, pos}});
+    staticWorld.insert({currentId, {road, pos}});
     lightsOnRoads[road].push_back(currentId);
     return true;
 }
@@ -411,22 +672,13 @@ bool Simulation::moveVehicle(const id roadId, const double position, const id ve
     REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is vlaid");
     REQUIRE(getWorld().at(vehicleId).first != roadId, "road to move to is a different one");
     REQUIRE(position >= 0, "position is positive or zero");
-    bool result = true;
-
     const id oldRoadId = world.at(vehicleId).first;
 
     // check if the vehicle will collide with existing vehicle
-    for (std::list<id>::const_iterator otherVehicle = vehiclesOnRoads.at(roadId).begin();
-         otherVehicle != vehiclesOnRoads.at(roadId).end(); ++otherVehicle) {
-        if (world.at(*otherVehicle).second - vehicles.at(*otherVehicle).getLength() - position <
-              vehicles.at(vehicleId).getLength() &&
-            world.at(*otherVehicle).second >=
-              position - (vehicles.at(vehicleId).getLength() + vehicles.at(*otherVehicle).getMinimalFollow())) {
-            result = false;
-        }
-    }
+    const bool result = isRoadFree(roadId, position, vehicles.at(vehicleId).getLength());
 
     if (result) {
+        wakeCoaster(roadId);
         world[vehicleId] = {roadId, position + vehicles.at(vehicleId).getLength()};
         std::list<id> &vehicleIds = vehiclesOnRoads[oldRoadId];
 
@@ -438,6 +690,13 @@ bool Simulation::moveVehicle(const id roadId, const double position, const id ve
         }
 
         vehiclesOnRoads[roadId].push_back(vehicleId);
+
+        ++roadEpochs.at(oldRoadId);
+        ++roadEpochs.at(roadId);
+        updateRoadActivity(oldRoadId);
+        updateRoadActivity(roadId);
+        markSnapshotRoad(oldRoadId);
+        markSnapshotRoad(roadId);
     }
 
     ENSURE(getVehicles().find(vehicleId) != getVehicles().end(), "vehicle is present in the database");
@@ -451,18 +710,388 @@ bool Simulation::deleteVehicle(const id vehicleId) {
     REQUIRE(getWorld().find(vehicleId) != getWorld().end(), "vehicle is present in the world");
 
     const id roadId = world.at(vehicleId).first;
+    wakeCoaster(roadId);
     world.erase(vehicleId);
     vehicles.erase(vehicleId);
 
     std::list<id> &vehicleIds = vehiclesOnRoads[roadId];
     vehicleIds.erase(std::remove(vehicleIds.begin(), vehicleIds.end(), vehicleId));
 
+    const std::vector<VehicleStep>::iterator step =
+      std::lower_bound(vehicleSteps.begin(), vehicleSteps.end(), vehicleId,
+                       [](const VehicleStep &step, const id vehicleId) { return step.vehicleId < vehicleId; });
+    if (step != vehicleSteps.end() && step->vehicleId == vehicleId) {
+        step->removed = true;
+        ++removedSteps;
+        bucketsValid = false;
+    } else {
+        // a woken coaster that did not return to the steps yet
+        wokenSteps.erase(std::find_if(wokenSteps.begin(), wokenSteps.end(),
+                                      [vehicleId](const VehicleStep &woken) { return woken.vehicleId == vehicleId; }));
+    }
+
+    ++roadEpochs.at(roadId);
+    updateRoadActivity(roadId);
+    markSnapshotRoad(roadId);
+    ++stateVersion;
+    SIM_PROFILE_COUNT(profiler.countDespawn());
     return true;
 
     ENSURE(getVehicles().find(vehicleId) == getVehicles().end(), "vehicle is deleted from the database");
     ENSURE(getWorld().find(vehicleId) == getWorld().end(), "vehicle is deleted from the world");
 }
 
+/// first feature at or after the position on a road (the first one added when several share it), nullptr if none
+template <typename Feature>
+static const Feature *firstFeatureFrom(const std::vector<Feature> &features, const double position) {
+    const typename std::vector<Feature>::const_iterator feature =
+      std::lower_bound(features.begin(), features.end(), position,
+                       [](const Feature &feature, const double position) { return feature.position < position; });
+    return feature != features.end() ? &*feature : nullptr;
+}
+
+void Simulation::gatherVehicleStep(VehicleStep &step) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(getVehicles().find(step.vehicleId) != getVehicles().end(), "vehicle is present in the database");
+
+    const id vehicleId = step.vehicleId;
+    const std::pair<id, double> &location = world.at(vehicleId);
+    const double position = location.second;
+    const RoadFeatures &features = roadFeatures.at(location.first);
+
+    // get id of vehicle in front
+    const id vehicleInFront = getVehicleInFront(vehicleId);
+    const StaticFeature<LightEntity> *lightInFront = firstFeatureFrom(features.lights, position);
+
+    // set default values for all parameters
+    step.distToLight = std::numeric_limits<double>::infinity();
+    step.distToVehicle = std::numeric_limits<double>::infinity();
+    step.velVehicleInFront = std::numeric_limits<double>::infinity();
+    step.distToBusStop = std::numeric_limits<double>::infinity();
+    step.busHaltTime = std::numeric_limits<int>::infinity();
+    step.busStopInFront = std::numeric_limits<id>::infinity();
+    step.priorityVehicleInFront = false;
+    step.roadId = location.first;
+    step.oldPos = position;
+    step.newPos = position;
+
+    // what the inputs depend on, a settled vehicle sleeps until one of these changes
+    step.vehicleInFront = vehicleInFront;
+    step.lightInFront = lightInFront ? lightInFront->entity : nullptr;
+    step.lightWasGreen = lightInFront && lightInFront->entity->isGreen();
+    step.roadEpoch = roadEpochs.at(location.first);
+
+    // nothing in front: a light only influences the vehicle within its reach (one meter extra covers rounding). The
+    // inputs are looked up again after the next crossroad (the vehicle may turn there) and at the end of the road.
+    step.freeFlowing = false;
+    if (freeFlow && vehicleInFront == vehicleId && step.vehicleClass != EVehicleClass::kBus) {
+        step.freeUntil = roads.at(location.first).getLength();
+        if (lightInFront) {
+            step.freeUntil = std::min(step.freeUntil, lightInFront->position - VehicleEntity::kObstacleReach - 1);
+        }
+        const std::vector<CrossRoadFeature>::const_iterator crossRoadInFront = std::upper_bound(
+          features.crossRoads.begin(), features.crossRoads.end(), position,
+          [](const double position, const CrossRoadFeature &feature) { return position < feature.position; });
+        if (crossRoadInFront != features.crossRoads.end()) {
+            step.freeUntil = std::min(step.freeUntil, crossRoadInFront->position);
+        }
+        step.freeFlowing = position < step.freeUntil;
+    }
+
+    if (lightInFront && !lightInFront->entity->isGreen()) step.distToLight = lightInFront->position - position;
+    if (vehicleInFront != vehicleId) {
+        const VehicleEntity &vehicleInFrontObject = vehicles.at(vehicleInFront);
+        step.distToVehicle = world.at(vehicleInFront).second - position - vehicleInFrontObject.getLength();
+        step.velVehicleInFront = vehicleInFrontObject.getVelocity();
+
+        if (vehicleInFrontObject.getClass() == EVehicleClass::kPriority &&
+            vehicleInFrontObject.getAcceleration() == vehicleInFrontObject.getMaxAcceleration()) {
+            step.priorityVehicleInFront = true;
+        }
+    }
+    if (step.vehicleClass == EVehicleClass::kBus) {
+        const StaticFeature<BusStopEntity> *busStopInFront = firstFeatureFrom(features.busStops, position);
+        step.busStopInFront = vehicleId;
+
+        if (busStopInFront) {
+            step.busStopInFront = busStopInFront->featureId;
+            step.distToBusStop = busStopInFront->position - position;
+            step.busHaltTime = busStopInFront->entity->getHaltTime();
+        }
+    }
+}
+
+template <typename Policy>
+void Simulation::updateVehicleStep(VehicleStep &step, const unsigned int pass, const unsigned int passes) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(step.vehicleClass == Policy::kClass, "vehicle belongs to the class of the policy");
+
+    if (step.asleep) return;
+
+    double tickFraction = 1;
+    if (passes > 1) {
+        const unsigned int substeps = roadRates.at(step.roadId).substeps;
+        if (pass >= substeps) return;
+        tickFraction = 1.0 / substeps;
+    }
+
+    if (!step.updated) {
+        step.startPos = step.oldPos;
+        step.updated = true;
+    }
+
+    VehicleEntity &vehicle = vehicles.at(step.vehicleId);
+
+    // same state and same inputs as the last update, which would give the same displacement (the vehicle still moves
+    // and is committed this tick, only the car following model is not run)
+    if (step.freeFlowing && step.cruising && step.tickFraction == tickFraction && vehicle.isSteady()) {
+        step.newPos = step.oldPos + step.displacement;
+        step.acceleration = std::abs(vehicle.getAcceleration());
+        step.jerk = 0;
+        return;
+    }
+
+    const double oldAcceleration = vehicle.getAcceleration();
+
+    // FIXME distances wrong when turned at crossroads.
+    step.displacement = vehicle.update<Policy>(step.distToVehicle, step.velVehicleInFront, step.distToLight,
+                                               step.distToBusStop, step.busHaltTime, step.busStopInFront,
+                                               step.priorityVehicleInFront, stepSize, tickFraction);
+    step.newPos = step.oldPos + step.displacement;
+    step.velocity = vehicle.getVelocity();
+    step.cruising = step.freeFlowing;
+    step.tickFraction = tickFraction;
+    step.acceleration = std::abs(vehicle.getAcceleration());
+    step.jerk = std::abs(vehicle.getAcceleration() - oldAcceleration) / (stepSize * tickFraction);
+
+    // nothing changed, the vehicle will keep doing this until one of its inputs changes
+    step.asleep = sleeping && vehicle.isSettled();
+}
+
+template <typename Policy>
+void Simulation::updateVehicleBucket(const unsigned int pass, const unsigned int passes) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(bucketsValid, "buckets match the vehicle steps");
+
+    const std::vector<std::size_t> &bucket = vehicleBuckets[(std::size_t) Policy::kClass];
+    workers.parallelFor(bucket.size(), [this, &bucket, pass, passes](std::size_t begin, std::size_t end) {
+        SIM_TRACE_SCOPE("updateChunk");
+        for (std::size_t i = begin; i < end; ++i) updateVehicleStep<Policy>(vehicleSteps[bucket[i]], pass, passes);
+    });
+}
+
+void Simulation::fillVehicleBuckets() {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    for (std::vector<std::size_t> &bucket : vehicleBuckets) bucket.clear();
+    for (std::size_t i = 0; i < vehicleSteps.size(); ++i) {
+        vehicleBuckets[(std::size_t) vehicleSteps[i].vehicleClass].push_back(i);
+    }
+    bucketsValid = true;
+
+    ENSURE(bucketsValid, "buckets match the vehicle steps");
+}
+
+void Simulation::compactVehicleSteps() {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    vehicleSteps.erase(std::remove_if(vehicleSteps.begin(), vehicleSteps.end(),
+                                      [](const VehicleStep &step) { return step.removed; }),
+                       vehicleSteps.end());
+    removedSteps = 0;
+    bucketsValid = false;
+
+    ENSURE(removedSteps == 0, "no removed steps are left");
+}
+
+bool Simulation::shouldWake(const VehicleStep &step) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(step.asleep, "vehicle is asleep");
+
+    const id vehicleId = step.vehicleId;
+
+    // a vehicle entered or left the road, the vehicle in front may be another one
+    if (roadEpochs.at(world.at(vehicleId).first) != step.roadEpoch) return true;
+
+    // the vehicle in front changed during the previous tick
+    if (step.vehicleInFront != vehicleId && !vehicles.at(step.vehicleInFront).isSettled()) return true;
+
+    // the light in front changed color
+    if (step.lightInFront && step.lightInFront->isGreen() != step.lightWasGreen) return true;
+
+    return false;
+}
+
+bool Simulation::startCoasting(VehicleStep &step) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(!step.removed, "vehicle is in the per-tick steps");
+
+    // the next tick would repeat the displacement of this one, and nobody behind the vehicle reads its position
+    if (!freeFlow || maxSubsteps > 1 || step.asleep || !step.cruising || step.tickFraction != 1) return false;
+    if (!(step.displacement > 0) || vehiclesOnRoads.at(step.roadId).size() != 1) return false;
+    if (roadEpochs.at(step.roadId) != step.roadEpoch || !vehicles.at(step.vehicleId).isSteady()) return false;
+
+    // the last tick it skips ends before freeUntil, so it crosses no crossroad and stays on its road (the estimate is
+    // lowered until the rounded positions agree)
+    const double position = world.at(step.vehicleId).second;
+    const double estimate = std::max(0.0, std::floor((step.freeUntil - position) / step.displacement));
+    unsigned int ticks = (unsigned int) std::min(
+      estimate, (double) (std::numeric_limits<unsigned int>::max() - committedTicks));
+    while (ticks > 0 && Utils::addRepeatedly(position, step.displacement, ticks) >= step.freeUntil) --ticks;
+
+    // a vehicle close to freeUntil is not worth taking out
+    if (ticks < 2) return false;
+
+    coasterSlots.at(step.roadId) = coasters.size();
+    coasters.push_back({step, committedTicks, position, committedTicks + ticks});
+    nextHorizon = std::min(nextHorizon, committedTicks + ticks);
+
+    step.removed = true;
+    ++removedSteps;
+    bucketsValid = false;
+    return true;
+}
+
+void Simulation::settleCoaster(const Coaster &coaster) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    const double position =
+      Utils::addRepeatedly(coaster.anchorPos, coaster.step.displacement, committedTicks - coaster.anchorTick);
+    world.at(coaster.step.vehicleId).second = position;
+    if (snapshot.inSync) snapshot.positions[coaster.step.viewSlot] = position;
+}
+
+void Simulation::settleCoasters() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    if (settledTick == committedTicks) return;
+    for (const Coaster &coaster : coasters) settleCoaster(coaster);
+    settledTick = committedTicks;
+
+    ENSURE(settledTick == committedTicks, "positions of the coasters are up to date");
+}
+
+void Simulation::wakeCoaster(const id roadId) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    long &slot = coasterSlots.at(roadId);
+    if (slot == -1) return;
+
+    // the vehicle continues from where it is now, with the inputs it coasted with
+    const Coaster &coaster = coasters[slot];
+    settleCoaster(coaster);
+    VehicleStep step = coaster.step;
+    step.oldPos = world.at(step.vehicleId).second;
+    step.newPos = step.oldPos;
+    step.startPos = step.oldPos;
+    step.updated = false;
+    step.removed = false;
+    wokenSteps.push_back(step);
+
+    // move the last coaster into the freed slot
+    const id lastRoadId = coasters.back().step.roadId;
+    coasters[slot] = coasters.back();
+    coasterSlots.at(lastRoadId) = slot;
+    coasters.pop_back();
+    slot = -1;
+
+    ENSURE(coasterSlots.at(roadId) == -1, "road has no coasting vehicle");
+}
+
+void Simulation::wakeCoasters(const unsigned int untilTick) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    // backwards, so the coaster that moves into a freed slot was already looked at
+    nextHorizon = std::numeric_limits<unsigned int>::max();
+    for (std::size_t i = coasters.size(); i-- > 0;) {
+        if (coasters[i].horizonTick <= untilTick)
+            wakeCoaster(coasters[i].step.roadId);
+        else
+            nextHorizon = std::min(nextHorizon, coasters[i].horizonTick);
+    }
+}
+
+void Simulation::mergeWokenSteps() {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    for (const VehicleStep &woken : wokenSteps) {
+        vehicleSteps.insert(
+          std::lower_bound(vehicleSteps.begin(), vehicleSteps.end(), woken.vehicleId,
+                           [](const VehicleStep &step, const id vehicleId) { return step.vehicleId < vehicleId; }),
+          woken);
+    }
+    wokenSteps.clear();
+    bucketsValid = false;
+
+    ENSURE(wokenSteps.empty(), "every woken step is back");
+}
+
+const Simulation::VehicleStep &Simulation::stepOf(const id vehicleId, const id roadId) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    const std::vector<VehicleStep>::const_iterator step =
+      std::lower_bound(vehicleSteps.begin(), vehicleSteps.end(), vehicleId,
+                       [](const VehicleStep &step, const id vehicleId) { return step.vehicleId < vehicleId; });
+    if (step != vehicleSteps.end() && step->vehicleId == vehicleId && !step->removed) return *step;
+
+    const long coaster = coasterSlots.at(roadId);
+    if (coaster != -1 && coasters[coaster].step.vehicleId == vehicleId) return coasters[coaster].step;
+
+    return *std::find_if(wokenSteps.begin(), wokenSteps.end(),
+                         [vehicleId](const VehicleStep &woken) { return woken.vehicleId == vehicleId; });
+}
+
+void Simulation::updateRoadActivity(const id roadId) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    // a generator makes its road active through the vehicle it spawns, on the tick the spawn is due
+    const bool active = !vehiclesOnRoads.at(roadId).empty();
+    long &slot = activeRoadSlots.at(roadId);
+
+    if (active && slot == -1) {
+        slot = activeRoads.size();
+        activeRoads.push_back(roadId);
+    } else if (!active && slot != -1) {
+        // move the last active road into the freed slot
+        const id lastRoadId = activeRoads.back();
+        activeRoads[slot] = lastRoadId;
+        activeRoadSlots.at(lastRoadId) = slot;
+        activeRoads.pop_back();
+        slot = -1;
+    }
+
+    ENSURE(isRoadActive(roadId) == active, "road is active when it is occupied");
+}
+
+unsigned int Simulation::planSubsteps() {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    unsigned int passes = 1;
+    for (const id roadId : activeRoads) {
+        RoadRate &rate = roadRates.at(roadId);
+        const unsigned int epoch = roadEpochs.at(roadId);
+
+        // a vehicle entered or left the road, its surroundings are unknown: resolve them as fine as possible
+        unsigned int substeps = maxSubsteps;
+        if (epoch == rate.epoch) {
+            // an update over a step h moves the vehicle acceleration * h^2 further than the exact motion (the new
+            // velocity is used for the whole step), keeping the acceleration while it changes adds about jerk * h^3 / 6
+            substeps = 1;
+            while (substeps < maxSubsteps) {
+                const double h = stepSize / substeps;
+                if (rate.acceleration * h * h + rate.jerk * h * h * h / 6 <= tolerance) break;
+                substeps *= 2;
+            }
+        }
+
+        rate = {substeps, 0, 0, epoch};
+        passes = std::max(passes, substeps);
+    }
+
+    ENSURE(passes >= 1 && passes <= maxSubsteps, "amount of passes is valid");
+    return passes;
+}
+
 id Simulation::getVehicleInFront(const id vehicleId) const {
     REQUIRE(properlyInitialized(), "Simulation is properly initialized");
 
@@ -487,53 +1116,190 @@ id Simulation::getVehicleInFront(const id vehicleId) const {
     return vehicleInFront;
 }
 
-id Simulation::getLightInFront(const id vehicleId) const {
+void Simulation::buildRoadFeatures() {
     REQUIRE(properlyInitialized(), "Simulation is properly initialized");
 
-    const double currPosition = world.at(vehicleId).second;
+    roadFeatures.clear();
+    for (const std::pair<const id, RoadObject> &road : roads) {
+        RoadFeatures &features = roadFeatures[road.first];
 
-    // get lights on the same road
-    const id roadId = world.at(vehicleId).first;
-    const std::list<id> &lightIds = lightsOnRoads.at(roadId);
-
-    id lightInFront = vehicleId;
-    // set position to infinity so the first light's position is always smaller
-    double posLightInFront = INFINITY;
-    // for all lights
-    for (std::list<id>::const_iterator it = lightIds.begin(); it != lightIds.end(); ++it) {
-        const double lightPos = world.at(*it).second;
-
-        if (lightPos >= currPosition && posLightInFront > lightPos) {
-            lightInFront = *it;
-            posLightInFront = lightPos;
+        for (const id lightId : lightsOnRoads.at(road.first)) {
+            features.lights.push_back({staticWorld.at(lightId).second, lightId, &lights.at(lightId)});
+        }
+        for (const id busStopId : busStopsOnRoads.at(road.first)) {
+            features.busStops.push_back({staticWorld.at(busStopId).second, busStopId, &busstops.at(busStopId)});
+        }
+        for (const id crossRoadId : crossRoadsOnRoads.at(road.first)) {
+            const id otherCrossRoadId = crossRoads.at(crossRoadId).getCounterPart();
+            const std::pair<id, double> &other = staticWorld.at(otherCrossRoadId);
+            features.crossRoads.push_back(
+              {staticWorld.at(crossRoadId).second, crossRoadId, otherCrossRoadId, other.first, other.second});
         }
+
+        // stable, so objects at the same position keep the order they were added in
+        const auto byPosition = [](const auto &a, const auto &b) { return a.position < b.position; };
+        std::stable_sort(features.lights.begin(), features.lights.end(), byPosition);
+        std::stable_sort(features.busStops.begin(), features.busStops.end(), byPosition);
+        std::stable_sort(features.crossRoads.begin(), features.crossRoads.end(), byPosition);
     }
 
-    return lightInFront;
+    ENSURE(roadFeatures.size() == getRoads().size(), "every road has its features");
 }
 
-id Simulation::getBusStopInFront(const id vehicleId) const {
+void Simulation::buildSnapshotLayout() {
     REQUIRE(properlyInitialized(), "Simulation is properly initialized");
 
-    const double currPosition = world.at(vehicleId).second;
+    // the roads in id order, so the layout does not depend on the order of the road database
+    snapshot = StateSnapshot();
+    for (const std::pair<const id, RoadObject> &road : roads) snapshot.roadIds.push_back(road.first);
+    std::sort(snapshot.roadIds.begin(), snapshot.roadIds.end());
+
+    snapshot.lightOffsets.push_back(0);
+    for (std::size_t slot = 0; slot < snapshot.roadIds.size(); ++slot) {
+        const id roadId = snapshot.roadIds[slot];
+        snapshot.roadSlots[roadId] = slot;
+        for (const StaticFeature<LightEntity> &light : roadFeatures.at(roadId).lights) {
+            snapshot.lightIds.push_back(light.featureId);
+            snapshot.lightPositions.push_back(light.position);
+            snapshot.lightEntities.push_back(light.entity);
+        }
+        snapshot.lightOffsets.push_back(snapshot.lightIds.size());
+    }
+    snapshot.lightsGreen.resize(snapshot.lightIds.size());
+    snapshot.vehicleOffsets.assign(snapshot.roadIds.size() + 1, 0);
+    snapshot.vehicleCounts.assign(snapshot.roadIds.size(), 0);
+    snapshot.roadChanged.assign(snapshot.roadIds.size(), 0);
+    snapshot.changedRoads.reserve(snapshot.roadIds.size());
 
-    // get lights on the same road
-    const id roadId = world.at(vehicleId).first;
-    const std::list<id> &busStopIds = busStopsOnRoads.at(roadId);
-
-    id busStopInFront = vehicleId;
-    // set position to infinity so the first light's position is always smaller
-    double posBusStopInFront = INFINITY;
-    // for all lights
-    for (std::list<id>::const_iterator it = busStopIds.begin(); it != busStopIds.end(); ++it) {
-        const double busStopPos = world.at(*it).second;
-
-        if (busStopPos >= currPosition && posBusStopInFront > busStopPos) {
-            busStopInFront = *it;
-            posBusStopInFront = busStopPos;
+    ENSURE(snapshot.roadIds.size() == getRoads().size(), "every road has a slot in the snapshot");
+}
+
+void Simulation::refreshSnapshot() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    // the roads of the coasting vehicles are laid out from their current positions
+    settleCoasters();
+
+    if (!snapshot.inSync)
+        layoutSnapshot();
+    else if (!snapshot.changedRoads.empty())
+        syncSnapshot();
+
+    // the ticks write the vehicles into their slots, a road is only sorted again when two vehicles swapped places
+    if (snapshot.version != stateVersion) {
+        for (std::size_t slot = 0; slot < snapshot.roadIds.size(); ++slot) {
+            const std::size_t first = snapshot.vehicleOffsets[slot];
+            const std::size_t last = first + snapshot.vehicleCounts[slot];
+            for (std::size_t i = first + 1; i < last; ++i) {
+                if (snapshot.positions[i] < snapshot.positions[i - 1] ||
+                    (snapshot.positions[i] == snapshot.positions[i - 1] &&
+                     snapshot.vehicleIds[i] < snapshot.vehicleIds[i - 1])) {
+                    layoutSnapshotRoad(slot);
+                    break;
+                }
+            }
+        }
+        snapshot.version = stateVersion;
+    }
+
+    ENSURE(snapshot.inSync && snapshot.version == stateVersion, "snapshot is up to date");
+}
+
+void Simulation::layoutSnapshot() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    // every road gets room for half as many vehicles more, so vehicles entering a road rarely move the other roads
+    std::size_t next = 0;
+    for (std::size_t slot = 0; slot < snapshot.roadIds.size(); ++slot) {
+        const std::size_t count = vehiclesOnRoads.at(snapshot.roadIds[slot]).size();
+        snapshot.vehicleOffsets[slot] = next;
+        next += count + count / 2 + 4;
+    }
+    snapshot.vehicleOffsets.back() = next;
+
+    // the vectors keep their capacity, so laying out again does not allocate unless the snapshot grows
+    snapshot.vehicleIds.resize(next);
+    snapshot.positions.resize(next);
+    snapshot.velocities.resize(next);
+    snapshot.types.resize(next);
+
+    std::size_t vehicleCount = 0;
+    for (std::size_t slot = 0; slot < snapshot.roadIds.size(); ++slot) {
+        layoutSnapshotRoad(slot);
+        snapshot.roadChanged[slot] = 0;
+        vehicleCount += snapshot.vehicleCounts[slot];
+    }
+    snapshot.changedRoads.clear();
+    ENSURE(vehicleCount == vehicles.size(), "every vehicle is on a road");
+
+    for (std::size_t light = 0; light < snapshot.lightEntities.size(); ++light) {
+        snapshot.lightsGreen[light] = snapshot.lightEntities[light]->isGreen() ? 1 : 0;
+    }
+
+    snapshot.inSync = true;
+    snapshot.version = stateVersion;
+    ENSURE(snapshot.inSync && snapshot.changedRoads.empty(), "snapshot is laid out");
+}
+
+bool Simulation::layoutSnapshotRoad(const std::size_t slot) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+
+    const std::list<id> &vehicleIds = vehiclesOnRoads.at(snapshot.roadIds[slot]);
+    const std::size_t first = snapshot.vehicleOffsets[slot];
+    if (vehicleIds.size() > snapshot.vehicleOffsets[slot + 1] - first) return false;
+
+    // gather the vehicles of the road and sort them by position (by id when they share one, so the order does not
+    // depend on the order they entered the road in)
+    std::vector<RoadVehicle> &onRoad = snapshot.sortScratch;
+    onRoad.clear();
+    for (const id vehicleId : vehicleIds) {
+        const VehicleEntity &vehicle = vehicles.at(vehicleId);
+        onRoad.push_back({vehicleId, world.at(vehicleId).second, vehicle.getVelocity(), vehicle.getType()});
+    }
+    std::sort(onRoad.begin(), onRoad.end(), [](const RoadVehicle &a, const RoadVehicle &b) {
+        return a.position < b.position || (a.position == b.position && a.vehicleId < b.vehicleId);
+    });
+
+    std::size_t next = first;
+    for (const RoadVehicle &vehicle : onRoad) {
+        snapshot.vehicleIds[next] = vehicle.vehicleId;
+        snapshot.positions[next] = vehicle.position;
+        snapshot.velocities[next] = vehicle.velocity;
+        snapshot.types[next] = vehicle.type;
+
+        // the commits of the ticks (and the positions of a coasting vehicle) write to this slot
+        stepOf(vehicle.vehicleId, snapshot.roadIds[slot]).viewSlot = next;
+        ++next;
+    }
+    snapshot.vehicleCounts[slot] = onRoad.size();
+    return true;
+}
+
+void Simulation::syncSnapshot() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(snapshot.inSync, "snapshot is laid out");
+
+    for (const std::size_t slot : snapshot.changedRoads) {
+        if (!layoutSnapshotRoad(slot)) {
+            // the road outgrew its room, every road gets new room (this lays out the other changed roads too)
+            layoutSnapshot();
+            return;
         }
+        snapshot.roadChanged[slot] = 0;
     }
-    return busStopInFront;
+    snapshot.changedRoads.clear();
+
+    ENSURE(snapshot.changedRoads.empty(), "every road is laid out");
+}
+
+void Simulation::markSnapshotRoad(const id roadId) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    if (!snapshot.inSync) return;
+
+    const std::size_t slot = snapshot.roadSlots.at(roadId);
+    if (snapshot.roadChanged[slot]) return;
+    snapshot.roadChanged[slot] = 1;
+    snapshot.changedRoads.push_back(slot);
 }
 
 EVehicleEntityTypes Simulation::vehicleTypeStringToEnumVariant(const std::string &str) const {
@@ -615,9 +1381,32 @@ const std::unordered_map<id, CrossRoadObject> &Simulation::getCrossRoads() const
     return crossRoads;
 }
 
-const std::unordered_map<id, std::pair<id, double>> &Simulation::getWorld() const {
+const std::map<id, MesoLinkEntity> &Simulation::getMesoLinks() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    return mesoLinks;
+}
+
+const std::vector<id> &Simulation::getActiveRoads() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    return activeRoads;
+}
+
+bool Simulation::isRoadActive(const id roadId) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid");
+    return activeRoadSlots.at(roadId) != -1;
+}
+
+WorldView Simulation::getWorld() const {
     REQUIRE(properlyInitialized(), "Simulation is properly initialized");
-    return world;
+    settleCoasters();
+    return {world, staticWorld};
+}
+
+const RoadFeatures &Simulation::getRoadFeatures(const id roadId) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid");
+    return roadFeatures.at(roadId);
 }
 
 const unsigned int &Simulation::getIteration() const {
@@ -625,6 +1414,65 @@ const unsigned int &Simulation::getIteration() const {
     return iteration;
 }
 
+const double &Simulation::getStepSize() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    return stepSize;
+}
+
+void Simulation::setSleeping(bool enabled) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    sleeping = enabled;
+}
+
+unsigned int Simulation::getSleepingVehicles() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    return sleepingVehicles;
+}
+
+void Simulation::setAdaptiveStepping(unsigned int substeps, double errorTolerance) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(substeps > 0 && (substeps & (substeps - 1)) == 0, "substeps is a power of two");
+    REQUIRE(errorTolerance > 0, "tolerance is positive");
+    maxSubsteps = substeps;
+    tolerance = errorTolerance;
+
+    // the substeps of a road are planned from the vehicles on it
+    if (maxSubsteps > 1) wakeCoasters(std::numeric_limits<unsigned int>::max());
+}
+
+unsigned int Simulation::getSubsteps(const id roadId) const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid");
+    if (maxSubsteps == 1 || !isRoadActive(roadId)) return 1;
+    return roadRates.at(roadId).substeps;
+}
+
+void Simulation::setFreeFlow(bool enabled) {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    freeFlow = enabled;
+    if (!freeFlow) wakeCoasters(std::numeric_limits<unsigned int>::max());
+}
+
+unsigned int Simulation::getFreeFlowingVehicles() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    return freeFlowingVehicles;
+}
+
+unsigned int Simulation::getCoastingVehicles() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    return coastingVehicles;
+}
+
+unsigned int Simulation::getThreadCount() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    return workers.getThreadCount();
+}
+
+Profiler &Simulation::getProfiler() const {
+    REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+    return profiler;
+}
+
 // ╔════════════════════════════════════════╗
 // ║               Contracts                ║
 // ╚════════════════════════════════════════╝
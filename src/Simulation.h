@@ -15,21 +15,58 @@
 #include "lib/nlohmann-json/json.hpp"
 
 // local types
+#include "lib/profiler/Profiler.h"
 #include "lib/utils/Id.h"
+#include "lib/utils/Parallel.h"
+#include "lib/utils/WorldView.h"
 #include "lib/xml-validator/Validator.h"
 #include "objects/crossroad/CrossRoadObject.h"
 #include "objects/entities/busStop/BusStopEntity.h"
 #include "objects/entities/light/LightEntity.h"
+#include "objects/entities/mesoLink/MesoLinkEntity.h"
 #include "objects/entities/vehicle/VehicleEntity.h"
 #include "objects/entities/vehicleGenerator/VehicleGeneratorEntity.h"
 #include "objects/road/RoadObject.h"
+#include "objects/road/RoadView.h"
 
 // types
 #include <string>
 
 // collections
+#include <array>
+#include <limits>
 #include <list>
+#include <map>
+#include <optional>
 #include <unordered_map>
+#include <vector>
+
+#include <random>
+
+/// Light or bus stop on a road, these never move
+template <typename T>
+struct StaticFeature {
+    double position;  // position on the road
+    id featureId;     // id of the light or bus stop
+    const T *entity;  // the light or bus stop in its database, whose elements never move
+};
+
+/// Crossroad on a road, with the place a vehicle that turns there ends up
+struct CrossRoadFeature {
+    double position;       // position on the road
+    id crossRoadId;        // id of the crossroad
+    id otherCrossRoadId;   // id of its counterpart on the other road
+    id otherRoadId;        // road of the counterpart
+    double otherPosition;  // position of the counterpart on its road
+};
+
+/// The objects on a road that never move, every array sorted by position (objects at the same position in the order
+/// they were added)
+struct RoadFeatures {
+    std::vector<StaticFeature<LightEntity>> lights;
+    std::vector<StaticFeature<BusStopEntity>> busStops;
+    std::vector<CrossRoadFeature> crossRoads;
+};
 
 /**
  * @brief Main simulation definitions\n
@@ -47,6 +84,8 @@ class Simulation {
     std::unordered_map<id, VehicleEntity> vehicles;                    // stores the vehicles by id
     std::unordered_map<id, VehicleGeneratorEntity> vehicleGenerators;  // stores the vehicleGenerators by id
     std::unordered_map<id, CrossRoadObject> crossRoads;                // stores the crossRoads by id
+    std::map<id, MesoLinkEntity> mesoLinks;  // stores the queues of the mesoscopic roads by roadId (ordered, so the
+                                             // links are ticked in the same order every run)
 
     // helper databases
     std::unordered_map<std::string, id> roadMap;              // stores the roadId by roadName
@@ -54,12 +93,151 @@ class Simulation {
     std::unordered_map<id, std::list<id>> lightsOnRoads;      // stores arrays of lightIds by roadId
     std::unordered_map<id, std::list<id>> busStopsOnRoads;    // stores arrays of busStopIds by roadId
     std::unordered_map<id, std::list<id>> crossRoadsOnRoads;  // stores arrays of crossRoadIds by roadId
+    std::unordered_map<id, std::list<id>> generatorsOnRoads;  // stores arrays of vehicleGeneratorIds by roadId
 
-    std::unordered_map<id, std::pair<id, double>>
-      world;  // stores the roadId along with position on the road by objectId
+    std::vector<id> activeRoads;                  // roads that carry vehicles (unordered)
+    std::unordered_map<id, long> activeRoadSlots;  // index of the road in activeRoads by roadId, -1 if the road is idle
+
+    // stores the roadId and position of the vehicles by id (the readers write the positions of the coasting vehicles)
+    mutable std::unordered_map<id, std::pair<id, double>> world;
+    std::unordered_map<id, std::pair<id, double>> staticWorld;  // stores the roadId and position of the objects that
+                                                                // never move (lights, bus stops, crossroads, generators)
+    std::unordered_map<id, RoadFeatures> roadFeatures;  // stores the static objects of every road by roadId
 
     Id idGen;  // generates a new unique id every time it is called
 
+    std::mt19937 rng;  // decides the direction vehicles take at crossroads
+
+    /// Inputs and result of the update of one vehicle during a tick, gathered from the state of the previous tick
+    struct VehicleStep {
+        id vehicleId;
+        EVehicleClass vehicleClass;  // traffic rules the vehicle follows
+        id roadId;  // road the vehicle was on when the inputs were gathered
+        double distToVehicle;
+        double velVehicleInFront;
+        double distToLight;
+        double distToBusStop;
+        int busHaltTime;
+        id busStopInFront;  // vehicleId if none
+        bool priorityVehicleInFront;
+        double oldPos;  // position at the start of the tick
+        double newPos;  // position after the update, written back to the world at the end of the tick
+        double startPos;      // position at the start of the tick (differs from oldPos when the road is sub-stepped)
+        bool updated;         // the vehicle was updated at least once during this tick
+        double tickFraction;  // part of the tick covered by the last update
+        double acceleration;  // size of the acceleration after the last update
+        double jerk;          // change in acceleration per second during the last update
+
+        // the vehicle is settled and skips its updates until one of the things below changes
+        bool asleep;
+        id vehicleInFront;   // vehicle in front when the inputs were gathered (vehicleId if none)
+        const LightEntity *lightInFront;  // light in front when the inputs were gathered (nullptr if none)
+        bool lightWasGreen;  // color of that light
+        unsigned int roadEpoch;  // epoch of the road when the inputs were gathered
+
+        // the vehicle drives on a free road: nothing in front of it and no light within its reach, so its inputs are
+        // known without looking around until it gets close to freeUntil or a vehicle enters the road
+        bool freeFlowing;
+        double freeUntil;  // position from which the light in front can influence the vehicle, at most the position of
+                           // the next crossroad and the end of the road
+        bool cruising;     // the last update was done on a free road, so a steady vehicle can repeat its displacement
+        double displacement;  // displacement of the last update
+        double velocity;      // velocity after the last update
+
+        mutable std::size_t viewSlot;  // index of the vehicle in the snapshot, set when its road is laid out
+        bool removed;  // the vehicle left the simulation, the step is dropped by the next compaction
+    };
+
+    std::vector<VehicleStep> vehicleSteps;  // one step per vehicle in id order, kept between ticks
+    std::size_t removedSteps = 0;           // steps marked removed since the last compaction
+
+    // indices in vehicleSteps of the vehicles of every class, so each class is updated by its own specialized loop
+    std::array<std::vector<std::size_t>, kVehicleClassCount> vehicleBuckets;
+    bool bucketsValid = true;  // false when vehicles were added or removed since the buckets were filled
+
+    std::unordered_map<id, unsigned int> roadEpochs;  // changes every time a vehicle enters or leaves the road
+
+    /// Vehicle that is fast-forwarded: alone on its road, free flowing and steady, so every tick adds the same
+    /// displacement to its position until it gets close to freeUntil
+    struct Coaster {
+        VehicleStep step;          // step of the vehicle, out of vehicleSteps while it coasts
+        unsigned int anchorTick;   // committedTicks when it started to coast
+        double anchorPos;          // position at that moment
+        unsigned int horizonTick;  // iteration at which it is stepped again, its position is still before freeUntil
+    };
+
+    std::vector<Coaster> coasters;              // the coasting vehicles (unordered), at most one per road
+    std::unordered_map<id, long> coasterSlots;  // index of the coaster of the road in coasters by roadId, -1 if none
+    std::vector<VehicleStep> wokenSteps;        // steps of the coasters woken during or since the last tick, they
+                                                // return to vehicleSteps at the start of the next tick
+    unsigned int nextHorizon = std::numeric_limits<unsigned int>::max();  // no coaster has an earlier horizonTick
+    unsigned int committedTicks = 0;  // ticks the positions in the world are at (iteration, or one more from the
+                                      // commit of a tick until its end)
+    mutable unsigned int settledTick = 0;  // committedTicks when the positions of all coasters were last written
+    unsigned int coastingVehicles = 0;     // amount of vehicles that coasted during the last tick
+
+    /// Integration rate of a road when stepping adaptively
+    struct RoadRate {
+        unsigned int substeps;  // updates of the vehicles on the road per tick (a power of two)
+        double acceleration;    // largest size of an acceleration on the road during the tick
+        double jerk;            // largest change in acceleration per second on the road during the tick
+        unsigned int epoch;     // epoch of the road when the rate was chosen
+    };
+
+    std::unordered_map<id, RoadRate> roadRates;  // stores the integration rate by roadId
+
+    unsigned int maxSubsteps = 1;  // most updates per tick of a busy road, 1 disables adaptive stepping
+    double tolerance = 0;          // largest estimated position error (in meters) of a single vehicle update
+
+    Utils::WorkerPool workers;  // threads that gather and update the vehicles, started once by setThreadCount
+
+    bool sleeping = true;               // settled vehicles skip their updates
+    unsigned int sleepingVehicles = 0;  // amount of vehicles that skipped the last tick
+
+    bool freeFlow = true;                  // vehicles on a free road take cheaper lookups and updates, or coast
+    unsigned int freeFlowingVehicles = 0;  // amount of vehicles that drove on a free road during the last tick
+
+    mutable Profiler profiler;  // time per phase of the ticks and of the loggers, not part of the simulation state
+
+    /**
+     * Copy of the state of the vehicles and lights, one vector per attribute with the values of every road after each
+     * other, that the RoadViews present. Laid out from the databases when the first view is asked for; from then on
+     * godTick writes the new positions, velocities and colors into it while it commits them, and only the roads that
+     * vehicles entered or left are laid out again. A simulation without views does not keep it.
+     */
+    struct StateSnapshot {
+        std::unordered_map<id, std::size_t> roadSlots;  // index of the road in the offsets by roadId
+        std::vector<id> roadIds;                        // roadId by index
+
+        // vehicles of the road with index i are at [vehicleOffsets[i], vehicleOffsets[i] + vehicleCounts[i]), sorted
+        // by position. The room up to vehicleOffsets[i + 1] lets vehicles enter the road without moving other roads.
+        std::vector<std::size_t> vehicleOffsets;
+        std::vector<std::size_t> vehicleCounts;
+        std::vector<id> vehicleIds;
+        std::vector<double> positions;
+        std::vector<double> velocities;
+        std::vector<EVehicleEntityTypes> types;
+
+        // lights of the road with index i are at [lightOffsets[i], lightOffsets[i + 1]), the lights never move so
+        // only their colors are copied again
+        std::vector<std::size_t> lightOffsets;
+        std::vector<id> lightIds;
+        std::vector<double> lightPositions;
+        std::vector<const LightEntity *> lightEntities;
+        std::vector<unsigned char> lightsGreen;
+
+        bool inSync = false;                     // laid out, the ticks keep the values up to date
+        std::vector<std::size_t> changedRoads;   // indices of the roads vehicles entered or left since their layout
+        std::vector<unsigned char> roadChanged;  // 1 for the roads in changedRoads, by index
+
+        std::vector<RoadVehicle> sortScratch;  // vehicles of one road while they are sorted
+
+        unsigned long version = 0;  // stateVersion of the simulation at which the order on the roads was checked
+    };
+
+    unsigned long stateVersion = 1;  // changes every time the state the views present changes
+    mutable StateSnapshot snapshot;  // laid out by the first getRoadView, not part of the simulation state
+
     // function members
 
     /**
@@ -74,6 +252,50 @@ class Simulation {
      */
     bool spawnVehicle(const id roadId, const double position, const EVehicleEntityTypes type);
 
+    /**
+     * Adds an existing vehicle to the databases of a microscopic road \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(getVehicles().find(vehicle.getId()) == getVehicles().end(), "vehicle is new"); \n
+     * REQUIRE(mesoLinks.find(roadId) == mesoLinks.end(), "road is microscopic");
+     * @param vehicle vehicle to add, its id is larger than the id of every vehicle in the simulation
+     * @param roadId id of the road to put the vehicle on
+     * @param position position of the vehicle on the road
+     */
+    void addVehicle(const VehicleEntity &vehicle, const id roadId, const double position);
+
+    /**
+     * Turns a vehicle of a mesoscopic road into a VehicleEntity on a microscopic road, driving at its maximal velocity
+     * from the given crossroad position on \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(mesoLinks.find(roadId) == mesoLinks.end(), "road is microscopic");
+     * @param roadId id of the microscopic road
+     * @param position position of the crossroad on that road
+     * @param type type of the vehicle
+     * @return false when the position on the destination road is occupied
+     */
+    bool materializeVehicle(const id roadId, const double position, const EVehicleEntityTypes type);
+
+    /**
+     * Decides the direction of a vehicle of a mesoscopic road that reached a crossroad, like a microscopic vehicle
+     * would, and moves it to the other road when it turns \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(getCrossRoads().find(vehicle.crossRoad) != getCrossRoads().end(), "vehicle reached a crossroad");
+     * @param vehicle vehicle that left its link at the crossroad
+     * @param now current simulation time
+     * @return true if the vehicle turned, false if it goes straight ahead (or the other road has no room)
+     */
+    bool turnMesoVehicle(const MesoLinkEntity::Vehicle &vehicle, const double now);
+
+    /**
+     * Checks if a vehicle fits on the road at the given position, between the vehicles already on it \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param roadId id of the road
+     * @param position position the back of the vehicle would be at
+     * @param length length of the vehicle
+     * @return true if there is room
+     */
+    bool isRoadFree(const id roadId, const double position, const double length) const;
+
     /**
      * Adds a crossroad with paired smart lights to the simulation \n
      * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
@@ -124,17 +346,211 @@ class Simulation {
     /// happens).
     bool deleteVehicle(const id vehicleId);
 
+    /**
+     * Fills in the inputs of the vehicle's update (obstacles in front) from the current state. Only reads the
+     * simulation, so steps of different vehicles can be gathered at the same time. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(getVehicles().find(step.vehicleId) != getVehicles().end(), "vehicle is present in the database");
+     * @param step step with the vehicleId set
+     */
+    void gatherVehicleStep(VehicleStep &step) const;
+
+    /**
+     * Updates a vehicle during one pass of a tick from the inputs in its step, and writes the new position and the
+     * rates of change to the step \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(step.vehicleClass == Policy::kClass, "vehicle belongs to the class of the policy");
+     * @tparam Policy traffic rules of the class of the vehicle
+     * @param step step of the vehicle
+     * @param pass index of the pass within the tick
+     * @param passes amount of passes of the tick
+     */
+    template <typename Policy>
+    void updateVehicleStep(VehicleStep &step, const unsigned int pass, const unsigned int passes);
+
+    /**
+     * Updates all vehicles of one class during one pass of a tick, spread over the threads \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(bucketsValid, "buckets match the vehicle steps");
+     * @tparam Policy traffic rules of the class
+     * @param pass index of the pass within the tick
+     * @param passes amount of passes of the tick
+     */
+    template <typename Policy>
+    void updateVehicleBucket(const unsigned int pass, const unsigned int passes);
+
+    /**
+     * Sorts the vehicle steps into a bucket per vehicle class, in id order within every bucket \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(bucketsValid, "buckets match the vehicle steps");
+     */
+    void fillVehicleBuckets();
+
+    /**
+     * Drops the steps of the removed vehicles in a single pass, the other steps keep their id order \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(removedSteps == 0, "no removed steps are left");
+     */
+    void compactVehicleSteps();
+
+    /**
+     * Checks if a sleeping vehicle has to be updated again: a vehicle entered or left its road, the vehicle in front
+     * changed during the previous tick or the light in front changed color. Otherwise its update would have exactly
+     * the same inputs as the last one and change nothing. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(step.asleep, "vehicle is asleep");
+     * @param step step of the sleeping vehicle
+     * @return true if the vehicle has to be updated
+     */
+    bool shouldWake(const VehicleStep &step) const;
+
+    /**
+     * Takes a vehicle out of the per-tick steps when it is alone on its road, free flowing and steady, for as many
+     * ticks as its position stays before freeUntil (the next light within reach, crossroad or the end of the road).
+     * Stepping it every tick would add the same displacement every tick, so its position is only computed when it is
+     * read or when the vehicle is stepped again. Called at the end of its update, the step is marked removed. 
+
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); 
+
+     * REQUIRE(!step.removed, "vehicle is in the per-tick steps");
+     * @param step step of the vehicle
+     * @return true if the vehicle coasts
+     */
+    bool startCoasting(VehicleStep &step);
+
+    /**
+     * Writes the position of the coasting vehicle at committedTicks to the world and the snapshot, in closed form
+     * from its anchor (its velocity does not change while it coasts) 
+
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param coaster the coasting vehicle
+     */
+    void settleCoaster(const Coaster &coaster) const;
+
+    /**
+     * Writes the positions of all coasting vehicles, once per committedTicks 
+
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); 
+
+     * ENSURE(settledTick == committedTicks, "positions of the coasters are up to date");
+     */
+    void settleCoasters() const;
+
+    /**
+     * Stops the coasting vehicle of a road, if any, at its current position. Its step returns to the per-tick steps at
+     * the start of the next tick. Called before a vehicle enters or leaves the road. 
+
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); 
+
+     * ENSURE(coasterSlots.at(roadId) == -1, "road has no coasting vehicle");
+     * @param roadId id of the road
+     */
+    void wakeCoaster(const id roadId);
+
+    /**
+     * Stops the coasting vehicles whose horizonTick is at most untilTick 
+
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param untilTick last horizonTick to stop
+     */
+    void wakeCoasters(const unsigned int untilTick);
+
+    /**
+     * Puts the steps of the woken coasters back into vehicleSteps, in id order 
+
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); 
+
+     * ENSURE(wokenSteps.empty(), "every woken step is back");
+     */
+    void mergeWokenSteps();
+
+    /**
+     * Returns the step of a vehicle, wherever it is kept (per-tick, coasting or woken) 
+
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param vehicleId id of the vehicle
+     * @param roadId id of the road it is on
+     * @return the step of the vehicle
+     */
+    const VehicleStep &stepOf(const id vehicleId, const id roadId) const;
+
+    /**
+     * Adds the road to or removes it from the active roads, depending on whether it carries vehicles. Called whenever
+     * a vehicle enters or leaves a road, so a road with a vehicle generator only becomes active on the tick a spawn
+     * is due. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(isRoadActive(roadId) == !getVehiclesOnRoads().at(roadId).empty(), "road is active when it is occupied");
+     * @param roadId id of the road that changed
+     */
+    void updateRoadActivity(const id roadId);
+
+    /**
+     * Chooses the amount of substeps of every active road for the coming tick. A road gets the least substeps for
+     * which the estimated error of a vehicle update stays within the tolerance, given the largest acceleration and
+     * jerk seen on the road during the previous tick. A road that a vehicle entered or left gets the most substeps for one tick. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(result >= 1 && result <= maxSubsteps, "amount of passes is valid");
+     * @return the largest amount of substeps of all roads, the amount of passes needed for this tick
+     */
+    unsigned int planSubsteps();
+
     /// Returns the vehicleId of the vehicle in front of the given vehicle. If
     /// there is none the given vehicleId is returned.
     id getVehicleInFront(const id vehicleId) const;
 
-    /// Returns the lightId of the light in front of the given vehicle. If there is
-    /// none the given vehicleId is returned.
-    id getLightInFront(const id vehicleId) const;
+    /**
+     * Sorts the lights, bus stops and crossroads of every road into its RoadFeatures, called once after parsing \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(roadFeatures.size() == getRoads().size(), "every road has its features");
+     */
+    void buildRoadFeatures();
 
-    /// Returns the busStopId of the busStop in front of the given vehicle. If there is none the given vehicleId is
-    /// returned.
-    id getBusStopInFront(const id vehicleId) const;
+    /**
+     * Lays out the roads and the lights of the snapshot, called once after buildRoadFeatures \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(snapshot.roadIds.size() == getRoads().size(), "every road has a slot in the snapshot");
+     */
+    void buildSnapshotLayout();
+
+    /**
+     * Lays out the snapshot the first time, or lays out the roads vehicles entered or left since, so the views show
+     * the current state \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(snapshot.inSync && snapshot.version == stateVersion, "snapshot is up to date");
+     */
+    void refreshSnapshot() const;
+
+    /**
+     * Copies the vehicles of every road into the snapshot, with room for more vehicles on every road, and the colors
+     * of the lights \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(snapshot.inSync && snapshot.changedRoads.empty(), "snapshot is laid out");
+     */
+    void layoutSnapshot() const;
+
+    /**
+     * Copies the vehicles of one road into its part of the snapshot, sorted by position \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param slot index of the road in the snapshot
+     * @return false if the vehicles do not fit in the room of the road, nothing is copied then
+     */
+    bool layoutSnapshotRoad(std::size_t slot) const;
+
+    /**
+     * Lays out the roads vehicles entered or left since the snapshot was laid out, or the whole snapshot when one
+     * of them outgrew its room \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(snapshot.inSync, "snapshot is laid out"); \n
+     * ENSURE(snapshot.changedRoads.empty(), "every road is laid out");
+     */
+    void syncSnapshot() const;
+
+    /**
+     * Remembers that a vehicle entered or left the road, so its part of the snapshot is laid out again \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param roadId id of the road
+     */
+    void markSnapshotRoad(const id roadId);
 
     /// Converts the type of vehicle from a string to an enum
     EVehicleEntityTypes vehicleTypeStringToEnumVariant(const std::string &str) const;
@@ -185,6 +601,138 @@ class Simulation {
      */
     void godTick();
 
+    /**
+     * Reseeds the random generator that decides the direction vehicles take at crossroads. Two simulations with the
+     * same input and seed produce the same output. (By default the generator is seeded from std::random_device.) \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param seed seed for the random generator
+     */
+    void setSeed(unsigned int seed);
+
+    /**
+     * Sets the amount of threads used to update the vehicles. The worker threads are started here and wait between
+     * the phases of the ticks. Every vehicle is updated from the state of the previous tick, so the result is the same
+     * for every thread count. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(threads > 0, "at least one thread"); \n
+     * ENSURE(getThreadCount() == threads, "thread count is set");
+     * @param threads amount of threads (1 ticks on the calling thread only)
+     */
+    void setThreadCount(unsigned int threads);
+
+    /**
+     * Enables or disables sleeping vehicles (enabled by default). A vehicle whose update changed nothing is not
+     * updated again until the vehicle in front moves, the light in front changes or a vehicle enters or leaves its
+     * road. This gives exactly the same result as updating every vehicle every tick. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param enabled true to let settled vehicles sleep
+     */
+    void setSleeping(bool enabled);
+
+    /**
+     * Returns the amount of vehicles that were asleep during the last tick \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return amount of sleeping vehicles
+     */
+    unsigned int getSleepingVehicles() const;
+
+    /**
+     * Enables or disables free flowing vehicles (enabled by default). A vehicle with no vehicle in front and no light
+     * within 50 meters (the distance at which a light starts to influence it) has known inputs, so it does not scan
+     * its road for obstacles until it gets closer, passes a crossroad or a vehicle enters its road. Once its state no
+     * longer changes its update adds its last displacement instead of running the car following model. \n
+     * Such a vehicle that is alone on its road coasts: it leaves the per-tick steps until just before the next light
+     * within reach, crossroad or the end of its road, or until a vehicle enters its road. Its position is computed in
+     * closed form when the world or a view is read, and when it is stepped again (its velocity does not change). \n
+     * Both give exactly the same result as updating every vehicle with a full lookup every tick. Busses always look
+     * around, because of their bus stops. Vehicles do not coast while stepping adaptively. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param enabled true to let vehicles on a free road take the cheaper lookups and updates, and coast
+     */
+    void setFreeFlow(bool enabled);
+
+    /**
+     * Returns the amount of vehicles that drove on a free road during the last tick (coasting or not) \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return amount of free flowing vehicles
+     */
+    unsigned int getFreeFlowingVehicles() const;
+
+    /**
+     * Returns the amount of vehicles that coasted during the last tick (not gathered, updated or committed) \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return amount of coasting vehicles
+     */
+    unsigned int getCoastingVehicles() const;
+
+    /**
+     * Enables adaptive multi-rate stepping (disabled by default). A tick stays the coarse step: lights, generators,
+     * crossroads and despawning still happen once per tick, so roads only exchange vehicles at tick boundaries. Within
+     * a tick the vehicles on a busy road are updated up to maxSubsteps times with a finer step, chosen per road so the
+     * estimated position error of an update stays within the tolerance. Roads in free flow keep the coarse step.
+     * With maxSubsteps 1 every road uses the tick as its step, like without adaptive stepping. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(substeps > 0 && (substeps & (substeps - 1)) == 0, "substeps is a power of two"); \n
+     * REQUIRE(errorTolerance > 0, "tolerance is positive");
+     * @param substeps most updates of a road per tick, a power of two
+     * @param errorTolerance largest estimated position error (in meters) of a single vehicle update
+     */
+    void setAdaptiveStepping(unsigned int substeps, double errorTolerance);
+
+    /**
+     * Returns the amount of times the vehicles on the road were updated during the last tick \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid");
+     * @param roadId id of the road
+     * @return amount of substeps (1 when adaptive stepping is disabled or the road is idle)
+     */
+    unsigned int getSubsteps(const id roadId) const;
+
+    // ╔════════════════════════════════════════╗
+    // ║            External control            ║
+    // ╚════════════════════════════════════════╝
+
+    /**
+     * Ticks the simulation forward by the given amount of timeSteps, the same as calling godTick() that many times \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(getIteration() == prevIteration + ticks, "The simulation is ticked");
+     * @param ticks amount of ticks
+     */
+    void godTicks(const unsigned int ticks);
+
+    /**
+     * Puts a new vehicle on a microscopic road between two ticks, standing still like the vehicles of a generator \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid"); \n
+     * REQUIRE(position >= 0, "position is positive or zero");
+     * @param roadId id of the road
+     * @param position position of the front of the vehicle on the road
+     * @param type type of the vehicle
+     * @return id of the new vehicle, empty when the road is mesoscopic, the position is beyond the end of the road or
+     * the vehicle does not fit between the vehicles on the road
+     */
+    std::optional<id> injectVehicle(const id roadId, const double position, const EVehicleEntityTypes type);
+
+    /**
+     * Takes a vehicle out of the simulation between two ticks \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * ENSURE(getVehicles().find(vehicleId) == getVehicles().end(), "vehicle is not in the simulation");
+     * @param vehicleId id of the vehicle
+     * @return false if there is no vehicle with the id
+     */
+    bool removeVehicle(const id vehicleId);
+
+    /**
+     * Returns a view of a road, its vehicles and its lights as contiguous spans. The first view copies the vehicles of
+     * all roads into one snapshot, which the ticks then keep up to date, so later views only point into it. A view is
+     * valid until the next tick, injected or removed vehicle. Not safe to call from several threads at once. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid");
+     * @param roadId id of the road
+     * @return view of the road
+     */
+    RoadView getRoadView(const id roadId) const;
+
     // ╔════════════════════════════════════════╗
     // ║          Getters and setters           ║
     // ╚════════════════════════════════════════╝
@@ -231,6 +779,13 @@ class Simulation {
      */
     const std::unordered_map<id, CrossRoadObject> &getCrossRoads() const;
 
+    /**
+     * Returns the point queues of the mesoscopic roads by roadId \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return mesoLinks database
+     */
+    const std::map<id, MesoLinkEntity> &getMesoLinks() const;
+
     /**
      * Returns the roadmap database \n
      * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
@@ -260,11 +815,38 @@ class Simulation {
     const std::unordered_map<id, std::list<id>> &getBusstopsOnRoads() const;
 
     /**
-     * Returns the world database (objectId to roadId + positionOnRoad) \n
+     * Returns the roads that currently carry vehicles, in no particular order. Idle roads can be skipped by everything
+     * that only looks at vehicles. \n
      * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
-     * @return world database (objectId to roadId + positionOnRoad)
+     * @return ids of the active roads
+     */
+    const std::vector<id> &getActiveRoads() const;
+
+    /**
+     * Checks if the road carries vehicles \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid");
+     * @param roadId id of the road
+     * @return true if the road is active
+     */
+    bool isRoadActive(const id roadId) const;
+
+    /**
+     * Returns the world database (objectId to roadId + positionOnRoad). The vehicles and the objects that never move
+     * are stored apart, the view presents them as one database. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return view of the world database (objectId to roadId + positionOnRoad)
+     */
+    WorldView getWorld() const;
+
+    /**
+     * Returns the lights, bus stops and crossroads of a road, sorted by position \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(getRoads().find(roadId) != getRoads().end(), "roadId is valid");
+     * @param roadId id of the road
+     * @return static features of the road
      */
-    const std::unordered_map<id, std::pair<id, double>> &getWorld() const;
+    const RoadFeatures &getRoadFeatures(const id roadId) const;
 
     /**
      * Returns the current iteration the simulation is at \n
@@ -273,6 +855,29 @@ class Simulation {
      */
     const unsigned int &getIteration() const;
 
+    /**
+     * Returns the in-simulation time between two ticks \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return stepSize of the simulation
+     */
+    const double &getStepSize() const;
+
+    /**
+     * Returns the amount of threads used to update the vehicles \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return thread count
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * Returns the timers and counters of the phases of godTick and of the Logger modes. They start at the first tick,
+     * the loggers add to them through a const simulation. Without profiling built in (SIM_NO_PROFILING) they stay
+     * zero. \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return the profiler of the simulation
+     */
+    Profiler &getProfiler() const;
+
     // ╔════════════════════════════════════════╗
     // ║               Contracts                ║
     // ╚════════════════════════════════════════╝
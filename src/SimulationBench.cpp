@@ -0,0 +1,70 @@
+//============================================================================
+// Name        : SimulationBench.cpp
+// Description : TrafficSimulation benchmark suite entry
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/27
+// Version     : 1.0
+//============================================================================
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include "bench/Bench.h"
+
+// ╔════════════════════════════════════════╗
+// ║           Memory accounting            ║
+// ╚════════════════════════════════════════╝
+
+// every block starts with a header that remembers its size, so operator delete can subtract it again
+static const std::size_t kHeaderSize = alignof(std::max_align_t);
+
+static std::atomic<std::size_t> liveByteCount{0};
+
+std::size_t Bench::liveBytes() { return liveByteCount.load(); }
+
+void *operator new(std::size_t size) {
+    void *block = std::malloc(size + kHeaderSize);
+    if (!block) throw std::bad_alloc();
+    *static_cast<std::size_t *>(block) = size;
+    liveByteCount += size;
+    return static_cast<char *>(block) + kHeaderSize;
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void *ptr) noexcept {
+    if (!ptr) return;
+    void *block = static_cast<char *>(ptr) - kHeaderSize;
+    liveByteCount -= *static_cast<std::size_t *>(block);
+    std::free(block);
+}
+
+void operator delete[](void *ptr) noexcept { operator delete(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+void operator delete[](void *ptr, std::size_t) noexcept { operator delete(ptr); }
+
+int main(int argc, char **argv) {
+    // only run the benchmarks whose name contains the filter
+    const std::string filter = argc > 1 ? argv[1] : "";
+
+    Bench::Reporter reporter(std::cout);
+    unsigned int ran = 0;
+    for (const std::pair<std::string, Bench::Function> &benchmark : Bench::registry()) {
+        if (benchmark.first.find(filter) == std::string::npos) continue;
+        benchmark.second(reporter);
+        std::cout.flush();
+        ++ran;
+    }
+
+    if (ran == 0) {
+        std::cerr << "[sim_bench] No benchmark matches '" << filter << "'.\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+//============================================================================
+// Name        : SimulationClient.cpp
+// Description : Reference client of the frame stream, writes the json frames of the visualizer
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "./lib/stream/DeltaDecoder.h"
+#include "./lib/stream/RecordingReader.h"
+#include "./lib/stream/StreamClient.h"
+#include "./lib/utils/Utils.h"
+
+/**
+ * Reads the messages of a sim that runs with --serve, or of a file written with --format delta, and writes one json
+ * frame per frame to stdout, the same frames sim writes with --format json. With --seek it starts at the last frame at
+ * or before the tick, through the keyframe index of the file. Stops at the end of the stream or after the given amount
+ * of frames.
+ */
+int main(int argc, char **argv) {
+    const std::string usage = std::string("Usage: ") + argv[0] + " unix:PATH|tcp:PORT [frames]\n" + "       " +
+                              argv[0] + " --decode FILE|- [frames]\n" + "       " + argv[0] +
+                              " --seek FILE TICK [frames]\n";
+
+    const bool decode = argc > 1 && std::string(argv[1]) == "--decode";
+    const bool seek = argc > 1 && std::string(argv[1]) == "--seek";
+    const int firstArgument = decode ? 2 : seek ? 3 : 1;
+    if (argc != firstArgument + 1 && argc != firstArgument + 2) {
+        std::cerr << usage;
+        return 1;
+    }
+
+    int frames = -1;
+    if (argc == firstArgument + 2 && (!Utils::parseInt(argv[firstArgument + 1], frames) || frames < 0)) {
+        std::cerr << "[sim_client] Amount of frames is not a positive integer: '" << argv[firstArgument + 1] << "'.\n";
+        return 1;
+    }
+
+    int tick = 0;
+    if (seek && (!Utils::parseInt(argv[3], tick) || tick < 0)) {
+        std::cerr << "[sim_client] Tick is not a positive integer: '" << argv[3] << "'.\n";
+        return 1;
+    }
+
+    try {
+        if (seek) {
+            // a finished recording, only the frames from the tick on are read
+            RecordingReader reader(argv[2]);
+            if (!reader.seek(static_cast<unsigned int>(tick))) {
+                std::cerr << "[sim_client] The recording starts at tick " << reader.getFirstTick() << ".\n";
+                return 1;
+            }
+            for (bool more = true; frames != 0 && more; more = reader.next()) {
+                std::cout << reader.getDecoder().frame().dump() << "\n";
+                if (frames > 0) --frames;
+            }
+            return 0;
+        }
+
+        DeltaDecoder decoder;
+        std::string line;
+        if (decode) {
+            // a recorded run, from a file or from stdin
+            const std::string path = argv[firstArgument];
+            std::ifstream file;
+            if (path != "-") {
+                file.open(path);
+                if (!file) {
+                    std::cerr << "[sim_client] Cannot open file: '" << path << "'.\n";
+                    return 1;
+                }
+            }
+            std::istream &input = path == "-" ? std::cin : file;
+            while (frames != 0 && std::getline(input, line)) {
+                if (!decoder.apply(line)) continue;
+                std::cout << decoder.frame().dump() << "\n";
+                if (frames > 0) --frames;
+            }
+            return 0;
+        }
+
+        StreamClient client(argv[firstArgument]);
+        while (frames != 0 && client.readLine(line)) {
+            if (!decoder.apply(line)) continue;
+            std::cout << decoder.frame().dump() << "\n";
+            if (frames > 0) --frames;
+        }
+    } catch (const std::runtime_error &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -11,8 +11,11 @@
 #include "lib/pugixml/pugixml.hpp"
 
 // local libraries
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <thread>
 
 #include "Simulation.h"
 #include "lib/xml-validator/Validator.h"
@@ -21,20 +24,211 @@
 #include <map>
 #include <string>
 
+#include "./lib/cli/CommandLine.h"
 #include "./lib/logger/Logger.h"
+#include "./lib/logger/OutputSink.h"
 #include "./lib/path/path.h"
+#include "./lib/profiler/Tracer.h"
+#include "./lib/realtime/Pacer.h"
+#include "./lib/stream/RecordingWriter.h"
+#include "./lib/stream/StreamServer.h"
 
 // TODO: Edit all classes to account for contract publicity
 
+/// Writes one frame of the simulation in the requested format, if the policy accepts it (the delta format needs the
+/// recording of the run)
+static void logFrame(const Simulation &sim, EOutputFormat format, OutputSink &sink, LogPolicy &policy,
+                     RecordingWriter *recording) {
+    switch (format) {
+        case EOutputFormat::kJson:
+            Logger::logAsJson(sim, sink, policy);
+            break;
+        case EOutputFormat::kSimple:
+            Logger::logSimpleOutput(sim, sink, policy);
+            break;
+        case EOutputFormat::kAdvanced:
+            Logger::logAdvancedOutput(sim, sink, policy);
+            break;
+        case EOutputFormat::kBinary:
+            Logger::logAsBinary(sim, sink, policy);
+            break;
+        case EOutputFormat::kDelta:
+            Logger::logAsDelta(sim, sink, *recording, policy);
+            break;
+        case EOutputFormat::kNone:
+            break;
+    }
+}
+
 int main(int argc, char **argv) {
-    std::ifstream file(path::resFolderPath + "xml/input4.xml");
-    Simulation sim(file, 1.0 / 60.0, std::cerr);
+    RunOptions options;
+    try {
+        options = CommandLine::parse(argc, argv);
+    } catch (const std::runtime_error &e) {
+        std::cerr << e.what() << "\n\n" << CommandLine::usage(argv[0]);
+        return 1;
+    }
+
+    if (options.help) {
+        std::cout << CommandLine::usage(argv[0]);
+        return 0;
+    }
+
+    std::ifstream file(options.scenarioPath);
+    if (!file) {
+        std::cerr << "[sim] Cannot open scenario: '" << options.scenarioPath << "'.\n";
+        return 1;
+    }
+
+    // open the output before loading so a wrong path fails fast
+    std::ofstream outputFile;
+    std::unique_ptr<MappedFileSink> mappedOutput;
+    if (options.mappedOutput) {
+        try {
+            mappedOutput.reset(new MappedFileSink(options.outputPath));
+        } catch (const std::runtime_error &e) {
+            std::cerr << e.what() << "\n";
+            return 1;
+        }
+    } else if (!options.outputPath.empty()) {
+        outputFile.open(options.outputPath, std::ios::binary);
+        if (!outputFile) {
+            std::cerr << "[sim] Cannot open output file: '" << options.outputPath << "'.\n";
+            return 1;
+        }
+    }
+    std::ostream &outStream = options.outputPath.empty() ? std::cout : outputFile;
+    StreamSink streamOutput(outStream);
+    OutputSink &sink = mappedOutput ? static_cast<OutputSink &>(*mappedOutput) : streamOutput;
+
+    std::ofstream profileFile;
+    if (!options.profilePath.empty()) {
+        profileFile.open(options.profilePath);
+        if (!profileFile) {
+            std::cerr << "[sim] Cannot open profile file: '" << options.profilePath << "'.\n";
+            return 1;
+        }
+    }
+
+    // the tracer records from the start, so loading the scenario is in the trace
+    std::ofstream traceFile;
+    std::unique_ptr<Tracer> tracer;
+    if (!options.tracePath.empty()) {
+        traceFile.open(options.tracePath);
+        if (!traceFile) {
+            std::cerr << "[sim] Cannot open trace file: '" << options.tracePath << "'.\n";
+            return 1;
+        }
+        tracer.reset(new Tracer(options.traceSpans));
+        Tracer::setActive(tracer.get());
+    }
+
+    std::ofstream latencyFile;
+    if (!options.latencyPath.empty()) {
+        latencyFile.open(options.latencyPath);
+        if (!latencyFile) {
+            std::cerr << "[sim] Cannot open latency file: '" << options.latencyPath << "'.\n";
+            return 1;
+        }
+    }
+
+    // clients can connect from before the scenario is loaded, they get their first frame at the first tick
+    std::unique_ptr<StreamServer> server;
+    if (!options.serveAddress.empty()) {
+        try {
+            server.reset(new StreamServer(options.serveAddress, options.serveBuffer, options.deltaResolution));
+        } catch (const std::runtime_error &e) {
+            std::cerr << e.what() << "\n";
+            return 1;
+        }
+    }
+
+    LogPolicy policy;
+    policy.everyTicks(options.outputEvery)
+      .everySeconds(options.outputEverySeconds)
+      .window(options.windowStart, options.windowEnd);
+    if (options.queueTrigger > 0) policy.onEvent(LogPolicy::queueForms(options.queueTrigger), options.triggerHold);
+
+    try {
+        Simulation sim(file, options.stepSize, std::cerr);
+        if (options.seed) sim.setSeed(*options.seed);
+        sim.setThreadCount(options.threads);
+        if (options.substeps > 1) sim.setAdaptiveStepping(options.substeps, options.tolerance);
+
+        std::unique_ptr<RecordingWriter> recording;
+        if (options.format == EOutputFormat::kDelta)
+            recording.reset(new RecordingWriter(sim, options.deltaResolution, options.keyframeEvery));
+
+        unsigned long long vehicleUpdates = 0;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        // in real time every tick waits for its slot, a frame is written as soon as it is ready
+        std::unique_ptr<Pacer> pacer;
+        if (options.realtime > 0) {
+            pacer.reset(new Pacer(options.stepSize, options.realtime));
+            pacer->start(std::chrono::steady_clock::now());
+        }
+
+        for (unsigned int i = 0; i < options.ticks; ++i) {
+            if (!pacer) {
+                logFrame(sim, options.format, sink, policy, recording.get());
+                if (server) server->publish(sim);
+                vehicleUpdates += sim.getVehicles().size();
+                sim.godTick();
+                continue;
+            }
+
+            std::this_thread::sleep_until(pacer->nextSlot());
+            const std::chrono::steady_clock::time_point tickStart = std::chrono::steady_clock::now();
+            if (pacer->shouldOutput()) {
+                logFrame(sim, options.format, sink, policy, recording.get());
+                sink.flush();
+            }
+            if (server) server->publish(sim);
+            vehicleUpdates += sim.getVehicles().size();
+            sim.godTick();
+            pacer->tickDone(tickStart, std::chrono::steady_clock::now());
+        }
+        logFrame(sim, options.format, sink, policy, recording.get());
+        if (recording) recording->finish(sink);
+        sink.flush();
+        if (mappedOutput) mappedOutput->close();
+        if (server) {
+            server->publish(sim);
+            server->flush(std::chrono::seconds(1));
+        }
+
+        const double seconds =
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cerr << "[sim] " << options.ticks << " ticks (" << options.ticks * options.stepSize
+                  << " s simulated) in " << seconds << " s wall: " << options.ticks / seconds << " ticks/s, "
+                  << vehicleUpdates / seconds << " vehicle-updates/s\n";
+
+        if (pacer) {
+            typedef std::chrono::duration<double, std::milli> Ms;
+            std::cerr << "[sim] real time x" << options.realtime << ": " << pacer->getMissed() << " of "
+                      << pacer->getTicks() << " deadlines missed, p99 latency below "
+                      << Ms(pacer->latencyPercentile(0.99)).count() << " ms (budget " << Ms(pacer->getPeriod()).count()
+                      << " ms), output every " << pacer->getOutputStride() << " ticks\n";
+        }
+        if (server) {
+            std::cerr << "[sim] stream at " << options.serveAddress << ": " << server->getClientCount()
+                      << " clients at the end, " << server->getKeyframes() << " keyframes sent, "
+                      << server->getDropped() << " frames dropped for slow clients\n";
+        }
+        if (latencyFile.is_open() && pacer) pacer->writeJson(latencyFile);
+
+        if (profileFile.is_open()) sim.getProfiler().writeJson(profileFile);
+        if (tracer) {
+            Tracer::setActive(nullptr);
+            tracer->writeJson(traceFile);
+        }
 
-    for (unsigned int i = 0; i < 30000; ++i) {
-        Logger::logAsJson(sim, std::cout);
-        sim.godTick();
+    } catch (const std::runtime_error &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
     }
-    Logger::logAsJson(sim, std::cout);
 
     return 0;
 }
@@ -0,0 +1,78 @@
+//============================================================================
+// Name        : SimulationSweep.cpp
+// Description : Runs a sweep over the parameters of a scenario, the scenario is loaded once for all runs
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "./lib/sweep/SweepRunner.h"
+#include "./lib/sweep/SweepSpec.h"
+#include "./lib/xml-validator/Validator.h"
+#include "./objects/entities/vehicle/VehicleEntity.h"
+
+/**
+ * Reads the sweep specification, validates its scenario once and runs every combination of the parameters in forked
+ * workers. Writes one csv line per run to the output of the spec (or the file given after the spec, or stdout) and
+ * a summary to stderr. Exits with 1 when a run did not succeed.
+ */
+int main(int argc, char **argv) {
+    if (argc != 2 && argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " SWEEP.ini [results.csv]\n";
+        return 1;
+    }
+
+    try {
+        SweepSpec spec = SweepSpec::read(argv[1]);
+        if (argc == 3) spec.outputPath = argv[2];
+
+        std::ifstream file(spec.scenarioPath);
+        if (!file) {
+            std::cerr << "[sim_sweep] Cannot open scenario: '" << spec.scenarioPath << "'.\n";
+            return 1;
+        }
+        std::ofstream outputFile;
+        if (!spec.outputPath.empty()) {
+            outputFile.open(spec.outputPath);
+            if (!outputFile) {
+                std::cerr << "[sim_sweep] Cannot open output file: '" << spec.outputPath << "'.\n";
+                return 1;
+            }
+        }
+        std::ostream &outStream = spec.outputPath.empty() ? std::cout : outputFile;
+
+        // loaded before the workers are forked, they all share it
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        Validator::ValMap network = Validator::validate(file, std::cerr);
+        if (network.empty()) {
+            std::cerr << "[sim_sweep] Scenario is not valid: '" << spec.scenarioPath << "'.\n";
+            return 1;
+        }
+        // the constants file as well, instead of once in every worker
+        VehicleProfile::of(EVehicleEntityTypes::kCar);
+
+        SweepRunner runner(spec, network, std::cerr);
+        std::cout.flush();
+        std::cerr.flush();
+        const std::vector<RunResult> results = runner.run();
+        SweepRunner::writeTable(spec, results, outStream);
+
+        unsigned int succeeded = 0;
+        for (const RunResult &result : results) {
+            if (result.status == ERunStatus::kOk) ++succeeded;
+        }
+        std::cerr << "[sim_sweep] " << succeeded << " of " << results.size() << " runs succeeded in "
+                  << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << " s.\n";
+        return succeeded == results.size() ? 0 : 1;
+    } catch (const std::runtime_error &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+}
@@ -9,7 +9,37 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "tests/AllocationCounter.h"
+
+// ╔════════════════════════════════════════╗
+// ║          Allocation counting           ║
+// ╚════════════════════════════════════════╝
+
+static std::atomic<std::size_t> allocationCount{0};
+
+std::size_t AllocationCounter::count() { return allocationCount.load(); }
+
+void *operator new(std::size_t size) {
+    ++allocationCount;
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
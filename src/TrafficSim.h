@@ -0,0 +1,41 @@
+//============================================================================
+// Name        : TrafficSim.h
+// Description : Public header of the trafficsim library, the simulation without its executables
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_TRAFFICSIM_H
+#define SE_PROJECT_TRAFFICSIM_H
+
+/**
+ * @file
+ * The trafficsim library holds the simulation, the validator of its xml scenarios and its output formats, so another
+ * program can run a simulation in its own process instead of reading the output of sim. Link against trafficsim
+ * and include this header, the src directory is on the include path of the target. \n
+ * \n
+ * Load a scenario: Simulation(xmlStream, stepSize, errStream), or Validator::validate() once and
+ * Simulation(stepSize, errStream).parse(valMap) for every simulation of the same scenario. \n
+ * Step it: godTick() for one tick, godTicks(n) for n ticks. \n
+ * Read it: getRoadMap() maps the name of a road to its id, getRoadView(roadId) presents the positions, velocities,
+ * types and ids of the vehicles on the road and the colors of its lights as contiguous spans, until the simulation
+ * changes. getLights() and getWorld() hold the rest of the state. \n
+ * Change it between ticks: injectVehicle(roadId, position, type) returns the id of the new vehicle,
+ * removeVehicle(vehicleId) takes it out again. \n
+ * Write it: the Logger modes write frames to an OutputSink or a std::ostream, RecordingWriter writes a seekable
+ * delta recording. \n
+ * \n
+ * Errors in the scenario are exceptions (std::runtime_error), a broken contract (REQUIRE) aborts like sim does.
+ * TrafficSimC.h is the C interface of the same library, with status codes instead.
+ */
+
+#include "Simulation.h"
+#include "lib/logger/Logger.h"
+#include "lib/logger/OutputSink.h"
+#include "lib/stream/RecordingWriter.h"
+#include "lib/xml-validator/Validator.h"
+#include "objects/road/RoadView.h"
+
+#endif  // SE_PROJECT_TRAFFICSIM_H
@@ -0,0 +1,223 @@
+//============================================================================
+// Name        : TrafficSimC.h
+// Description : C interface of the trafficsim library, to drive the simulation from other languages
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_TRAFFICSIMC_H
+#define SE_PROJECT_TRAFFICSIMC_H
+
+/**
+ * @file
+ * Plain C interface of the trafficsim library, for programs that cannot use its C++ classes (Python through ctypes or
+ * cffi, Julia through ccall, ...). A simulation is an opaque handle, created from a scenario and destroyed with
+ * ts_destroy(). \n
+ * \n
+ * No call throws or aborts: every call returns a TsStatus, ts_last_error() describes the last call of the thread that
+ * did not return TS_OK. Results are written to the pointers given by the caller. \n
+ * \n
+ * The export calls copy the state straight into arrays of the caller, one array per attribute. Any of these arrays
+ * may be NULL to skip that attribute. When the arrays are too small (capacity elements) nothing is copied,
+ * TS_BUFFER_TOO_SMALL is returned and the required capacity is written to count. \n
+ * \n
+ * A handle may be used by one thread at a time, different handles are independent.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// A simulation, only used through a pointer
+typedef struct TsSimulation TsSimulation;
+
+/// Result of a call
+typedef enum TsStatus {
+    TS_OK = 0,
+    TS_INVALID_ARGUMENT = 1,  // a NULL handle or result pointer, or a value out of its range
+    TS_INVALID_SCENARIO = 2,  // the scenario is not valid, ts_last_error() holds the output of the validator
+    TS_IO_ERROR = 3,          // the scenario file could not be opened
+    TS_NOT_FOUND = 4,         // there is no road or vehicle with the id or name
+    TS_BUFFER_TOO_SMALL = 5,  // the arrays of the caller are too small, count holds the required capacity
+    TS_REFUSED = 6,           // the simulation refused the change (the vehicle does not fit on the road)
+    TS_INTERNAL_ERROR = 7     // the simulation failed, ts_last_error() holds the reason
+} TsStatus;
+
+/// Type of a vehicle, the values of EVehicleEntityTypes
+typedef enum TsVehicleType {
+    TS_CAR = 0,
+    TS_BUS = 1,
+    TS_FIRE_TRUCK = 2,
+    TS_AMBULANCE = 3,
+    TS_POLICE_CRUISER = 4
+} TsVehicleType;
+
+/**
+ * Creates a simulation from a scenario in memory
+ * @param xml the scenario (xml), does not need to end with a null character
+ * @param size size of the scenario in bytes
+ * @param stepSize simulated seconds per tick, larger than zero
+ * @param simulation receives the handle of the simulation, NULL when the call fails
+ * @return TS_OK, TS_INVALID_ARGUMENT or TS_INVALID_SCENARIO
+ */
+TsStatus ts_create_from_buffer(const char *xml, size_t size, double stepSize, TsSimulation **simulation);
+
+/**
+ * Creates a simulation from a scenario file
+ * @param path path of the scenario (xml)
+ * @param stepSize simulated seconds per tick, larger than zero
+ * @param simulation receives the handle of the simulation, NULL when the call fails
+ * @return TS_OK, TS_INVALID_ARGUMENT, TS_IO_ERROR or TS_INVALID_SCENARIO
+ */
+TsStatus ts_create_from_path(const char *path, double stepSize, TsSimulation **simulation);
+
+/**
+ * Destroys a simulation, its handle can no longer be used
+ * @param simulation handle of the simulation, NULL is ignored
+ */
+void ts_destroy(TsSimulation *simulation);
+
+/// @return message of the last call of this thread that did not return TS_OK, empty if there is none
+const char *ts_last_error(void);
+
+/// @return name of the status ("TS_OK", ...)
+const char *ts_status_name(TsStatus status);
+
+/**
+ * Seeds the random choices of the simulation (turns at crossroads), a new simulation has a random seed
+ * @param simulation handle of the simulation
+ * @param seed the seed
+ * @return TS_OK or TS_INVALID_ARGUMENT
+ */
+TsStatus ts_set_seed(TsSimulation *simulation, uint32_t seed);
+
+/**
+ * Sets the amount of threads that update the vehicles, the result does not depend on it
+ * @param simulation handle of the simulation
+ * @param threads amount of threads, at least one
+ * @return TS_OK or TS_INVALID_ARGUMENT
+ */
+TsStatus ts_set_threads(TsSimulation *simulation, uint32_t threads);
+
+/**
+ * Ticks the simulation forward
+ * @param simulation handle of the simulation
+ * @param ticks amount of ticks
+ * @return TS_OK, TS_INVALID_ARGUMENT or TS_INTERNAL_ERROR (the ticks before the failing one are done)
+ */
+TsStatus ts_tick(TsSimulation *simulation, uint32_t ticks);
+
+/**
+ * Returns how far the simulation is
+ * @param simulation handle of the simulation
+ * @param iteration receives the amount of ticks done, may be NULL
+ * @param seconds receives the simulated time in seconds, may be NULL
+ * @return TS_OK or TS_INVALID_ARGUMENT
+ */
+TsStatus ts_get_time(const TsSimulation *simulation, uint32_t *iteration, double *seconds);
+
+/**
+ * Looks up the id of a road
+ * @param simulation handle of the simulation
+ * @param name name of the road, as in the scenario
+ * @param roadId receives the id of the road
+ * @return TS_OK, TS_INVALID_ARGUMENT or TS_NOT_FOUND
+ */
+TsStatus ts_find_road(const TsSimulation *simulation, const char *name, uint32_t *roadId);
+
+/**
+ * Copies the roads of the simulation, sorted by id
+ * @param simulation handle of the simulation
+ * @param capacity amount of elements every array can hold
+ * @param roadIds receives the ids of the roads, may be NULL
+ * @param lengths receives the lengths of the roads in meters, may be NULL
+ * @param count receives the amount of roads
+ * @return TS_OK, TS_INVALID_ARGUMENT or TS_BUFFER_TOO_SMALL
+ */
+TsStatus ts_export_roads(const TsSimulation *simulation, size_t capacity, uint32_t *roadIds, double *lengths,
+                         size_t *count);
+
+/**
+ * Copies the vehicles of the whole simulation, grouped by road (sorted by road id) and sorted by position on a road
+ * @param simulation handle of the simulation
+ * @param capacity amount of elements every array can hold, ts_get_vehicle_count() is enough
+ * @param vehicleIds receives the ids of the vehicles, may be NULL
+ * @param roadIds receives the ids of the roads the vehicles are on, may be NULL
+ * @param positions receives the positions of the fronts of the vehicles, may be NULL
+ * @param velocities receives the velocities of the vehicles in m/s, may be NULL
+ * @param types receives the types of the vehicles (TsVehicleType), may be NULL
+ * @param count receives the amount of vehicles
+ * @return TS_OK, TS_INVALID_ARGUMENT or TS_BUFFER_TOO_SMALL
+ */
+TsStatus ts_export_vehicles(const TsSimulation *simulation, size_t capacity, uint32_t *vehicleIds, uint32_t *roadIds,
+                            double *positions, double *velocities, int32_t *types, size_t *count);
+
+/**
+ * Returns the amount of vehicles in the simulation (vehicles on mesoscopic roads are not counted)
+ * @param simulation handle of the simulation
+ * @param count receives the amount of vehicles
+ * @return TS_OK or TS_INVALID_ARGUMENT
+ */
+TsStatus ts_get_vehicle_count(const TsSimulation *simulation, size_t *count);
+
+/**
+ * Copies the vehicles on a road, sorted by position
+ * @param simulation handle of the simulation
+ * @param roadId id of the road
+ * @param capacity amount of elements every array can hold
+ * @param vehicleIds receives the ids of the vehicles, may be NULL
+ * @param positions receives the positions of the fronts of the vehicles, may be NULL
+ * @param velocities receives the velocities of the vehicles in m/s, may be NULL
+ * @param types receives the types of the vehicles (TsVehicleType), may be NULL
+ * @param count receives the amount of vehicles on the road
+ * @return TS_OK, TS_INVALID_ARGUMENT, TS_NOT_FOUND or TS_BUFFER_TOO_SMALL
+ */
+TsStatus ts_export_road_vehicles(const TsSimulation *simulation, uint32_t roadId, size_t capacity,
+                                 uint32_t *vehicleIds, double *positions, double *velocities, int32_t *types,
+                                 size_t *count);
+
+/**
+ * Copies the lights on a road, sorted by position
+ * @param simulation handle of the simulation
+ * @param roadId id of the road
+ * @param capacity amount of elements every array can hold
+ * @param lightIds receives the ids of the lights, may be NULL
+ * @param positions receives the positions of the lights, may be NULL
+ * @param green receives 1 for every light that is green, 0 if it is red, may be NULL
+ * @param count receives the amount of lights on the road
+ * @return TS_OK, TS_INVALID_ARGUMENT, TS_NOT_FOUND or TS_BUFFER_TOO_SMALL
+ */
+TsStatus ts_export_road_lights(const TsSimulation *simulation, uint32_t roadId, size_t capacity, uint32_t *lightIds,
+                               double *positions, uint8_t *green, size_t *count);
+
+/**
+ * Puts a new vehicle on a microscopic road, standing still
+ * @param simulation handle of the simulation
+ * @param roadId id of the road
+ * @param position position of the front of the vehicle, zero or more
+ * @param type type of the vehicle (TsVehicleType)
+ * @param vehicleId receives the id of the new vehicle, may be NULL
+ * @return TS_OK, TS_INVALID_ARGUMENT, TS_NOT_FOUND or TS_REFUSED (mesoscopic road, beyond the end of the road or
+ * no room between the vehicles on it)
+ */
+TsStatus ts_inject_vehicle(TsSimulation *simulation, uint32_t roadId, double position, int32_t type,
+                           uint32_t *vehicleId);
+
+/**
+ * Takes a vehicle out of the simulation
+ * @param simulation handle of the simulation
+ * @param vehicleId id of the vehicle
+ * @return TS_OK, TS_INVALID_ARGUMENT or TS_NOT_FOUND
+ */
+TsStatus ts_remove_vehicle(TsSimulation *simulation, uint32_t vehicleId);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // SE_PROJECT_TRAFFICSIMC_H
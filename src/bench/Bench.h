@@ -0,0 +1,127 @@
+//============================================================================
+// Name        : Bench.h
+// Description : Minimal benchmark registry and timing helpers of the benchmark suite
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/27
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_BENCH_H
+#define SE_PROJECT_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Note: benchmarks register themselves with SIM_BENCHMARK(name), the entry (SimulationBench.cpp) runs the ones whose
+// name contains the filter given on the command line
+
+namespace Bench {
+    /// Writes the results of the benchmarks, one measurement per line
+    class Reporter {
+        std::ostream &out;
+
+      public:
+        explicit Reporter(std::ostream &out) : out(out) {}
+
+        /**
+         * Writes a measurement
+         * @param benchmark name of the benchmark
+         * @param metric what was measured
+         * @param value measured value
+         * @param unit unit of the value
+         */
+        void report(const std::string &benchmark, const std::string &metric, double value, const std::string &unit) {
+            out << std::left << std::setw(24) << benchmark << std::setw(36) << metric << std::right << std::setw(14)
+                << std::setprecision(6) << value << ' ' << unit << '\n';
+        }
+    };
+
+    using Function = void (*)(Reporter &);
+
+    /**
+     * Returns the amount of heap memory in use, counted by the operator new of the benchmark binary (replaced in
+     * SimulationBench.cpp)
+     * @return bytes allocated through operator new and not yet deleted
+     */
+    std::size_t liveBytes();
+
+    /// @return all registered benchmarks by name, in registration order
+    inline std::vector<std::pair<std::string, Function>> &registry() {
+        static std::vector<std::pair<std::string, Function>> benchmarks;
+        return benchmarks;
+    }
+
+    /// Registers a benchmark when it is constructed (used by SIM_BENCHMARK)
+    struct Registrar {
+        Registrar(const char *name, Function function) { registry().emplace_back(name, function); }
+    };
+
+    /**
+     * Runs the function a few times and keeps the fastest run, which is the least disturbed by the rest of the system
+     * @param repetitions amount of runs
+     * @param function function to time
+     * @return wall time of the fastest run in seconds
+     */
+    template <typename Function>
+    double bestOf(unsigned int repetitions, const Function &function) {
+        double best = std::numeric_limits<double>::infinity();
+        for (unsigned int i = 0; i < repetitions; ++i) {
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    }
+
+    /**
+     * Builds a scenario of independent roads, each with a light in the middle and a bus stop near the end. The
+     * vehicles are spread evenly over the first half of the roads (at least 25 meters apart for 20 vehicles on a road of
+     * 1000 meters) with a repeating mix of types (mostly cars, some busses and some
+     * priority vehicles), so the types are interleaved in id order.
+     * @param roads amount of roads
+     * @param vehiclesPerRoad amount of vehicles on every road
+     * @param length length of every road
+     * @return the scenario as XML
+     */
+    inline std::string scenario(unsigned int roads, unsigned int vehiclesPerRoad, double length) {
+        static const char *const kTypes[] = {"auto", "auto", "bus", "auto", "ziekenwagen",
+                                             "auto", "auto", "auto", "politiecombi", "brandweerwagen"};
+
+        std::ostringstream xml;
+        xml << "<ROOT>\n";
+        for (unsigned int road = 0; road < roads; ++road) {
+            xml << "<BAAN><naam>r" << road << "</naam><lengte>" << length << "</lengte></BAAN>\n";
+            xml << "<VERKEERSLICHT><baan>r" << road << "</baan><positie>" << length / 2 << "</positie><cyclus>"
+                << 20 + road % 7 << "</cyclus></VERKEERSLICHT>\n";
+            xml << "<BUSHALTE><baan>r" << road << "</baan><positie>" << length * 0.9
+                << "</positie><wachttijd>5</wachttijd></BUSHALTE>\n";
+        }
+        // vehicles last, so they get consecutive ids after the other objects
+        const double spacing = length / 2 / vehiclesPerRoad;
+        for (unsigned int i = 0; i < vehiclesPerRoad; ++i) {
+            for (unsigned int road = 0; road < roads; ++road) {
+                xml << "<VOERTUIG><baan>r" << road << "</baan><positie>" << i * spacing << "</positie><type>"
+                    << kTypes[(i * roads + road) % 10] << "</type></VOERTUIG>\n";
+            }
+        }
+        xml << "</ROOT>\n";
+        return xml.str();
+    }
+}  // namespace Bench
+
+/// Defines and registers a benchmark, the body gets a Bench::Reporter &reporter to write its results to
+#define SIM_BENCHMARK(name)                                                   \
+    static void bench_##name(Bench::Reporter &reporter);                      \
+    static const Bench::Registrar registrar_##name(#name, bench_##name); \
+    static void bench_##name(Bench::Reporter &reporter)
+
+#endif  // SE_PROJECT_BENCH_H
@@ -0,0 +1,41 @@
+//============================================================================
+// Name        : MemoryBench.cpp
+// Description : Benchmark of the memory used per vehicle
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/27
+// Version     : 1.0
+//============================================================================
+
+#include <memory>
+#include <sstream>
+
+#include "../Simulation.h"
+#include "Bench.h"
+
+namespace {
+    const unsigned int kRoads = 200;
+    const unsigned int kVehiclesPerRoad = 20;
+
+    /// heap memory of a loaded simulation after its first tick (which sizes the buffers of a tick)
+    std::size_t simulationBytes(unsigned int vehiclesPerRoad) {
+        std::istringstream xml(Bench::scenario(kRoads, vehiclesPerRoad, 1000));
+        std::ostream dummyStream(nullptr);
+
+        const std::size_t before = Bench::liveBytes();
+        std::unique_ptr<Simulation> sim(new Simulation(xml, 1.0 / 60.0, dummyStream));
+        sim->godTick();
+        return Bench::liveBytes() - before;
+    }
+}  // namespace
+
+SIM_BENCHMARK(VehicleMemory) {
+    // the same network with and without vehicles, the difference is what the vehicles use
+    const std::size_t emptyBytes = simulationBytes(0);
+    const std::size_t fullBytes = simulationBytes(kVehiclesPerRoad);
+    const double vehicles = double(kRoads) * kVehiclesPerRoad;
+
+    reporter.report("VehicleMemory", "sizeof(VehicleEntity)", sizeof(VehicleEntity), "bytes");
+    reporter.report("VehicleMemory", "heap per vehicle (all databases)", double(fullBytes - emptyBytes) / vehicles,
+                    "bytes");
+}
@@ -0,0 +1,176 @@
+//============================================================================
+// Name        : OutputBench.cpp
+// Description : Benchmark of the size and the cost of the output formats
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "../Simulation.h"
+#include "../lib/cli/CommandLine.h"
+#include "../lib/logger/Logger.h"
+#include "../lib/logger/OutputSink.h"
+#include "../lib/stream/DeltaDecoder.h"
+#include "../lib/stream/RecordingReader.h"
+#include "../lib/stream/RecordingWriter.h"
+#include "Bench.h"
+
+namespace {
+    const unsigned int kTicks = 600;
+
+    /// bytes and formatting time of the frames of one format over kTicks ticks
+    struct Volume {
+        std::size_t bytes = 0;
+        double seconds = 0;
+    };
+
+    /// runs the scenario and writes every frame as json or as deltas, only the logger is timed
+    Volume measure(const std::string &scenario, EOutputFormat format) {
+        std::istringstream xml(scenario);
+        std::ostream dummyStream(nullptr);
+        Simulation sim(xml, 1.0 / 60.0, dummyStream);
+        sim.setSeed(1);
+        RecordingWriter recording(sim);
+
+        Volume volume;
+        std::ostringstream frame;
+        for (unsigned int i = 0; i < kTicks; ++i) {
+            frame.str("");
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            if (format == EOutputFormat::kDelta)
+                Logger::logAsDelta(sim, frame, recording);
+            else
+                Logger::logAsJson(sim, frame);
+            volume.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            volume.bytes += frame.tellp();
+            sim.godTick();
+        }
+        return volume;
+    }
+}  // namespace
+
+SIM_BENCHMARK(DeltaOutput) {
+    // every road has a light and a bus stop, the json frames repeat them all, the deltas only the vehicles that moved
+    for (const unsigned int roads : {20u, 200u, 2000u}) {
+        const std::string scenario = Bench::scenario(roads, 5, 1000);
+        const std::string network = std::to_string(roads) + " roads ";
+
+        const Volume json = measure(scenario, EOutputFormat::kJson);
+        const Volume delta = measure(scenario, EOutputFormat::kDelta);
+        reporter.report("DeltaOutput", network + "json", double(json.bytes) / kTicks, "bytes/frame");
+        reporter.report("DeltaOutput", network + "delta", double(delta.bytes) / kTicks, "bytes/frame");
+        reporter.report("DeltaOutput", network + "json/delta", double(json.bytes) / delta.bytes, "x");
+        reporter.report("DeltaOutput", network + "json", json.seconds / kTicks * 1e6, "us/frame");
+        reporter.report("DeltaOutput", network + "delta", delta.seconds / kTicks * 1e6, "us/frame");
+    }
+}
+
+SIM_BENCHMARK(RecordingSeek) {
+    // five minutes of a run at 60 frames per second, a keyframe every 10 seconds
+    const unsigned int ticks = 18000;
+    const std::string path = "/tmp/sim_bench_recording_" + std::to_string(::getpid()) + ".jsonl";
+    {
+        std::istringstream xml(Bench::scenario(20, 5, 1000));
+        std::ostream dummyStream(nullptr);
+        Simulation sim(xml, 1.0 / 60.0, dummyStream);
+        sim.setSeed(1);
+        RecordingWriter recording(sim);
+        std::ofstream file(path, std::ios::binary);
+        for (unsigned int i = 0; i < ticks; ++i) {
+            Logger::logAsDelta(sim, file, recording);
+            sim.godTick();
+        }
+        recording.finish(file);
+        reporter.report("RecordingSeek", "recording", double(file.tellp()) / (1 << 20), "MB");
+    }
+
+    // the frame at 4 minutes: decoding every line before it, or the keyframe before it and the deltas after that
+    const unsigned int target = 14400 + 599;
+    const double linear = Bench::bestOf(3, [&]() {
+        std::ifstream file(path);
+        DeltaDecoder decoder;
+        std::string line;
+        while (std::getline(file, line) && !(decoder.hasFrame() && decoder.getTick() == target)) decoder.apply(line);
+    });
+    const double open = Bench::bestOf(3, [&]() { RecordingReader reader(path); });
+    RecordingReader reader(path);
+    const double seek = Bench::bestOf(3, [&]() { reader.seek(target); });
+    reporter.report("RecordingSeek", "linear decode to tick", linear * 1e3, "ms");
+    reporter.report("RecordingSeek", "open (map, topology, index)", open * 1e3, "ms");
+    reporter.report("RecordingSeek", "seek to tick", seek * 1e3, "ms");
+    std::remove(path.c_str());
+}
+
+SIM_BENCHMARK(SinkThroughput) {
+    // one frame of a busy network written over and over, so the sinks get the same bytes and nothing else is timed
+    std::istringstream xml(Bench::scenario(2000, 5, 1000));
+    std::ostream dummyStream(nullptr);
+    Simulation sim(xml, 1.0 / 60.0, dummyStream);
+    sim.setSeed(1);
+    for (unsigned int i = 0; i < 60; ++i) sim.godTick();
+    std::ostringstream jsonFrame;
+    Logger::logAsJson(sim, jsonFrame);
+    const std::string json = jsonFrame.str();
+
+    const std::uint64_t volume = 256u << 20;
+    const std::string path = "/tmp/sim_bench_sink_" + std::to_string(::getpid()) + ".out";
+
+    // binary frames are many small writes (a field at a time), json frames one large write each
+    const auto writeBinary = [&](OutputSink &sink) {
+        while (sink.getBytes() < volume) Logger::logAsBinary(sim, sink);
+    };
+    const auto writeJson = [&](OutputSink &sink) {
+        while (sink.getBytes() < volume) sink.write(json);
+    };
+    const auto measure = [&](const std::string &name, const auto &write) {
+        // the file is closed inside the timing, a mapped file is truncated then
+        const double stream = Bench::bestOf(3, [&]() {
+            std::ofstream file(path, std::ios::binary);
+            StreamSink sink(file);
+            write(sink);
+            sink.flush();
+        });
+        const double mapped = Bench::bestOf(3, [&]() {
+            MappedFileSink sink(path);
+            write(sink);
+            sink.close();
+        });
+        reporter.report("SinkThroughput", name + " stream", volume / stream / (1 << 20), "MB/s");
+        reporter.report("SinkThroughput", name + " mmap", volume / mapped / (1 << 20), "MB/s");
+    };
+    measure("binary frames", writeBinary);
+    measure("json frames", writeJson);
+
+    // the binary frames as Logger::logAsBinary wrote them before the sinks, an ostream::write per field
+    const double perField = Bench::bestOf(3, [&]() {
+        std::ofstream file(path, std::ios::binary);
+        std::uint64_t bytes = 0;
+        while (bytes < volume) {
+            const uint32_t vehicleCount = sim.getVehicles().size();
+            file.write(reinterpret_cast<const char *>(&vehicleCount), sizeof(vehicleCount));
+            for (const std::pair<const id, VehicleEntity> &vehiclePair : sim.getVehicles()) {
+                const std::pair<id, double> &location = sim.getWorld().at(vehiclePair.first);
+                const uint32_t vehicleId = vehiclePair.first;
+                const uint32_t roadId = location.first;
+                const double velocity = vehiclePair.second.getVelocity();
+                const uint8_t type = vehiclePair.second.getType();
+                file.write(reinterpret_cast<const char *>(&vehicleId), sizeof(vehicleId));
+                file.write(reinterpret_cast<const char *>(&roadId), sizeof(roadId));
+                file.write(reinterpret_cast<const char *>(&location.second), sizeof(location.second));
+                file.write(reinterpret_cast<const char *>(&velocity), sizeof(velocity));
+                file.write(reinterpret_cast<const char *>(&type), sizeof(type));
+            }
+            bytes += sizeof(vehicleCount) + vehicleCount * 25u;
+        }
+    });
+    reporter.report("SinkThroughput", "binary frames ostream per field", volume / perField / (1 << 20), "MB/s");
+    std::remove(path.c_str());
+}
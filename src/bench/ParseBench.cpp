@@ -0,0 +1,90 @@
+//============================================================================
+// Name        : ParseBench.cpp
+// Description : Benchmarks of the numeric conversions and of loading a large scenario
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../Simulation.h"
+#include "../lib/utils/Utils.h"
+#include "../lib/xml-validator/Validator.h"
+#include "Bench.h"
+
+namespace {
+    const unsigned int kNumbers = 1000000;
+    const unsigned int kRoads = 10000;  // 10000 roads with a light, a bus stop and 20 vehicles: 230000 entities
+    const unsigned int kVehiclesPerRoad = 20;
+
+    /// conversion the way Utils::stod used to do it, kept as the reference
+    double streamStod(const std::string &s) {
+        std::stringstream str(s);
+        double tmp = 0;
+        str >> tmp;
+        return tmp;
+    }
+
+    /// numbers as they appear in the scenarios and the constants file
+    std::vector<std::string> numbers() {
+        std::vector<std::string> result;
+        result.reserve(kNumbers);
+        for (unsigned int i = 0; i < kNumbers; ++i) {
+            result.push_back(i % 2 ? std::to_string(i % 5000) : std::to_string(i % 5000) + ".25");
+        }
+        return result;
+    }
+}  // namespace
+
+SIM_BENCHMARK(NumberParsing) {
+    const std::vector<std::string> input = numbers();
+
+    // the sums keep the conversions from being optimized away, and show both give the same values
+    double streamSum = 0;
+    const double streamSeconds = Bench::bestOf(3, [&]() {
+        streamSum = 0;
+        for (const std::string &number : input) { streamSum += streamStod(number); }
+    });
+
+    double charsSum = 0;
+    const double charsSeconds = Bench::bestOf(3, [&]() {
+        charsSum = 0;
+        for (const std::string &number : input) { charsSum += Utils::stod(number); }
+    });
+
+    reporter.report("NumberParsing", "stringstream", streamSeconds / kNumbers * 1e9, "ns/number");
+    reporter.report("NumberParsing", "Utils::stod (from_chars)", charsSeconds / kNumbers * 1e9, "ns/number");
+    reporter.report("NumberParsing", "speedup", streamSeconds / charsSeconds, "x");
+    reporter.report("NumberParsing", "difference of the sums", charsSum - streamSum, "");
+}
+
+SIM_BENCHMARK(ScenarioLoading) {
+    const std::string xml = Bench::scenario(kRoads, kVehiclesPerRoad, 1000);
+    const double entities = double(kRoads) * (3 + kVehiclesPerRoad);
+    std::ostream dummyStream(nullptr);
+
+    std::size_t objects = 0;
+    const double validateSeconds = Bench::bestOf(3, [&]() {
+        std::istringstream stream(xml);
+        objects = Validator::validate(stream, dummyStream).size();
+    });
+
+    std::size_t vehicles = 0;
+    const double loadSeconds = Bench::bestOf(3, [&]() {
+        std::istringstream stream(xml);
+        const std::unique_ptr<Simulation> sim(new Simulation(stream, 1.0 / 60.0, dummyStream));
+        vehicles = sim->getVehicles().size();
+    });
+
+    reporter.report("ScenarioLoading", "entities", entities, "");
+    reporter.report("ScenarioLoading", "validate (xml to typed values)", validateSeconds, "s");
+    reporter.report("ScenarioLoading", "load (validate and parse)", loadSeconds, "s");
+    reporter.report("ScenarioLoading", "load rate", entities / loadSeconds, "entities/s");
+    reporter.report("ScenarioLoading", "object types validated", objects, "");
+    reporter.report("ScenarioLoading", "vehicles loaded", vehicles, "");
+}
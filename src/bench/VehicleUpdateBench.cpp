@@ -0,0 +1,323 @@
+//============================================================================
+// Name        : VehicleUpdateBench.cpp
+// Description : Benchmarks of the vehicle update kernel, with type checks per vehicle or per class
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/27
+// Version     : 1.0
+//============================================================================
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#include "../Simulation.h"
+#include "../objects/entities/vehicle/VehicleEntity.h"
+#include "Bench.h"
+
+namespace {
+    const unsigned int kVehicles = 20000;
+    const unsigned int kTicks = 100;
+    const unsigned int kRepetitions = 3;
+    const double kStepSize = 1.0 / 60.0;
+
+    /// inputs of the update of one vehicle, fixed during the benchmark
+    struct Inputs {
+        double distToCar;
+        double velOfNextCar;
+        double distToLight;
+        double distToBusStop;
+        int busHaltTime;
+        unsigned int busStopId;
+        bool priorityVehicleInFront;
+    };
+
+    /// vehicles with interleaved types, like the vehicles of a simulation in id order
+    std::vector<VehicleEntity> makeVehicles() {
+        static const EVehicleEntityTypes kTypes[] = {kCar, kCar, kBus, kCar, kAmbulance,
+                                                     kCar, kCar, kCar, kPoliceCruiser, kFireTruck};
+        std::vector<VehicleEntity> vehicles;
+        vehicles.reserve(kVehicles);
+        for (unsigned int i = 0; i < kVehicles; ++i) vehicles.emplace_back(i, kTypes[i % 10]);
+        return vehicles;
+    }
+
+    /// a vehicle in front for most of them, a red light for some and a far bus stop for the busses
+    std::vector<Inputs> makeInputs(const std::vector<VehicleEntity> &vehicles) {
+        const double inf = std::numeric_limits<double>::infinity();
+        std::vector<Inputs> inputs;
+        inputs.reserve(vehicles.size());
+        for (unsigned int i = 0; i < vehicles.size(); ++i) {
+            Inputs input{inf, inf, inf, inf, std::numeric_limits<int>::infinity(), 0, false};
+            if (i % 4 != 0) {
+                input.distToCar = 20 + i % 13;
+                input.velOfNextCar = 8 + i % 5;
+            }
+            if (i % 3 == 0) input.distToLight = 40 + i % 29;
+            if (vehicles[i].getType() == kBus) {
+                input.distToBusStop = 500;
+                input.busHaltTime = 5;
+                input.busStopId = 1;
+            }
+            inputs.push_back(input);
+        }
+        return inputs;
+    }
+
+    /**
+     * A vehicle as it was before the update was specialized per class: it keeps its own copy of the constants of its
+     * type and every update checks the type at run time
+     */
+    struct TypeCheckedVehicle {
+        EVehicleEntityTypes type;
+        double length;
+        double maxVelocity;
+        double maxAcceleration;
+        double maxBrakeForce;
+        double minimalFollow;
+        int busStop = -1;
+        double velocity = 0;
+        double targetVelocity = 20.0;
+        double acceleration = 0;
+        double ticksStopped = -1;
+        bool steady = false;
+        bool settled = false;
+
+        explicit TypeCheckedVehicle(EVehicleEntityTypes type) : type(type) {
+            const VehicleProfile &profile = VehicleProfile::of(type);
+            length = profile.length;
+            maxVelocity = profile.maxVelocity;
+            maxAcceleration = profile.maxAcceleration;
+            maxBrakeForce = profile.maxBrakeForce;
+            minimalFollow = profile.minimalFollow;
+        }
+
+        /// the kernel of VehicleEntity::update before it was specialized per class (the contracts are left out)
+        double update(double distToCar, double velNextCar, double distToLight, double distToBusStop, int busHaltTime,
+                      unsigned int busStopId, const bool priorityVehicleInFront, const double stepSize) {
+            const double tickFraction = 1;
+            const double timeStep = stepSize * tickFraction;
+
+            // state before the update, to detect a fixed point
+            const double oldVelocity = velocity;
+            const double oldAcceleration = acceleration;
+            const double oldTargetVelocity = targetVelocity;
+            const int oldBusStop = busStop;
+            steady = false;
+            settled = false;
+
+            if (priorityVehicleInFront) {
+                distToCar = std::numeric_limits<double>::infinity();
+                velNextCar = std::numeric_limits<double>::infinity();
+            }
+
+            if (type == EVehicleEntityTypes::kPoliceCruiser || type == EVehicleEntityTypes::kAmbulance ||
+                type == EVehicleEntityTypes::kFireTruck) {
+                distToLight = std::numeric_limits<double>::infinity();
+            }
+
+            // halt at current stop for haltTime
+            if (ticksStopped != -1 && ticksStopped * stepSize < busHaltTime) {
+                ticksStopped += tickFraction;
+                return 0;
+            }
+
+            // determine closest obstacle
+            double distToObstacle;
+            // if we passed the time of the current stop, then other obstacles are of interest
+            if (busStop == (int) busStopId) {
+                distToObstacle = std::min(distToCar, distToLight);
+            } else {
+                distToObstacle = std::min({distToCar, distToLight, distToBusStop});
+            }
+
+            double result;
+
+            // calculate velocity
+            if (velocity + acceleration * timeStep < 0) {
+                result = -std::pow(velocity, 2) / (2 * acceleration);
+                velocity = 0;
+            } else {
+                velocity += acceleration * timeStep;
+                result = velocity * timeStep + acceleration * (std::pow(timeStep, 2) / 2);
+            }
+
+            // calculate velocity difference
+            const double velDiff = velocity - velNextCar;
+
+            // calculate δ
+            double delta = 0;
+            if (distToObstacle == distToCar) {
+                delta = (minimalFollow + std::max(0.0, velocity + (velocity * velDiff) / 2 *
+                                                                    std::sqrt(maxAcceleration * maxBrakeForce))) /
+                        distToCar;
+            }
+
+            // calculate acceleration
+            acceleration = maxAcceleration * (1 - std::pow(velocity / targetVelocity, 4) - std::pow(delta, 2));
+
+            // check for obstacles
+            if ((distToObstacle == distToLight || distToObstacle == distToBusStop) &&
+                distToObstacle <= VehicleEntity::kObstacleReach) {
+                if (distToObstacle <= 15.0) {
+                    // stop the vehicle
+                    acceleration = -maxBrakeForce * velocity / targetVelocity;
+                } else if (distToObstacle >= 15.0) {
+                    // slow down the vehicle
+                    targetVelocity = 0.4 * maxVelocity;
+                }
+            } else {
+                targetVelocity = maxVelocity;
+            }
+
+            // check if bus is stopped for busstop that it hasn't done yet
+            if (distToObstacle == distToBusStop && distToBusStop < 15 && velocity < 0.1 && busStop == -1) {
+                ticksStopped = 0;
+                busStop = busStopId;
+            }
+
+            // if we drive ahead of the current busstop
+            if (busStop != -1 && (int) busStopId != busStop) {
+                ticksStopped = -1;
+                busStop = -1;
+            }
+
+            // halting busses are never steady, their ticksStopped changes every tick
+            steady = velocity == oldVelocity && acceleration == oldAcceleration &&
+                     targetVelocity == oldTargetVelocity && busStop == oldBusStop && ticksStopped == -1;
+            settled = steady && result == 0;
+
+            return result;
+        }
+    };
+
+    /// the vehicle in front of vehicle i, the vehicles form one ring
+    std::size_t leaderOf(std::size_t i) { return (i + 1) % kVehicles; }
+
+    template <typename Policy>
+    void updateBucket(std::vector<VehicleEntity> &vehicles, const std::vector<Inputs> &inputs,
+                      const std::vector<bool> &priorityInFront, const std::vector<std::size_t> &bucket,
+                      double &total) {
+        for (const std::size_t i : bucket) {
+            const Inputs &in = inputs[i];
+            total += vehicles[i].update<Policy>(in.distToCar, in.velOfNextCar, in.distToLight, in.distToBusStop,
+                                                in.busHaltTime, in.busStopId, priorityInFront[i], kStepSize);
+        }
+    }
+}  // namespace
+
+SIM_BENCHMARK(VehicleUpdate) {
+    const std::vector<VehicleEntity> prototype = makeVehicles();
+    const std::vector<Inputs> inputs = makeInputs(prototype);
+
+    // before: the gather phase compares the type of the vehicle in front, the kernel checks the type of the vehicle
+    double checkedTotal = 0;
+    std::vector<TypeCheckedVehicle> checked;
+    checked.reserve(prototype.size());
+    for (const VehicleEntity &vehicle : prototype) checked.emplace_back(vehicle.getType());
+    std::vector<bool> checkedPriorityInFront(prototype.size());
+    const double checkedSeconds = Bench::bestOf(kRepetitions, [&]() {
+        for (unsigned int tick = 0; tick < kTicks; ++tick) {
+            for (std::size_t i = 0; i < checked.size(); ++i) {
+                const TypeCheckedVehicle &leader = checked[leaderOf(i)];
+                const EVehicleEntityTypes vehicleType = leader.type;
+                checkedPriorityInFront[i] =
+                  inputs[i].distToCar != std::numeric_limits<double>::infinity() &&
+                  (vehicleType == EVehicleEntityTypes::kAmbulance || vehicleType == EVehicleEntityTypes::kFireTruck ||
+                   vehicleType == EVehicleEntityTypes::kPoliceCruiser) &&
+                  leader.acceleration == leader.maxAcceleration;
+            }
+            for (std::size_t i = 0; i < checked.size(); ++i) {
+                const Inputs &in = inputs[i];
+                checkedTotal += checked[i].update(in.distToCar, in.velOfNextCar, in.distToLight, in.distToBusStop,
+                                                  in.busHaltTime, in.busStopId, checkedPriorityInFront[i], kStepSize);
+            }
+        }
+    });
+
+    // after: the gather phase checks the class of the vehicle in front, one specialized loop per class
+    std::array<std::vector<std::size_t>, kVehicleClassCount> buckets;
+    for (std::size_t i = 0; i < prototype.size(); ++i) buckets[(std::size_t) prototype[i].getClass()].push_back(i);
+
+    double bucketedTotal = 0;
+    std::vector<VehicleEntity> bucketed = prototype;
+    std::vector<bool> bucketedPriorityInFront(prototype.size());
+    const double bucketedSeconds = Bench::bestOf(kRepetitions, [&]() {
+        for (unsigned int tick = 0; tick < kTicks; ++tick) {
+            for (std::size_t i = 0; i < bucketed.size(); ++i) {
+                const VehicleEntity &leader = bucketed[leaderOf(i)];
+                bucketedPriorityInFront[i] = inputs[i].distToCar != std::numeric_limits<double>::infinity() &&
+                                             leader.getClass() == EVehicleClass::kPriority &&
+                                             leader.getAcceleration() == leader.getMaxAcceleration();
+            }
+            updateBucket<RegularVehiclePolicy>(bucketed, inputs, bucketedPriorityInFront,
+                                               buckets[(std::size_t) EVehicleClass::kRegular], bucketedTotal);
+            updateBucket<BusPolicy>(bucketed, inputs, bucketedPriorityInFront,
+                                    buckets[(std::size_t) EVehicleClass::kBus], bucketedTotal);
+            updateBucket<PriorityVehiclePolicy>(bucketed, inputs, bucketedPriorityInFront,
+                                                buckets[(std::size_t) EVehicleClass::kPriority], bucketedTotal);
+        }
+    });
+
+    const double updates = double(kVehicles) * kTicks;
+    reporter.report("VehicleUpdate", "type checks per vehicle (before)", checkedSeconds / updates * 1e9, "ns/update");
+    reporter.report("VehicleUpdate", "bucketed by class (after)", bucketedSeconds / updates * 1e9, "ns/update");
+    reporter.report("VehicleUpdate", "speedup", checkedSeconds / bucketedSeconds, "x");
+
+    // both ways integrate the same vehicles with the same inputs, only the order of the sum differs
+    double largestDifference = 0;
+    for (std::size_t i = 0; i < prototype.size(); ++i) {
+        largestDifference = std::max(largestDifference, std::abs(checked[i].velocity - bucketed[i].getVelocity()));
+    }
+    reporter.report("VehicleUpdate", "largest velocity difference", largestDifference, "m/s");
+    reporter.report("VehicleUpdate", "total displacement", bucketedTotal, "m");
+}
+
+SIM_BENCHMARK(SimulationTick) {
+    const unsigned int roads = 200;
+    const unsigned int ticks = 600;
+
+    std::istringstream xml(Bench::scenario(roads, 20, 1000));
+    std::ostream dummyStream(nullptr);
+    Simulation sim(xml, kStepSize, dummyStream);
+    sim.setSeed(1);
+
+    unsigned long long vehicleUpdates = 0;
+    const double seconds = Bench::bestOf(1, [&]() {
+        for (unsigned int i = 0; i < ticks; ++i) {
+            vehicleUpdates += sim.getVehicles().size() - sim.getSleepingVehicles();
+            sim.godTick();
+        }
+    });
+
+    reporter.report("SimulationTick", "ticks per second", ticks / seconds, "ticks/s");
+    reporter.report("SimulationTick", "time per vehicle update", seconds / double(vehicleUpdates) * 1e9, "ns/update");
+}
+
+SIM_BENCHMARK(ProfilerOverhead) {
+    const unsigned int roads = 200;
+    const unsigned int ticks = 600;
+    const unsigned int laps = 1000000;
+
+    // cost of one measured phase, a tick measures 7 phases (more when stepping adaptively)
+    Profiler profiler;
+    PhaseClock clock(profiler);
+    const double lapSeconds = Bench::bestOf(3, [&]() {
+        for (unsigned int i = 0; i < laps; ++i) { clock.lap(EPhase::kGather, i); }
+    }) / laps;
+
+    std::istringstream xml(Bench::scenario(roads, 20, 1000));
+    std::ostream dummyStream(nullptr);
+    Simulation sim(xml, kStepSize, dummyStream);
+    sim.setSeed(1);
+    const double tickSeconds = Bench::bestOf(1, [&]() {
+        for (unsigned int i = 0; i < ticks; ++i) { sim.godTick(); }
+    }) / ticks;
+
+    reporter.report("ProfilerOverhead", "time per measured phase", lapSeconds * 1e9, "ns");
+    reporter.report("ProfilerOverhead", "time per tick", tickSeconds * 1e9, "ns");
+    reporter.report("ProfilerOverhead", "share of a tick", 7 * lapSeconds / tickSeconds * 100, "%");
+}
@@ -0,0 +1,77 @@
+//============================================================================
+// Name        : ViewBench.cpp
+// Description : Benchmark of reading the state of every road through the databases and through the road views
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <chrono>
+#include <sstream>
+
+#include "../Simulation.h"
+#include "Bench.h"
+
+namespace {
+    const unsigned int kTicks = 200;
+
+    /// sum of the positions and velocities of the vehicles, so the reads are not optimized away
+    volatile double sink = 0;
+
+    /// reads every vehicle through the vehicles on the roads, the world and the vehicle database
+    void readDatabases(const Simulation &sim) {
+        double sum = 0;
+        for (const std::pair<const id, RoadObject> &road : sim.getRoads()) {
+            for (const id vehicleId : sim.getVehiclesOnRoads().at(road.first)) {
+                sum += sim.getWorld().at(vehicleId).second + sim.getVehicles().at(vehicleId).getVelocity();
+            }
+        }
+        sink = sum;
+    }
+
+    /// reads every vehicle through the spans of the road views
+    void readViews(const Simulation &sim) {
+        double sum = 0;
+        for (const std::pair<const id, RoadObject> &road : sim.getRoads()) {
+            const RoadView view = sim.getRoadView(road.first);
+            const Span<double> positions = view.getPositions();
+            const Span<double> velocities = view.getVelocities();
+            for (std::size_t i = 0; i < positions.size(); ++i) sum += positions[i] + velocities[i];
+        }
+        sink = sum;
+    }
+}  // namespace
+
+SIM_BENCHMARK(StateViews) {
+    // the ticks keep the snapshot up to date, the first reader of a tick only checks the order on the roads
+    for (const unsigned int vehiclesPerRoad : {5u, 20u, 50u}) {
+        std::istringstream xml(Bench::scenario(500, vehiclesPerRoad, 2000));
+        std::ostream dummyStream(nullptr);
+        Simulation sim(xml, 1.0 / 60.0, dummyStream);
+        const double vehicles = double(sim.getVehicles().size());
+
+        double databases = 0;
+        double firstView = 0;
+        double sharedView = 0;
+        for (unsigned int i = 0; i < kTicks; ++i) {
+            sim.godTick();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            readDatabases(sim);
+            databases += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            readViews(sim);
+            firstView += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            readViews(sim);
+            sharedView += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        const std::string network = std::to_string(vehiclesPerRoad) + " vehicles/road ";
+        reporter.report("StateViews", network + "databases", databases / kTicks / vehicles * 1e9, "ns/vehicle");
+        reporter.report("StateViews", network + "first view", firstView / kTicks / vehicles * 1e9, "ns/vehicle");
+        reporter.report("StateViews", network + "shared view", sharedView / kTicks / vehicles * 1e9, "ns/vehicle");
+    }
+}
@@ -0,0 +1,271 @@
+//============================================================================
+// Name        : TrafficSimC.cpp
+// Description : C interface of the trafficsim library, checks the arguments and turns exceptions into a status
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "../../TrafficSimC.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../Simulation.h"
+
+// the ids and types are copied as they are
+static_assert(sizeof(id) == sizeof(uint32_t), "ids are 32 bit");
+static_assert(int(TS_CAR) == kCar && int(TS_BUS) == kBus && int(TS_FIRE_TRUCK) == kFireTruck &&
+                int(TS_AMBULANCE) == kAmbulance && int(TS_POLICE_CRUISER) == kPoliceCruiser,
+              "vehicle types match");
+
+/// A simulation and the ids of its roads in the order they are exported in
+struct TsSimulation {
+    std::unique_ptr<Simulation> simulation;
+    std::vector<id> roadIds;
+};
+
+namespace {
+    thread_local std::string lastError;
+
+    /// remembers the message for ts_last_error and returns the status
+    TsStatus fail(TsStatus status, const std::string &message) {
+        lastError = std::string(ts_status_name(status)) + ": " + message;
+        return status;
+    }
+
+    /// creates the simulation from the scenario, the contracts of the constructor are checked first
+    TsStatus create(std::istream &xml, double stepSize, TsSimulation **simulation) {
+        std::ostringstream validatorOutput;
+        try {
+            std::unique_ptr<TsSimulation> created(new TsSimulation());
+            created->simulation.reset(new Simulation(xml, stepSize, validatorOutput));
+            for (const std::pair<const id, RoadObject> &road : created->simulation->getRoads()) {
+                created->roadIds.push_back(road.first);
+            }
+            std::sort(created->roadIds.begin(), created->roadIds.end());
+            *simulation = created.release();
+            return TS_OK;
+        } catch (const std::bad_alloc &) {
+            return fail(TS_INTERNAL_ERROR, "out of memory");
+        } catch (const std::exception &exception) {
+            return fail(TS_INVALID_SCENARIO, exception.what() + ('\n' + validatorOutput.str()));
+        }
+    }
+
+    /// runs a call of the simulation, an exception it throws becomes TS_INTERNAL_ERROR instead of leaving the C caller
+    template <typename Call>
+    TsStatus guarded(const Call &call) {
+        try {
+            return call();
+        } catch (const std::exception &exception) {
+            return fail(TS_INTERNAL_ERROR, exception.what());
+        }
+    }
+
+    /// the export calls only copy when every array of the caller has room for all elements
+    bool fits(size_t capacity, size_t required, size_t *count) {
+        *count = required;
+        return capacity >= required;
+    }
+}  // namespace
+
+TsStatus ts_create_from_buffer(const char *xml, size_t size, double stepSize, TsSimulation **simulation) {
+    if (!simulation) return fail(TS_INVALID_ARGUMENT, "simulation is NULL");
+    *simulation = nullptr;
+    if (!xml) return fail(TS_INVALID_ARGUMENT, "xml is NULL");
+    if (!(stepSize > 0) || !std::isfinite(stepSize)) return fail(TS_INVALID_ARGUMENT, "stepSize is not positive");
+
+    std::istringstream stream(std::string(xml, size));
+    return create(stream, stepSize, simulation);
+}
+
+TsStatus ts_create_from_path(const char *path, double stepSize, TsSimulation **simulation) {
+    if (!simulation) return fail(TS_INVALID_ARGUMENT, "simulation is NULL");
+    *simulation = nullptr;
+    if (!path) return fail(TS_INVALID_ARGUMENT, "path is NULL");
+    if (!(stepSize > 0) || !std::isfinite(stepSize)) return fail(TS_INVALID_ARGUMENT, "stepSize is not positive");
+
+    std::ifstream stream(path);
+    if (!stream.is_open()) return fail(TS_IO_ERROR, std::string("cannot open ") + path);
+    return create(stream, stepSize, simulation);
+}
+
+void ts_destroy(TsSimulation *simulation) { delete simulation; }
+
+const char *ts_last_error(void) { return lastError.c_str(); }
+
+const char *ts_status_name(TsStatus status) {
+    switch (status) {
+        case TS_OK: return "TS_OK";
+        case TS_INVALID_ARGUMENT: return "TS_INVALID_ARGUMENT";
+        case TS_INVALID_SCENARIO: return "TS_INVALID_SCENARIO";
+        case TS_IO_ERROR: return "TS_IO_ERROR";
+        case TS_NOT_FOUND: return "TS_NOT_FOUND";
+        case TS_BUFFER_TOO_SMALL: return "TS_BUFFER_TOO_SMALL";
+        case TS_REFUSED: return "TS_REFUSED";
+        case TS_INTERNAL_ERROR: return "TS_INTERNAL_ERROR";
+    }
+    return "TS_UNKNOWN";
+}
+
+TsStatus ts_set_seed(TsSimulation *simulation, uint32_t seed) {
+    if (!simulation) return fail(TS_INVALID_ARGUMENT, "simulation is NULL");
+    simulation->simulation->setSeed(seed);
+    return TS_OK;
+}
+
+TsStatus ts_set_threads(TsSimulation *simulation, uint32_t threads) {
+    if (!simulation) return fail(TS_INVALID_ARGUMENT, "simulation is NULL");
+    if (threads == 0) return fail(TS_INVALID_ARGUMENT, "threads is zero");
+    simulation->simulation->setThreadCount(threads);
+    return TS_OK;
+}
+
+TsStatus ts_tick(TsSimulation *simulation, uint32_t ticks) {
+    if (!simulation) return fail(TS_INVALID_ARGUMENT, "simulation is NULL");
+    return guarded([simulation, ticks]() {
+        simulation->simulation->godTicks(ticks);
+        return TS_OK;
+    });
+}
+
+TsStatus ts_get_time(const TsSimulation *simulation, uint32_t *iteration, double *seconds) {
+    if (!simulation) return fail(TS_INVALID_ARGUMENT, "simulation is NULL");
+    const Simulation &sim = *simulation->simulation;
+    if (iteration) *iteration = sim.getIteration();
+    if (seconds) *seconds = sim.getIteration() * sim.getStepSize();
+    return TS_OK;
+}
+
+TsStatus ts_find_road(const TsSimulation *simulation, const char *name, uint32_t *roadId) {
+    if (!simulation || !name || !roadId) return fail(TS_INVALID_ARGUMENT, "simulation, name or roadId is NULL");
+    const std::unordered_map<std::string, id> &roadMap = simulation->simulation->getRoadMap();
+    const std::unordered_map<std::string, id>::const_iterator road = roadMap.find(name);
+    if (road == roadMap.end()) return fail(TS_NOT_FOUND, std::string("no road named ") + name);
+    *roadId = road->second;
+    return TS_OK;
+}
+
+TsStatus ts_export_roads(const TsSimulation *simulation, size_t capacity, uint32_t *roadIds, double *lengths,
+                         size_t *count) {
+    if (!simulation || !count) return fail(TS_INVALID_ARGUMENT, "simulation or count is NULL");
+    const std::vector<id> &ids = simulation->roadIds;
+    if (!fits(capacity, ids.size(), count)) return fail(TS_BUFFER_TOO_SMALL, "room for the roads is too small");
+
+    if (roadIds) std::copy(ids.begin(), ids.end(), roadIds);
+    if (lengths) {
+        const std::unordered_map<id, RoadObject> &roads = simulation->simulation->getRoads();
+        for (std::size_t i = 0; i < ids.size(); ++i) lengths[i] = roads.at(ids[i]).getLength();
+    }
+    return TS_OK;
+}
+
+TsStatus ts_get_vehicle_count(const TsSimulation *simulation, size_t *count) {
+    if (!simulation || !count) return fail(TS_INVALID_ARGUMENT, "simulation or count is NULL");
+    *count = simulation->simulation->getVehicles().size();
+    return TS_OK;
+}
+
+TsStatus ts_export_vehicles(const TsSimulation *simulation, size_t capacity, uint32_t *vehicleIds, uint32_t *roadIds,
+                            double *positions, double *velocities, int32_t *types, size_t *count) {
+    if (!simulation || !count) return fail(TS_INVALID_ARGUMENT, "simulation or count is NULL");
+    const Simulation &sim = *simulation->simulation;
+    if (!fits(capacity, sim.getVehicles().size(), count)) {
+        return fail(TS_BUFFER_TOO_SMALL, "room for the vehicles is too small");
+    }
+
+    // the views of all roads share one snapshot, every attribute is copied from its span
+    return guarded([&]() {
+        std::size_t next = 0;
+        for (const id roadId : simulation->roadIds) {
+            const RoadView view = sim.getRoadView(roadId);
+            const std::size_t size = view.size();
+            if (vehicleIds) std::copy(view.getVehicleIds().begin(), view.getVehicleIds().end(), vehicleIds + next);
+            if (roadIds) std::fill(roadIds + next, roadIds + next + size, roadId);
+            if (positions) std::copy(view.getPositions().begin(), view.getPositions().end(), positions + next);
+            if (velocities) std::copy(view.getVelocities().begin(), view.getVelocities().end(), velocities + next);
+            if (types) std::copy(view.getTypes().begin(), view.getTypes().end(), types + next);
+            next += size;
+        }
+        return TS_OK;
+    });
+}
+
+TsStatus ts_export_road_vehicles(const TsSimulation *simulation, uint32_t roadId, size_t capacity,
+                                 uint32_t *vehicleIds, double *positions, double *velocities, int32_t *types,
+                                 size_t *count) {
+    if (!simulation || !count) return fail(TS_INVALID_ARGUMENT, "simulation or count is NULL");
+    const Simulation &sim = *simulation->simulation;
+    if (sim.getRoads().find(roadId) == sim.getRoads().end()) {
+        return fail(TS_NOT_FOUND, "no road with id " + std::to_string(roadId));
+    }
+
+    return guarded([&]() {
+        const RoadView view = sim.getRoadView(roadId);
+        if (!fits(capacity, view.size(), count)) {
+            return fail(TS_BUFFER_TOO_SMALL, "room for the vehicles is too small");
+        }
+        if (vehicleIds) std::copy(view.getVehicleIds().begin(), view.getVehicleIds().end(), vehicleIds);
+        if (positions) std::copy(view.getPositions().begin(), view.getPositions().end(), positions);
+        if (velocities) std::copy(view.getVelocities().begin(), view.getVelocities().end(), velocities);
+        if (types) std::copy(view.getTypes().begin(), view.getTypes().end(), types);
+        return TS_OK;
+    });
+}
+
+TsStatus ts_export_road_lights(const TsSimulation *simulation, uint32_t roadId, size_t capacity, uint32_t *lightIds,
+                               double *positions, uint8_t *green, size_t *count) {
+    if (!simulation || !count) return fail(TS_INVALID_ARGUMENT, "simulation or count is NULL");
+    const Simulation &sim = *simulation->simulation;
+    if (sim.getRoads().find(roadId) == sim.getRoads().end()) {
+        return fail(TS_NOT_FOUND, "no road with id " + std::to_string(roadId));
+    }
+
+    return guarded([&]() {
+        const RoadView view = sim.getRoadView(roadId);
+        if (!fits(capacity, view.getLightIds().size(), count)) {
+            return fail(TS_BUFFER_TOO_SMALL, "room for the lights is too small");
+        }
+        if (lightIds) std::copy(view.getLightIds().begin(), view.getLightIds().end(), lightIds);
+        if (positions) std::copy(view.getLightPositions().begin(), view.getLightPositions().end(), positions);
+        if (green) std::copy(view.getLightsGreen().begin(), view.getLightsGreen().end(), green);
+        return TS_OK;
+    });
+}
+
+TsStatus ts_inject_vehicle(TsSimulation *simulation, uint32_t roadId, double position, int32_t type,
+                           uint32_t *vehicleId) {
+    if (!simulation) return fail(TS_INVALID_ARGUMENT, "simulation is NULL");
+    Simulation &sim = *simulation->simulation;
+    if (sim.getRoads().find(roadId) == sim.getRoads().end()) {
+        return fail(TS_NOT_FOUND, "no road with id " + std::to_string(roadId));
+    }
+    if (!(position >= 0) || !std::isfinite(position)) return fail(TS_INVALID_ARGUMENT, "position is negative");
+    if (type < TS_CAR || type > TS_POLICE_CRUISER) return fail(TS_INVALID_ARGUMENT, "type is not a vehicle type");
+
+    return guarded([&]() {
+        const std::optional<id> injected = sim.injectVehicle(roadId, position, static_cast<EVehicleEntityTypes>(type));
+        if (!injected) return fail(TS_REFUSED, "the vehicle does not fit on the road");
+        if (vehicleId) *vehicleId = *injected;
+        return TS_OK;
+    });
+}
+
+TsStatus ts_remove_vehicle(TsSimulation *simulation, uint32_t vehicleId) {
+    if (!simulation) return fail(TS_INVALID_ARGUMENT, "simulation is NULL");
+    return guarded([simulation, vehicleId]() {
+        if (!simulation->simulation->removeVehicle(vehicleId)) {
+            return fail(TS_NOT_FOUND, "no vehicle with id " + std::to_string(vehicleId));
+        }
+        return TS_OK;
+    });
+}
@@ -0,0 +1,205 @@
+//============================================================================
+// Name        : CommandLine.cpp
+// Description : Implementation of the command line parser
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/21
+// Version     : 1.0
+//============================================================================
+
+#include "CommandLine.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "../path/path.h"
+
+RunOptions CommandLine::parse(int argc, const char *const *argv) {
+    RunOptions options;
+    options.scenarioPath = path::resFolderPath + "xml/input4.xml";
+
+    // duration is converted to ticks at the end because the step size can be given after it
+    double duration = -1;
+    bool scenarioSet = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+
+        if (argument == "-h" || argument == "--help") {
+            options.help = true;
+            continue;
+        }
+
+        // positional argument: scenario path
+        if (argument.empty() || argument[0] != '-') {
+            if (scenarioSet) throw std::runtime_error("[CommandLine] Only one scenario can be given: '" + argument + "'.");
+            options.scenarioPath = argument;
+            scenarioSet = true;
+            continue;
+        }
+
+        // all other arguments require a value
+        if (i + 1 >= argc) throw std::runtime_error("[CommandLine] Argument '" + argument + "' requires a value.");
+        const std::string value = argv[++i];
+
+        if (argument == "-t" || argument == "--ticks") {
+            options.ticks = parseUnsigned(argument, value);
+            duration = -1;
+        } else if (argument == "-d" || argument == "--duration") {
+            duration = parseDouble(argument, value, false);
+        } else if (argument == "-s" || argument == "--step") {
+            options.stepSize = parseDouble(argument, value, false);
+        } else if (argument == "-f" || argument == "--format") {
+            options.format = formatFromString(value);
+        } else if (argument == "-o" || argument == "--output") {
+            options.outputPath = value;
+        } else if (argument == "--sink") {
+            if (value != "stream" && value != "mmap")
+                throw std::runtime_error("[CommandLine] Unknown output sink: '" + value + "'. Allowed are: stream, mmap.");
+            options.mappedOutput = value == "mmap";
+        } else if (argument == "-e" || argument == "--every") {
+            options.outputEvery = parseUnsigned(argument, value);
+            if (options.outputEvery == 0)
+                throw std::runtime_error("[CommandLine] Argument '" + argument + "' must be at least 1.");
+        } else if (argument == "--every-seconds") {
+            options.outputEverySeconds = parseDouble(argument, value, true);
+        } else if (argument == "--from") {
+            options.windowStart = parseDouble(argument, value, true);
+        } else if (argument == "--to") {
+            options.windowEnd = parseDouble(argument, value, true);
+        } else if (argument == "--on-queue") {
+            options.queueTrigger = parseUnsigned(argument, value);
+        } else if (argument == "--hold") {
+            options.triggerHold = parseDouble(argument, value, true);
+        } else if (argument == "-j" || argument == "--threads") {
+            options.threads = parseUnsigned(argument, value);
+            if (options.threads == 0)
+                throw std::runtime_error("[CommandLine] Argument '" + argument + "' must be at least 1.");
+        } else if (argument == "--substeps") {
+            options.substeps = parseUnsigned(argument, value);
+            if (options.substeps == 0 || (options.substeps & (options.substeps - 1)) != 0)
+                throw std::runtime_error("[CommandLine] Argument '" + argument + "' must be a power of two.");
+        } else if (argument == "--tolerance") {
+            options.tolerance = parseDouble(argument, value, false);
+        } else if (argument == "--seed") {
+            options.seed = parseUnsigned(argument, value);
+        } else if (argument == "--profile") {
+            options.profilePath = value;
+        } else if (argument == "--realtime") {
+            options.realtime = parseDouble(argument, value, false);
+        } else if (argument == "--latency") {
+            options.latencyPath = value;
+        } else if (argument == "--serve") {
+            options.serveAddress = value;
+        } else if (argument == "--serve-buffer") {
+            options.serveBuffer = parseUnsigned(argument, value);
+            if (options.serveBuffer == 0)
+                throw std::runtime_error("[CommandLine] Argument '" + argument + "' must be at least 1.");
+        } else if (argument == "--resolution") {
+            options.deltaResolution = parseDouble(argument, value, false);
+        } else if (argument == "--keyframes") {
+            options.keyframeEvery = parseUnsigned(argument, value);
+            if (options.keyframeEvery == 0)
+                throw std::runtime_error("[CommandLine] Argument '" + argument + "' must be at least 1.");
+        } else if (argument == "--trace") {
+            options.tracePath = value;
+        } else if (argument == "--trace-spans") {
+            options.traceSpans = parseUnsigned(argument, value);
+            if (options.traceSpans == 0)
+                throw std::runtime_error("[CommandLine] Argument '" + argument + "' must be at least 1.");
+        } else {
+            throw std::runtime_error("[CommandLine] Unknown argument: '" + argument + "'.");
+        }
+    }
+
+    if (options.mappedOutput && options.outputPath.empty())
+        throw std::runtime_error("[CommandLine] Argument '--sink mmap' requires '--output'.");
+
+    if (!options.latencyPath.empty() && options.realtime == 0)
+        throw std::runtime_error("[CommandLine] Argument '--latency' requires '--realtime'.");
+
+    if (options.windowStart > options.windowEnd)
+        throw std::runtime_error("[CommandLine] The output window is empty (--from is larger than --to).");
+
+    if (duration >= 0) options.ticks = (unsigned int) std::ceil(duration / options.stepSize - 1e-9);
+
+    return options;
+}
+
+std::string CommandLine::usage(const std::string &program) {
+    return "Usage: " + program +
+           " [options] [scenario.xml]\n"
+           "\n"
+           "Options:\n"
+           "  -t, --ticks N        amount of ticks to simulate (default: 30000)\n"
+           "  -d, --duration SEC   simulated time to run, overrides --ticks\n"
+           "  -s, --step SEC       in-simulation time between two ticks, '1/60' is allowed (default: 1/60)\n"
+           "  -f, --format FORMAT  json, simple, advanced, none, binary or delta (default: json)\n"
+           "  -o, --output FILE    file to write the frames to (default: stdout)\n"
+           "      --sink S         write FILE as a stream (default) or with mmap, a mapping grown in 64 MB chunks\n"
+           "  -e, --every N        only write every N-th frame (default: 1)\n"
+           "      --every-seconds T  write at most one frame per T simulated seconds\n"
+           "      --from T0        only write frames from simulated second T0 on\n"
+           "      --to T1          only write frames up to simulated second T1\n"
+           "      --on-queue N     only write frames while N vehicles on one road are (almost) stopped\n"
+           "      --hold SEC       keep writing SEC seconds after the queue dissolved (default: 0)\n"
+           "  -j, --threads N      worker threads used to tick the simulation (default: 1)\n"
+           "      --substeps N     let busy roads take up to N (a power of two) finer steps per tick (default: 1)\n"
+           "      --tolerance M    largest estimated position error of a substep in meters (default: 0.001)\n"
+           "      --seed N         seed for the crossroad decisions (default: random)\n"
+           "      --profile FILE   write the time spent per phase of the ticks and the loggers as json to FILE\n"
+           "      --realtime X     pace the ticks to the wall clock, X simulated seconds per second (1 is real time)\n"
+           "      --latency FILE   write the tick latencies and missed deadlines of a --realtime run as json to FILE\n"
+           "      --resolution M   meters per unit of a vehicle position in delta frames and streams (default: 0.001)\n"
+           "      --keyframes N    frames between two keyframes of the delta format (default: 600)\n"
+           "      --serve ADDRESS  stream the frames to clients at unix:PATH or tcp:PORT (localhost), see sim_client\n"
+           "      --serve-buffer B  unsent bytes of a stream client before its frames are dropped (default: 4194304)\n"
+           "      --trace FILE     write a Chrome trace of the phases of every tick to FILE\n"
+           "      --trace-spans N  amount of spans the trace keeps, the last ones of the run (default: 262144)\n"
+           "  -h, --help           show this text\n";
+}
+
+EOutputFormat CommandLine::formatFromString(const std::string &name) {
+    if (name == "json") return EOutputFormat::kJson;
+    if (name == "simple") return EOutputFormat::kSimple;
+    if (name == "advanced") return EOutputFormat::kAdvanced;
+    if (name == "none") return EOutputFormat::kNone;
+    if (name == "binary") return EOutputFormat::kBinary;
+    if (name == "delta") return EOutputFormat::kDelta;
+    throw std::runtime_error("[CommandLine] Unknown output format: '" + name +
+                             "'. Allowed formats are: json, simple, advanced, none, binary, delta.");
+}
+
+unsigned int CommandLine::parseUnsigned(const std::string &option, const std::string &value) {
+    std::size_t processed = 0;
+    unsigned long result;
+    try {
+        if (value.empty() || value[0] == '-') throw std::invalid_argument(value);
+        result = std::stoul(value, &processed);
+    } catch (const std::logic_error &e) {
+        throw std::runtime_error("[CommandLine] Value of '" + option + "' is not an unsigned integer: '" + value + "'.");
+    }
+    if (processed != value.size() || result > 0xFFFFFFFFul)
+        throw std::runtime_error("[CommandLine] Value of '" + option + "' is not an unsigned integer: '" + value + "'.");
+    return (unsigned int) result;
+}
+
+double CommandLine::parseDouble(const std::string &option, const std::string &value, bool allowZero) {
+    // a fraction like 1/60 is allowed
+    const std::size_t slash = value.find('/');
+    if (slash != std::string::npos) {
+        return parseDouble(option, value.substr(0, slash), allowZero) /
+               parseDouble(option, value.substr(slash + 1), false);
+    }
+
+    std::size_t processed = 0;
+    double result;
+    try {
+        result = std::stod(value, &processed);
+    } catch (const std::logic_error &e) {
+        throw std::runtime_error("[CommandLine] Value of '" + option + "' is not a number: '" + value + "'.");
+    }
+    if (processed != value.size() || result < 0 || (result == 0 && !allowZero) || !std::isfinite(result))
+        throw std::runtime_error("[CommandLine] Value of '" + option + "' is not a positive number: '" + value + "'.");
+    return result;
+}
@@ -0,0 +1,85 @@
+//============================================================================
+// Name        : CommandLine.h
+// Description : Static helper class that parses the arguments of the sim executable
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/21
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_COMMANDLINE_H
+#define SE_PROJECT_COMMANDLINE_H
+
+#include <limits>
+#include <optional>
+#include <string>
+
+/// Output formats of the simulation driver
+enum class EOutputFormat { kJson, kSimple, kAdvanced, kNone, kBinary, kDelta };
+
+/// Options for a single (headless) simulation run
+struct RunOptions {
+    std::string scenarioPath;                     // xml file to load
+    unsigned int ticks = 30000;                   // amount of godTicks to run
+    double stepSize = 1.0 / 60.0;                 // in-simulation time between two ticks
+    EOutputFormat format = EOutputFormat::kJson;  // format of the frames
+    std::string outputPath;                       // file to write the frames to (empty: stdout)
+    bool mappedOutput = false;                    // write the output file through a memory mapping
+    unsigned int outputEvery = 1;                 // only every n-th frame is written
+    double outputEverySeconds = 0;                // at most one frame per t simulated seconds (0: disabled)
+    double windowStart = 0;                       // first simulated second that is written
+    double windowEnd = std::numeric_limits<double>::infinity();  // last simulated second that is written
+    unsigned int queueTrigger = 0;                // only write while a queue of n vehicles exists (0: disabled)
+    double triggerHold = 0;                       // seconds frames are still written after the queue dissolved
+    unsigned int threads = 1;                     // worker threads used to tick the simulation
+    unsigned int substeps = 1;                    // most substeps of a busy road per tick (1: fixed step)
+    double tolerance = 1e-3;                      // largest estimated position error of a substep in meters
+    std::optional<unsigned int> seed;             // seed for the random generator (empty: random seed)
+    std::string profilePath;                      // file to write the phase timers to at the end (empty: none)
+    std::string tracePath;                        // file to write the Chrome trace to at the end (empty: no tracing)
+    unsigned int traceSpans = 1u << 18;           // spans the trace keeps, the last ones of the run
+    double realtime = 0;                          // simulated seconds per wall clock second (0: as fast as possible)
+    std::string latencyPath;                      // file to write the latencies of a real time run to (empty: none)
+    std::string serveAddress;                     // unix:PATH or tcp:PORT to stream the frames at (empty: no server)
+    unsigned int serveBuffer = 4u << 20;          // unsent bytes of a stream client before its frames are dropped
+    double deltaResolution = 0.001;               // meters per unit of a vehicle position in delta frames
+    unsigned int keyframeEvery = 600;             // frames between two keyframes of the delta format
+    bool help = false;                            // print the usage and exit
+};
+
+// Note: This is a static class and thus does not need a properlyInitialized
+
+/**
+ * @brief Static helper class to parse the command line of the simulation driver \n
+ * @throws std::runtime_error If an argument is unknown or its value is invalid
+ */
+class CommandLine {
+  public:
+    /**
+     * Parses the arguments given to the sim executable. When both --ticks and --duration are given, the last one wins.
+     * @param argc amount of arguments (including the program name)
+     * @param argv arguments (including the program name)
+     * @return options of the run
+     */
+    static RunOptions parse(int argc, const char *const *argv);
+
+    /**
+     * @param program name of the executable
+     * @return help text describing all arguments
+     */
+    static std::string usage(const std::string &program);
+
+    /**
+     * Converts the name of an output format to its enum variant
+     * @param name json, simple, advanced, none, binary or delta
+     * @return output format
+     */
+    static EOutputFormat formatFromString(const std::string &name);
+
+  private:
+    static unsigned int parseUnsigned(const std::string &option, const std::string &value);
+
+    static double parseDouble(const std::string &option, const std::string &value, bool allowZero);
+};
+
+#endif  // SE_PROJECT_COMMANDLINE_H
@@ -8,8 +8,20 @@
 
 #include <assert.h>
 
+#ifdef NDEBUG
+
+// release builds only compile the contracts (sizeof does not evaluate them), like assert
+
+#define REQUIRE(assertion, what) static_cast<void>(sizeof(!(assertion)))
+
+#define ENSURE(assertion, what) static_cast<void>(sizeof(!(assertion)))
+
+#else
+
 #define REQUIRE(assertion, what) \
     if (!(assertion)) __assert(what, __FILE__, __LINE__)
 
 #define ENSURE(assertion, what) \
     if (!(assertion)) __assert(what, __FILE__, __LINE__)
+
+#endif
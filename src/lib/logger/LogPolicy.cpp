@@ -0,0 +1,111 @@
+//============================================================================
+// Name        : LogPolicy.cpp
+// Description : Implementation of the log policy
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/22
+// Version     : 1.0
+//============================================================================
+
+#include "LogPolicy.h"
+
+#include "../../Simulation.h"
+
+LogPolicy::LogPolicy() : _initCheck(this) { ENSURE(properlyInitialized(), "LogPolicy is properly initialized"); }
+
+LogPolicy::LogPolicy(const LogPolicy &other) :
+    tickInterval(other.tickInterval), timeInterval(other.timeInterval), windowStart(other.windowStart),
+    windowEnd(other.windowEnd), trigger(other.trigger), holdTime(other.holdTime), nextLogTime(other.nextLogTime),
+    lastTriggerTime(other.lastTriggerTime), lastIteration(other.lastIteration), lastDecision(other.lastDecision),
+    _initCheck(this) {}
+
+LogPolicy &LogPolicy::operator=(const LogPolicy &other) {
+    tickInterval = other.tickInterval;
+    timeInterval = other.timeInterval;
+    windowStart = other.windowStart;
+    windowEnd = other.windowEnd;
+    trigger = other.trigger;
+    holdTime = other.holdTime;
+    nextLogTime = other.nextLogTime;
+    lastTriggerTime = other.lastTriggerTime;
+    lastIteration = other.lastIteration;
+    lastDecision = other.lastDecision;
+    return *this;
+}
+
+LogPolicy &LogPolicy::everyTicks(unsigned int n) {
+    REQUIRE(properlyInitialized(), "LogPolicy is properly initialized");
+    REQUIRE(n > 0, "n is larger than zero");
+    tickInterval = n;
+    return *this;
+}
+
+LogPolicy &LogPolicy::everySeconds(double t) {
+    REQUIRE(properlyInitialized(), "LogPolicy is properly initialized");
+    REQUIRE(t >= 0, "t is positive or zero");
+    timeInterval = t;
+    return *this;
+}
+
+LogPolicy &LogPolicy::window(double t0, double t1) {
+    REQUIRE(properlyInitialized(), "LogPolicy is properly initialized");
+    REQUIRE(t0 <= t1, "window is not empty");
+    windowStart = t0;
+    windowEnd = t1;
+    return *this;
+}
+
+LogPolicy &LogPolicy::onEvent(const Trigger &event, double hold) {
+    REQUIRE(properlyInitialized(), "LogPolicy is properly initialized");
+    REQUIRE(hold >= 0, "hold is positive or zero");
+    trigger = event;
+    holdTime = hold;
+    return *this;
+}
+
+bool LogPolicy::shouldLog(const Simulation &sim) {
+    REQUIRE(properlyInitialized(), "LogPolicy is properly initialized");
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+
+    const unsigned int iteration = sim.getIteration();
+    if ((long long) iteration == lastIteration) return lastDecision;
+    lastIteration = iteration;
+    lastDecision = false;
+
+    // cheapest checks first, the trigger may have to look at the whole simulation
+    const double time = iteration * sim.getStepSize();
+    if (time < windowStart || time > windowEnd) return false;
+    if (iteration % tickInterval != 0) return false;
+
+    if (trigger) {
+        if (trigger(sim)) lastTriggerTime = time;
+        if (time - lastTriggerTime > holdTime) return false;
+    }
+
+    if (timeInterval > 0) {
+        if (time < nextLogTime) return false;
+        nextLogTime = time + timeInterval;
+    }
+
+    lastDecision = true;
+    return true;
+}
+
+LogPolicy::Trigger LogPolicy::queueForms(unsigned int minVehicles, double maxVelocity) {
+    return [minVehicles, maxVelocity](const Simulation &sim) {
+        // idle roads cannot hold a queue
+        for (const id roadId : sim.getActiveRoads()) {
+            const std::list<id> &vehicleIds = sim.getVehiclesOnRoads().at(roadId);
+            if (vehicleIds.size() < minVehicles) continue;
+
+            unsigned int slowVehicles = 0;
+            for (const id vehicleId : vehicleIds) {
+                if (sim.getVehicles().at(vehicleId).getVelocity() < maxVelocity) ++slowVehicles;
+            }
+            if (slowVehicles >= minVehicles) return true;
+        }
+        return false;
+    };
+}
+
+bool LogPolicy::properlyInitialized() const { return _initCheck == this; }
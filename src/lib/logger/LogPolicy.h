@@ -0,0 +1,113 @@
+//============================================================================
+// Name        : LogPolicy.h
+// Description : Decides which frames of a simulation run are written by the Logger
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/22
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_LOGPOLICY_H
+#define SE_PROJECT_LOGPOLICY_H
+
+#include <functional>
+#include <limits>
+
+class Simulation;
+
+/**
+ * @brief Decides whether the current frame of a simulation should be logged, before any formatting is done. \n
+ * A frame is logged when all the configured conditions hold: it lies inside the time window, the tick/time cadence is
+ * met and (when a trigger is set) the trigger fired less than holdTime seconds ago. By default every frame is logged.
+ */
+class LogPolicy {
+  public:
+    typedef std::function<bool(const Simulation &)> Trigger;
+
+  private:
+    unsigned int tickInterval = 1;  // log every n-th tick
+    double timeInterval = 0;        // log at most every t simulated seconds (0: disabled)
+    double windowStart = 0;         // first simulated second to log
+    double windowEnd = std::numeric_limits<double>::infinity();  // last simulated second to log
+
+    Trigger trigger;      // event that enables logging (empty: always enabled)
+    double holdTime = 0;  // seconds logging stays enabled after the trigger fired
+
+    double nextLogTime = 0;                                               // next time allowed by the time interval
+    double lastTriggerTime = -std::numeric_limits<double>::infinity();  // time the trigger last fired
+    long long lastIteration = -1;                                       // iteration of the last decision
+    bool lastDecision = false;                                          // decision made for lastIteration
+
+    const LogPolicy *_initCheck;
+
+  public:
+    /**
+     * Creates a policy that logs every frame \n
+     * ENSURE(properlyInitialized(), "LogPolicy is properly initialized");
+     */
+    LogPolicy();
+
+    LogPolicy(const LogPolicy &other);
+
+    LogPolicy &operator=(const LogPolicy &other);
+
+    /**
+     * Only log every n-th tick \n
+     * REQUIRE(properlyInitialized(), "LogPolicy is properly initialized"); \n
+     * REQUIRE(n > 0, "n is larger than zero");
+     * @param n tick interval
+     * @return this policy
+     */
+    LogPolicy &everyTicks(unsigned int n);
+
+    /**
+     * Log at most once every t simulated seconds \n
+     * REQUIRE(properlyInitialized(), "LogPolicy is properly initialized"); \n
+     * REQUIRE(t >= 0, "t is positive or zero");
+     * @param t time interval in seconds (0 disables the interval)
+     * @return this policy
+     */
+    LogPolicy &everySeconds(double t);
+
+    /**
+     * Only log frames with a simulated time inside [t0, t1] \n
+     * REQUIRE(properlyInitialized(), "LogPolicy is properly initialized"); \n
+     * REQUIRE(t0 <= t1, "window is not empty");
+     * @param t0 start of the window in seconds
+     * @param t1 end of the window in seconds
+     * @return this policy
+     */
+    LogPolicy &window(double t0, double t1);
+
+    /**
+     * Only log while the trigger fires, and for hold seconds after it last fired \n
+     * REQUIRE(properlyInitialized(), "LogPolicy is properly initialized"); \n
+     * REQUIRE(hold >= 0, "hold is positive or zero");
+     * @param event trigger, evaluated for every frame that is inside the window and meets the tick interval
+     * @param hold amount of simulated seconds logging stays enabled after the trigger fired
+     * @return this policy
+     */
+    LogPolicy &onEvent(const Trigger &event, double hold = 0);
+
+    /**
+     * Decides whether the current frame of the simulation must be logged. Asking again in the same iteration returns
+     * the same answer. \n
+     * REQUIRE(properlyInitialized(), "LogPolicy is properly initialized"); \n
+     * REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+     * @param sim simulation that is about to be logged
+     * @return true if the frame must be logged
+     */
+    bool shouldLog(const Simulation &sim);
+
+    /**
+     * Trigger that fires when a queue forms: at least minVehicles vehicles on one road drive slower than maxVelocity.
+     * @param minVehicles amount of slow vehicles on a road that make up a queue
+     * @param maxVelocity velocity (m/s) under which a vehicle is considered queued
+     * @return trigger to be used with onEvent
+     */
+    static Trigger queueForms(unsigned int minVehicles, double maxVelocity = 0.1);
+
+    bool properlyInitialized() const;
+};
+
+#endif  // SE_PROJECT_LOGPOLICY_H
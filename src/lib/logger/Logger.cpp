@@ -9,88 +9,79 @@
 
 #include "Logger.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include "../../objects/crossroad/CrossRoadObject.h"
 #include "../../objects/entities/busStop/BusStopEntity.h"
 #include "../../objects/entities/light/LightEntity.h"
 #include "../../objects/entities/vehicle/VehicleEntity.h"
 #include "../../objects/road/RoadObject.h"
+#include "../../objects/road/RoadView.h"
 #include "../nlohmann-json/json.hpp"
+#include "../stream/RecordingWriter.h"
 #include "../utils/Id.h"
+#include "../utils/Span.h"
 #include "../xml-validator/Validator.h"
 
 void Logger::logAsJson(const Simulation &sim, std::ostream &outStream) {
+    StreamSink sink(outStream);
+    logAsJson(sim, sink);
+}
+
+void Logger::logAsJson(const Simulation &sim, OutputSink &sink) {
     REQUIRE(!sim.getRoads().empty(), "Simulation roads should not be empty");
     REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    SIM_PROFILE_SCOPE(sim.getProfiler(), EPhase::kLogJson, sim.getVehicles().size());
     // create json array for roads
     nlohmann::json roadsJson = nlohmann::json::array();
     for (const std::pair<const id, RoadObject> &roadPair : sim.getRoads()) {
-        // Create json array for cars
-        nlohmann::json carsJson = nlohmann::json::array();
-        // For all cars
-        for (const std::pair<const id, VehicleEntity> &vehiclePair : sim.getVehicles()) {
-            std::pair<id, double> temp = sim.getWorld().at(vehiclePair.first);
-            // If car is not on current road, ignore
-            if (temp.first != roadPair.second.getId()) continue;
-            // Else create car object and append to car array
-
-            // Transelate string to type
-            std::string carType;
-            EVehicleEntityTypes type = vehiclePair.second.getType();
-
-            if (type == EVehicleEntityTypes::kCar) {
-                carType = "car";
-            } else if (type == EVehicleEntityTypes::kBus) {
-                carType = "bus";
-            } else if (type == EVehicleEntityTypes::kFireTruck) {
-                carType = "firetruck";
-            } else if (type == EVehicleEntityTypes::kAmbulance) {
-                carType = "ambulance";
-            } else if (type == EVehicleEntityTypes::kPoliceCruiser) {
-                carType = "police_cruiser";
-            }
+        // the view presents the vehicles and lights of the road as spans, without looking them up
+        const RoadView view = sim.getRoadView(roadPair.first);
+        const Span<double> positions = view.getPositions();
+        const Span<EVehicleEntityTypes> types = view.getTypes();
 
-            nlohmann::json carJson = nlohmann::json::object({{"x", temp.second}, {"type", carType}});
+        // Create json array for the cars on the road
+        nlohmann::json carsJson = nlohmann::json::array();
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            // Create car object and append to the car array
+            nlohmann::json carJson =
+              nlohmann::json::object({{"x", positions[i]}, {"type", vehicleTypeToName(types[i])}});
             carsJson.insert(carsJson.end(), carJson);
         }
 
+        const RoadFeatures &features = sim.getRoadFeatures(roadPair.first);
+
         // Create json array for lights
         nlohmann::json lightsJson = nlohmann::json::array();
-        // For all lights
-        for (const std::pair<const id, LightEntity> &lightPair : sim.getLights()) {
-            std::pair<id, double> temp = sim.getWorld().at(lightPair.first);
-            // If light is not on current road, ignore
-            if (temp.first != roadPair.second.getId()) continue;
-            // Else create light object and append to light array
-            nlohmann::json lightJson = nlohmann::json::object({{"x", sim.getWorld().at(lightPair.first).second},
+        const Span<double> lightPositions = view.getLightPositions();
+        const Span<unsigned char> lightsGreen = view.getLightsGreen();
+        // For all lights on the road
+        for (std::size_t i = 0; i < lightPositions.size(); ++i) {
+            // create light object and append to light array
+            nlohmann::json lightJson = nlohmann::json::object({{"x", lightPositions[i]},
                                                                // FIXME remove placeholder
-                                                               {"green", (lightPair.second.isGreen()) ? 1 : 0},
+                                                               {"green", lightsGreen[i] ? 1 : 0},
                                                                {"xs", 50},
                                                                {"xs0", 15}});
             lightsJson.insert(lightsJson.end(), lightJson);
         }
 
         // FIXME: temp fix for busstops: hijacked the lights logic
-        // For all busstops
-        for (const std::pair<const id, BusStopEntity> &busStopPair : sim.getBusstops()) {
-            std::pair<id, double> temp = sim.getWorld().at(busStopPair.first);
-            // If busstop is not on current road, ignore
-            if (temp.first != roadPair.second.getId()) continue;
-            // Else create light object and append to light array
-            nlohmann::json lightJson = nlohmann::json::object({{"x", sim.getWorld().at(busStopPair.first).second},
+        // For all busstops on the road
+        for (const StaticFeature<BusStopEntity> &busStop : features.busStops) {
+            // create light object and append to light array
+            nlohmann::json lightJson = nlohmann::json::object({{"x", busStop.position},
                                                                // FIXME remove placeholder
                                                                {"green", 0}});
             lightsJson.insert(lightsJson.end(), lightJson);
         }
 
         // FIXME: temp fix for crossroads: hijacked the lights logic
-        // For all crossRoads
-        for (const std::pair<const id, CrossRoadObject> &crossRoadPair : sim.getCrossRoads()) {
-            std::pair<id, double> temp = sim.getWorld().at(crossRoadPair.first);
-            // If busstop is not on current road, ignore
-            if (temp.first != roadPair.second.getId()) continue;
-            // Else create light object and append to light array
-            nlohmann::json lightJson = nlohmann::json::object({{"x", sim.getWorld().at(crossRoadPair.first).second},
+        // For all crossRoads on the road
+        for (const CrossRoadFeature &crossRoad : features.crossRoads) {
+            // create light object and append to light array
+            nlohmann::json lightJson = nlohmann::json::object({{"x", crossRoad.position},
                                                                // FIXME remove placeholder
                                                                {"green", 1}});
             lightsJson.insert(lightsJson.end(), lightJson);
@@ -99,23 +90,32 @@ void Logger::logAsJson(const Simulation &sim, std::ostream &outStream) {
         // Insert cars and light arrays, road name and length into road object
         nlohmann::json roadJson = nlohmann::json::object({{"name", roadPair.second.getName()},
                                                           {"length", roadPair.second.getLength()},
-                                                          {"cars", carsJson},
+                                                          {"cars", std::move(carsJson)},
                                                           {"lights", lightsJson}});
         // Insert road object into roads array
         roadsJson.insert(roadsJson.end(), roadJson);
     }
     // Place roads and current timestamp in frame object
-    nlohmann::json frame = nlohmann::json::object({{"roads", roadsJson}, {"time", sim.getIteration() * (1.0 / 60.0)}});
+    nlohmann::json frame =
+        nlohmann::json::object({{"roads", roadsJson}, {"time", sim.getIteration() * sim.getStepSize()}});
 
-    // Output finished json frame to ostream.
-    outStream << frame.dump() << "\n";
+    // Output finished json frame to the sink.
+    sink.write(frame.dump());
+    sink.put('\n');
 }
 
 void Logger::logSimpleOutput(const Simulation &sim, std::ostream &outStream) {
+    StreamSink sink(outStream);
+    logSimpleOutput(sim, sink);
+}
+
+void Logger::logSimpleOutput(const Simulation &sim, OutputSink &sink) {
     REQUIRE(!sim.getRoads().empty(), "Simulation roads should not be empty");
     REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
-    // FIXME: make stepSize constant for all classes not separated
-    outStream << "Time: " << sim.getIteration() * (1.0 / 60.0) << 's' << "\n";
+    SIM_PROFILE_SCOPE(sim.getProfiler(), EPhase::kLogSimple, sim.getVehicles().size());
+    sink.write("Time: ", 6);
+    sink.writeNumber(sim.getIteration() * sim.getStepSize());
+    sink.write("s\n", 2);
 
     unsigned int counter = 0;
     for (const std::pair<const id, VehicleEntity> &vehiclePair : sim.getVehicles()) {
@@ -125,143 +125,237 @@ void Logger::logSimpleOutput(const Simulation &sim, std::ostream &outStream) {
         const std::string roadName = sim.roadIdToName(sim.getWorld().at(vehiclePair.second.getId()).first);
         const double velocity = vehiclePair.second.getVelocity();
 
-        outStream << "Vehicle " << counter << "\n";
-        outStream << "--> road: " << roadName << "\n";
-        outStream << "--> position: " << vehiclePosition << "\n";
-        outStream << "--> speed: " << velocity << "\n";
-
-        outStream << "\n";
+        sink.write("Vehicle ", 8);
+        sink.writeNumber(static_cast<unsigned long long>(counter));
+        sink.write("\n--> road: ", 11);
+        sink.write(roadName);
+        sink.write("\n--> position: ", 15);
+        sink.writeNumber(vehiclePosition);
+        sink.write("\n--> speed: ", 12);
+        sink.writeNumber(velocity);
+        sink.write("\n\n", 2);
     }
 }
 
 void Logger::logAdvancedOutput(const Simulation &sim, std::ostream &outStream, int rowSize) {
+    StreamSink sink(outStream);
+    logAdvancedOutput(sim, sink, rowSize);
+}
+
+void Logger::logAdvancedOutput(const Simulation &sim, OutputSink &sink, int rowSize) {
     REQUIRE(!sim.getRoads().empty(), "Simulation roads should not be empty");
     REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
     REQUIRE(rowSize >= -1, "row size is -1 or larger");
+    SIM_PROFILE_SCOPE(sim.getProfiler(), EPhase::kLogAdvanced, sim.getVehicles().size());
+
+    // get size of the largest road
+    double currentLargest = 0;
+    for (std::unordered_map<id, RoadObject>::const_iterator it = sim.getRoads().begin(); it != sim.getRoads().end();
+         ++it) {
+        if (it->second.getLength() > currentLargest) { currentLargest = it->second.getLength(); }
+    }
 
     // calculate size of a char
     double charSize;
     if (rowSize == -1) {
-        double currentLargest = 0;
-        // get size of the largest road
-        for (std::unordered_map<id, RoadObject>::const_iterator it = sim.getRoads().begin(); it != sim.getRoads().end();
-             ++it) {
-            if (it->second.getLength() > currentLargest) { currentLargest = it->second.getLength(); }
-        }
         rowSize = currentLargest;
         charSize = 1;
     } else {
-        double currentLargest = 0;
-        // get size of the largest road
-        for (std::unordered_map<id, RoadObject>::const_iterator it = sim.getRoads().begin(); it != sim.getRoads().end();
-             ++it) {
-            if (it->second.getLength() > currentLargest) { currentLargest = it->second.getLength(); }
-        }
         charSize = currentLargest / rowSize;
     }
 
+    // the three rows of a road, reused for every road so a frame allocates once
+    std::string vehicleRow;
+    std::string lightRow;
+    std::string busStopRow;
+    std::string line;
+
     for (const std::pair<const id, RoadObject> &roadPair : sim.getRoads()) {
-        std::vector<char> l1(rowSize);
-        const std::list<id> &vehiclesOnCurrentRoad = sim.getVehiclesOnRoads().at(roadPair.first);
-        for (int i = 0; i < std::round(roadPair.second.getLength() / charSize); ++i) {
-            // For all cars
-            char vehicleChar = '=';  // last vehicle we find is this one;
-
-            for (std::list<id>::const_iterator it = vehiclesOnCurrentRoad.begin(); it != vehiclesOnCurrentRoad.end();
-                 ++it) {
-                if (std::round(sim.getWorld().at(*it).second / charSize) == i) {
-                    // show car on this location
-                    vehicleChar = vehicleTypeToLetter(sim.getVehicles().at(*it).getType());
-                }
+        // amount of cells this road spans, never more than the row can hold
+        const int cells = std::min((double) rowSize, std::round(roadPair.second.getLength() / charSize));
+
+        // scatter every entity into its cell, when two entities share a cell the last one (furthest along) is shown
+        vehicleRow.assign(cells, '=');
+        if (sim.isRoadActive(roadPair.first)) {
+            for (const id vehicleId : sim.getVehiclesOnRoads().at(roadPair.first)) {
+                const int cell = getCharPosition(sim.getWorld().at(vehicleId).second, charSize, cells);
+                if (cell != -1) vehicleRow[cell] = vehicleTypeToLetter(sim.getVehicles().at(vehicleId).getType());
             }
-
-            l1[i] = vehicleChar;
         }
 
-        std::vector<char> l3(rowSize);
-        const std::list<id> &busstopsOnCurrentRoad = sim.getBusstopsOnRoads().at(roadPair.first);
-        for (int i = 0; i < std::round(roadPair.second.getLength() / charSize); i++) {
-            // For all busstops
-            bool shouldPush = false;
-            for (std::list<id>::const_iterator it = busstopsOnCurrentRoad.begin(); it != busstopsOnCurrentRoad.end();
-                 ++it) {
-                if (std::round(sim.getWorld().at(*it).second / charSize) == i) {
-                    // show bus (B) on this location
-                    shouldPush = true;
-                }
-            }
+        const RoadFeatures &features = sim.getRoadFeatures(roadPair.first);
 
-            if (shouldPush)
-                l3[i] = 'B';
-            else
-                l3[i] = ' ';
+        busStopRow.assign(cells, ' ');
+        for (const StaticFeature<BusStopEntity> &busStop : features.busStops) {
+            const int cell = getCharPosition(busStop.position, charSize, cells);
+            if (cell != -1) busStopRow[cell] = 'B';
         }
 
-        std::vector<char> l2(rowSize);
-        const std::list<id> &lightsOnCurrentRoad = sim.getLightsOnRoads().at(roadPair.first);
-        for (int i = 0; i < std::round(roadPair.second.getLength() / charSize); i++) {
-            // for all lights on this road
-            char pushChar = ' ';
-
-            for (std::list<id>::const_iterator it = lightsOnCurrentRoad.begin(); it != lightsOnCurrentRoad.end();
-                 ++it) {
-                // if light exists
-                if (std::round(sim.getWorld().at(*it).second / charSize) == i) {
-                    // place G for green light or R for red light
-                    if (sim.getLights().at(*it).isGreen()) {
-                        pushChar = 'B';
-                    } else {
-                        pushChar = 'R';
-                    }
-                }
-            }
+        // place B for green light or R for red light, bus stops without a light are marked with |
+        lightRow.assign(cells, ' ');
+        for (const StaticFeature<LightEntity> &light : features.lights) {
+            const int cell = getCharPosition(light.position, charSize, cells);
+            if (cell != -1) lightRow[cell] = light.entity->isGreen() ? 'B' : 'R';
+        }
+        for (int i = 0; i < cells; ++i) {
+            if (lightRow[i] == ' ' && busStopRow[i] != ' ') lightRow[i] = '|';
+        }
 
-            l2[i] = pushChar;
-            if (l2[i] == ' ' && l3[i] != ' ') { l2[i] = '|'; }
+        const std::string &name = roadPair.second.getName();
+        const std::string lightsLabel = " > verkeerslichten";
+        const std::string busStopsLabel = " > bushaltes";
+        const std::size_t longest = std::max(name.length(), std::max(lightsLabel.length(), busStopsLabel.length()));
+
+        // write every row with a single call
+        const std::string *labels[] = {&name, &lightsLabel, &busStopsLabel};
+        const std::string *rows[] = {&vehicleRow, &lightRow, &busStopRow};
+        for (int i = 0; i < 3; ++i) {
+            line.assign(*labels[i]);
+            line.append(longest - labels[i]->length() + 2, ' ');
+            line.append("| ");
+            line.append(*rows[i]);
+            line.push_back('\n');
+            sink.write(line);
         }
+        sink.put('\n');
+    }
 
-        std::vector<std::string> outputCats;
-        outputCats.push_back(roadPair.second.getName());
-        outputCats.push_back(" > verkeerslichten");
-        outputCats.push_back(" > bushaltes");
+    sink.put('\n');
+}
 
-        unsigned int longest = 0;
+void Logger::logAsBinary(const Simulation &sim, std::ostream &outStream) {
+    StreamSink sink(outStream);
+    logAsBinary(sim, sink);
+}
 
-        for (unsigned int i = 1; i < outputCats.size(); ++i) {
-            if (outputCats[i].length() > outputCats[longest].length()) { longest = i; }
-        }
+void Logger::logAsBinary(const Simulation &sim, OutputSink &sink) {
+    REQUIRE(!sim.getRoads().empty(), "Simulation roads should not be empty");
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    SIM_PROFILE_SCOPE(sim.getProfiler(), EPhase::kLogBinary, sim.getVehicles().size());
 
-        longest = outputCats[longest].length();
+    const uint32_t iteration = sim.getIteration();
+    const double time = sim.getIteration() * sim.getStepSize();
+    const uint32_t vehicleCount = sim.getVehicles().size();
 
-        unsigned int spacesToAdd;
+    sink.writeValue(iteration);
+    sink.writeValue(time);
+    sink.writeValue(vehicleCount);
 
-        spacesToAdd = longest - outputCats[0].length() + 2;
-        outStream << outputCats[0] << std::string(spacesToAdd, ' ') << '|' << ' ';
-        for (std::vector<char>::const_iterator it = l1.begin(); it != l1.end(); ++it) {
-            if (*it == '\0') break;
-            outStream << *it;
-        }
-        outStream << '\n';
+    for (const std::pair<const id, VehicleEntity> &vehiclePair : sim.getVehicles()) {
+        const std::pair<id, double> &location = sim.getWorld().at(vehiclePair.first);
 
-        spacesToAdd = longest - outputCats[1].length() + 2;
-        outStream << outputCats[1] << std::string(spacesToAdd, ' ') << '|' << ' ';
-        for (std::vector<char>::const_iterator it = l2.begin(); it != l2.end(); ++it) {
-            if (*it == '\0') break;
-            outStream << *it;
-        }
-        outStream << '\n';
+        const uint32_t vehicleId = vehiclePair.first;
+        const uint32_t roadId = location.first;
+        const double position = location.second;
+        const double velocity = vehiclePair.second.getVelocity();
+        const uint8_t type = vehiclePair.second.getType();
 
-        spacesToAdd = longest - outputCats[2].length() + 2;
-        outStream << outputCats[2] << std::string(spacesToAdd, ' ') << '|' << ' ';
-        for (std::vector<char>::const_iterator it = l3.begin(); it != l3.end(); ++it) {
-            if (*it == '\0') break;
-            outStream << *it;
-        }
-        outStream << '\n';
-        outStream << '\n';
+        sink.writeValue(vehicleId);
+        sink.writeValue(roadId);
+        sink.writeValue(position);
+        sink.writeValue(velocity);
+        sink.writeValue(type);
     }
 
-    outStream << '\n';
+    const uint32_t lightCount = sim.getLights().size();
+    sink.writeValue(lightCount);
+
+    for (const std::pair<const id, LightEntity> &lightPair : sim.getLights()) {
+        const uint32_t lightId = lightPair.first;
+        const uint8_t green = lightPair.second.isGreen();
+
+        sink.writeValue(lightId);
+        sink.writeValue(green);
+    }
+}
+
+void Logger::logAsDelta(const Simulation &sim, std::ostream &outStream, RecordingWriter &recording) {
+    StreamSink sink(outStream);
+    logAsDelta(sim, sink, recording);
+}
+
+void Logger::logAsDelta(const Simulation &sim, OutputSink &sink, RecordingWriter &recording) {
+    REQUIRE(!sim.getRoads().empty(), "Simulation roads should not be empty");
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    SIM_PROFILE_SCOPE(sim.getProfiler(), EPhase::kLogDelta, sim.getVehicles().size());
+    recording.write(sim, sink);
+}
+
+bool Logger::logAsJson(const Simulation &sim, std::ostream &outStream, LogPolicy &policy) {
+    StreamSink sink(outStream);
+    return logAsJson(sim, sink, policy);
+}
+
+bool Logger::logSimpleOutput(const Simulation &sim, std::ostream &outStream, LogPolicy &policy) {
+    StreamSink sink(outStream);
+    return logSimpleOutput(sim, sink, policy);
+}
+
+bool Logger::logAdvancedOutput(const Simulation &sim, std::ostream &outStream, LogPolicy &policy, int rowSize) {
+    StreamSink sink(outStream);
+    return logAdvancedOutput(sim, sink, policy, rowSize);
+}
+
+bool Logger::logAsBinary(const Simulation &sim, std::ostream &outStream, LogPolicy &policy) {
+    StreamSink sink(outStream);
+    return logAsBinary(sim, sink, policy);
+}
+
+bool Logger::logAsDelta(const Simulation &sim, std::ostream &outStream, RecordingWriter &recording,
+                        LogPolicy &policy) {
+    StreamSink sink(outStream);
+    return logAsDelta(sim, sink, recording, policy);
+}
+
+bool Logger::logAsJson(const Simulation &sim, OutputSink &sink, LogPolicy &policy) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    if (!policy.shouldLog(sim)) return false;
+    logAsJson(sim, sink);
+    return true;
+}
+
+bool Logger::logSimpleOutput(const Simulation &sim, OutputSink &sink, LogPolicy &policy) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    if (!policy.shouldLog(sim)) return false;
+    logSimpleOutput(sim, sink);
+    return true;
+}
+
+bool Logger::logAdvancedOutput(const Simulation &sim, OutputSink &sink, LogPolicy &policy, int rowSize) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    if (!policy.shouldLog(sim)) return false;
+    logAdvancedOutput(sim, sink, rowSize);
+    return true;
+}
+
+bool Logger::logAsBinary(const Simulation &sim, OutputSink &sink, LogPolicy &policy) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    if (!policy.shouldLog(sim)) return false;
+    logAsBinary(sim, sink);
+    return true;
+}
+
+bool Logger::logAsDelta(const Simulation &sim, OutputSink &sink, RecordingWriter &recording, LogPolicy &policy) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    if (!policy.shouldLog(sim)) return false;
+    logAsDelta(sim, sink, recording);
+    return true;
+}
+
+const char *Logger::vehicleTypeToName(EVehicleEntityTypes type) {
+    switch (type) {
+        case kCar:
+            return "car";
+        case kBus:
+            return "bus";
+        case kFireTruck:
+            return "firetruck";
+        case kAmbulance:
+            return "ambulance";
+        case kPoliceCruiser:
+            return "police_cruiser";
+    }
+    return "";
 }
 
 char Logger::vehicleTypeToLetter(EVehicleEntityTypes type) {
@@ -291,6 +385,8 @@ char Logger::vehicleTypeToLetter(EVehicleEntityTypes type) {
     }
 }
 
-unsigned int Logger::getCharPosition(const double position, const double charSize) {
-    return std::round(position / charSize);
+int Logger::getCharPosition(const double position, const double charSize, const int cells) {
+    const double cell = std::round(position / charSize);
+    if (cell >= 0 && cell < cells) return cell;
+    return -1;
 }
\ No newline at end of file
@@ -11,10 +11,14 @@
 #define SE_PROJECT_JSONLOG_H
 
 #include "../../Simulation.h"
+#include "LogPolicy.h"
+#include "OutputSink.h"
 
 #include <list>
 #include <string>
 
+class RecordingWriter;
+
 /**
  * @brief Static helper class for logging \n
  * @throws std::runtime_error If xml input is invalid
@@ -50,10 +54,123 @@ class Logger {
      */
     static void logAdvancedOutput(const Simulation &sim, std::ostream &outStream, int rowSize = -1);
 
+    /**
+     * Writes the simulation state to the given ostream as one binary frame (native byte order). \n
+     * Frame layout: \n
+     * uint32 iteration, float64 time, uint32 vehicleCount, vehicleCount * {uint32 id, uint32 roadId, float64 position,
+     * float64 velocity, uint8 type}, uint32 lightCount, lightCount * {uint32 id, uint8 green} \n
+     * REQUIRE(!getRoads().empty(), "Simulation roads should not be empty"); \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param sim instance of simulation
+     * @param outStream outputStream to write to (should be opened in binary mode)
+     */
+    static void logAsBinary(const Simulation &sim, std::ostream &outStream);
+
+    /**
+     * Writes the simulation state to the given ostream as json lines that only carry what changed, see DeltaEncoder
+     * for the messages. The first call writes the topology and a keyframe, every next call a delta against the
+     * previous call or a periodic keyframe, see RecordingWriter. DeltaDecoder turns them back into the frames of
+     * logAsJson. \n
+     * REQUIRE(!getRoads().empty(), "Simulation roads should not be empty"); \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @param sim instance of simulation
+     * @param outStream outputStream to write to
+     * @param recording recording of the simulation, remembers what was written before
+     */
+    static void logAsDelta(const Simulation &sim, std::ostream &outStream, RecordingWriter &recording);
+
+    // ╔════════════════════════════════════════╗
+    // ║          Policy driven logging         ║
+    // ╚════════════════════════════════════════╝
+    // These variants ask the policy first and skip all formatting work when the frame is not needed.
+
+    /**
+     * logAsJson, only when the policy accepts the current frame \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return true if the frame was written
+     */
+    static bool logAsJson(const Simulation &sim, std::ostream &outStream, LogPolicy &policy);
+
+    /**
+     * logSimpleOutput, only when the policy accepts the current frame \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return true if the frame was written
+     */
+    static bool logSimpleOutput(const Simulation &sim, std::ostream &outStream, LogPolicy &policy);
+
+    /**
+     * logAdvancedOutput, only when the policy accepts the current frame \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return true if the frame was written
+     */
+    static bool logAdvancedOutput(const Simulation &sim, std::ostream &outStream, LogPolicy &policy, int rowSize = -1);
+
+    /**
+     * logAsBinary, only when the policy accepts the current frame \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return true if the frame was written
+     */
+    static bool logAsBinary(const Simulation &sim, std::ostream &outStream, LogPolicy &policy);
+
+    /**
+     * logAsDelta, only when the policy accepts the current frame (the next delta holds the changes since the last
+     * written frame) \n
+     * REQUIRE(properlyInitialized(), "Simulation is properly initialized");
+     * @return true if the frame was written
+     */
+    static bool logAsDelta(const Simulation &sim, std::ostream &outStream, RecordingWriter &recording,
+                           LogPolicy &policy);
+
+    // ╔════════════════════════════════════════╗
+    // ║           Output sink logging          ║
+    // ╚════════════════════════════════════════╝
+    // The same formats written to an OutputSink, the variants above write to their ostream through a StreamSink.
+
+    /// logAsJson to a sink
+    static void logAsJson(const Simulation &sim, OutputSink &sink);
+
+    /// logSimpleOutput to a sink
+    static void logSimpleOutput(const Simulation &sim, OutputSink &sink);
+
+    /// logAdvancedOutput to a sink
+    static void logAdvancedOutput(const Simulation &sim, OutputSink &sink, int rowSize = -1);
+
+    /// logAsBinary to a sink
+    static void logAsBinary(const Simulation &sim, OutputSink &sink);
+
+    /// logAsDelta to a sink
+    static void logAsDelta(const Simulation &sim, OutputSink &sink, RecordingWriter &recording);
+
+    /// logAsJson to a sink, only when the policy accepts the current frame
+    static bool logAsJson(const Simulation &sim, OutputSink &sink, LogPolicy &policy);
+
+    /// logSimpleOutput to a sink, only when the policy accepts the current frame
+    static bool logSimpleOutput(const Simulation &sim, OutputSink &sink, LogPolicy &policy);
+
+    /// logAdvancedOutput to a sink, only when the policy accepts the current frame
+    static bool logAdvancedOutput(const Simulation &sim, OutputSink &sink, LogPolicy &policy, int rowSize = -1);
+
+    /// logAsBinary to a sink, only when the policy accepts the current frame
+    static bool logAsBinary(const Simulation &sim, OutputSink &sink, LogPolicy &policy);
+
+    /// logAsDelta to a sink, only when the policy accepts the current frame
+    static bool logAsDelta(const Simulation &sim, OutputSink &sink, RecordingWriter &recording, LogPolicy &policy);
+
+    /**
+     * Name of a vehicle type in the json frames
+     * @param type type of the vehicle
+     * @return car, bus, firetruck, ambulance or police_cruiser
+     */
+    static const char *vehicleTypeToName(EVehicleEntityTypes type);
+
   private:
     static char vehicleTypeToLetter(EVehicleEntityTypes type);
 
-    static unsigned int getCharPosition(const double position, const double charSize);
+    /**
+     * Cell of the advanced output an entity at the given position falls in
+     * @return index of the cell, or -1 when the position does not map onto one of the cells
+     */
+    static int getCharPosition(const double position, const double charSize, const int cells);
 };
 
 #endif  // SE_PROJECT_JSONLOG_H
\ No newline at end of file
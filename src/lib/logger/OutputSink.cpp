@@ -0,0 +1,159 @@
+//============================================================================
+// Name        : OutputSink.cpp
+// Description : Implementation of the output sinks
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "OutputSink.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <stdexcept>
+
+#include "../contract/Contract.h"
+
+void OutputSink::writeNumber(double value) {
+    // %g with 6 digits, what operator<< writes for a double with the default flags
+    char text[32];
+    const std::to_chars_result result = std::to_chars(text, text + sizeof(text), value, std::chars_format::general, 6);
+    write(text, result.ptr - text);
+}
+
+void OutputSink::writeNumber(unsigned long long value) {
+    char text[24];
+    const std::to_chars_result result = std::to_chars(text, text + sizeof(text), value);
+    write(text, result.ptr - text);
+}
+
+void OutputSink::setWindow(char *begin, char *end) {
+    committed += cursor - window;
+    window = begin;
+    cursor = begin;
+    limit = end;
+}
+
+// ╔════════════════════════════════════════╗
+// ║               StreamSink               ║
+// ╚════════════════════════════════════════╝
+
+StreamSink::StreamSink(std::ostream &outStream) : outStream(outStream) { setWindow(buffer, buffer + kBufferSize); }
+
+StreamSink::~StreamSink() { drain(); }
+
+void StreamSink::flush() {
+    drain();
+    outStream.flush();
+}
+
+void StreamSink::overflow(const char *data, std::size_t size) {
+    drain();
+    if (size < kBufferSize) {
+        std::memcpy(cursor, data, size);
+        cursor += size;
+        return;
+    }
+    // a large write goes to the stream as it is
+    outStream.write(data, size);
+    committed += size;
+}
+
+void StreamSink::drain() {
+    if (cursor != window) outStream.write(window, cursor - window);
+    setWindow(buffer, buffer + kBufferSize);
+}
+
+// ╔════════════════════════════════════════╗
+// ║             MappedFileSink             ║
+// ╚════════════════════════════════════════╝
+
+namespace {
+    /// @return the size rounded up to whole pages, mappings start at a page
+    std::size_t roundToPages(std::size_t size) {
+        const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return (size + page - 1) / page * page;
+    }
+}  // namespace
+
+MappedFileSink::MappedFileSink(const std::string &path, std::size_t chunkSize)
+    : path(path), chunkSize(roundToPages(chunkSize)) {
+    REQUIRE(chunkSize > 0, "chunkSize is larger than zero");
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) throw std::runtime_error("[MappedFileSink] Cannot open '" + path + "': " + std::strerror(errno) + '.');
+    try {
+        mapChunk(0);
+    } catch (const std::runtime_error &) {
+        ::close(fd);
+        fd = -1;
+        throw;
+    }
+}
+
+MappedFileSink::~MappedFileSink() {
+    try {
+        close();
+    } catch (const std::runtime_error &) {
+        // a destructor cannot report it, call close() to see the error
+    }
+}
+
+void MappedFileSink::flush() {
+    REQUIRE(fd >= 0, "Sink is not closed");
+    // the earlier chunks were unmapped, which hands their pages to the page cache already
+    if (cursor == window) return;
+    if (::msync(window, roundToPages(cursor - window), MS_ASYNC) != 0)
+        throw std::runtime_error("[MappedFileSink] Cannot flush '" + path + "': " + std::strerror(errno) + '.');
+}
+
+void MappedFileSink::close() {
+    if (fd < 0) return;
+    const std::uint64_t bytes = getBytes();
+    unmap();
+    const int truncated = ::ftruncate(fd, static_cast<off_t>(bytes));
+    ::close(fd);
+    fd = -1;
+    if (truncated != 0)
+        throw std::runtime_error("[MappedFileSink] Cannot truncate '" + path + "': " + std::strerror(errno) + '.');
+}
+
+void MappedFileSink::overflow(const char *data, std::size_t size) {
+    REQUIRE(fd >= 0, "Sink is not closed");
+    // fill the chunk, then continue in the next ones
+    while (size > 0) {
+        if (cursor == limit) mapChunk(windowOffset + chunkSize);
+        const std::size_t part = std::min(size, static_cast<std::size_t>(limit - cursor));
+        std::memcpy(cursor, data, part);
+        cursor += part;
+        data += part;
+        size -= part;
+    }
+}
+
+void MappedFileSink::mapChunk(std::uint64_t offset) {
+    unmap();
+    // allocate the blocks of the chunk at once, so a page fault does not have to allocate them one page at a time
+    const int grown = ::posix_fallocate(fd, static_cast<off_t>(offset), static_cast<off_t>(chunkSize));
+    if (grown != 0)
+        throw std::runtime_error("[MappedFileSink] Cannot grow '" + path + "': " + std::strerror(grown) + '.');
+
+    // MAP_POPULATE was measured slower, the pages are faulted in as they are written
+    void *chunk = ::mmap(nullptr, chunkSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(offset));
+    if (chunk == MAP_FAILED)
+        throw std::runtime_error("[MappedFileSink] Cannot map '" + path + "': " + std::strerror(errno) + '.');
+    ::madvise(chunk, chunkSize, MADV_SEQUENTIAL);
+    windowOffset = offset;
+    setWindow(static_cast<char *>(chunk), static_cast<char *>(chunk) + chunkSize);
+}
+
+void MappedFileSink::unmap() {
+    if (window == nullptr) return;
+    ::munmap(window, chunkSize);
+    setWindow(nullptr, nullptr);
+}
@@ -0,0 +1,181 @@
+//============================================================================
+// Name        : OutputSink.h
+// Description : Destinations of the frames of the loggers, buffered without the iostream layer
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_OUTPUTSINK_H
+#define SE_PROJECT_OUTPUTSINK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Destination of the bytes the loggers write. \n
+ * A write copies into the window of the sink (a buffer or a mapped part of a file) without a virtual call, only a
+ * write that does not fit in the window goes to the backend. The sink does not format anything itself apart from
+ * numbers, so there is no sentry or locale per value like with std::ostream.
+ */
+class OutputSink {
+  protected:
+    char *window = nullptr;       // start of the window
+    char *cursor = nullptr;       // next free byte of the window
+    char *limit = nullptr;        // end of the window
+    std::uint64_t committed = 0;  // bytes written before the window
+
+  public:
+    virtual ~OutputSink() = default;
+
+    /**
+     * Writes the bytes
+     * @param data first byte
+     * @param size amount of bytes
+     */
+    void write(const char *data, std::size_t size) {
+        if (size <= static_cast<std::size_t>(limit - cursor)) {
+            std::memcpy(cursor, data, size);
+            cursor += size;
+            return;
+        }
+        overflow(data, size);
+    }
+
+    void write(const std::string &text) { write(text.data(), text.size()); }
+
+    void put(char c) {
+        if (cursor == limit) {
+            overflow(&c, 1);
+            return;
+        }
+        *cursor++ = c;
+    }
+
+    /// writes the bytes of the value in native byte order
+    template <typename T>
+    void writeValue(const T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be written as bytes");
+        write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    /// writes the number as std::ostream does by default (6 significant digits)
+    void writeNumber(double value);
+
+    /// writes the number in decimal
+    void writeNumber(unsigned long long value);
+
+    /// hands everything written so far to the backend
+    virtual void flush() = 0;
+
+    /// @return amount of bytes written so far
+    std::uint64_t getBytes() const { return committed + (cursor - window); }
+
+  protected:
+    /**
+     * Called when a write does not fit in the window: moves the window on and writes the bytes
+     * @param data first byte
+     * @param size amount of bytes
+     */
+    virtual void overflow(const char *data, std::size_t size) = 0;
+
+    /// starts a new window, the bytes of the old one count as written
+    void setWindow(char *begin, char *end);
+};
+
+/**
+ * @brief Sink that writes to a std::ostream through a small buffer, every write of the stream holds many values \n
+ * The buffer is written to the stream when it is full, at flush() and when the sink is destroyed.
+ */
+class StreamSink : public OutputSink {
+  public:
+    /// bytes buffered before they are written to the stream, small enough for a sink on the stack
+    static constexpr std::size_t kBufferSize = 8192;
+
+  private:
+    std::ostream &outStream;
+    char buffer[kBufferSize];
+
+  public:
+    /// @param outStream stream to write to, it outlives the sink
+    explicit StreamSink(std::ostream &outStream);
+
+    ~StreamSink() override;
+
+    StreamSink(const StreamSink &) = delete;
+    StreamSink &operator=(const StreamSink &) = delete;
+
+    /// writes the buffer to the stream and flushes the stream
+    void flush() override;
+
+  protected:
+    void overflow(const char *data, std::size_t size) override;
+
+  private:
+    /// writes the buffer to the stream
+    void drain();
+};
+
+/**
+ * @brief Sink that writes a file through a memory mapping. \n
+ * The file grows in chunks: the blocks of a chunk are allocated at once and the chunk is mapped for sequential access
+ * when the previous one is full, so the bytes are copied straight into the page cache without a system call per
+ * buffer. close() truncates the file to the bytes that were written. \n
+ * Only the current chunk is mapped, however large the file becomes. Every page still takes a page fault when it is
+ * first written, and on Linux that costs more than the copy of a write() of a StreamSink: SinkThroughput in sim_bench
+ * measures this sink slower for both binary and json frames. StreamSink stays the default and the one to use for
+ * large recordings, this sink is only worth it on a system where it measures faster. When the disk runs full while
+ * the mapping is written the process gets a SIGBUS, like any memory mapped writer.
+ * @throws std::runtime_error If the file cannot be created, grown or mapped
+ */
+class MappedFileSink : public OutputSink {
+    const std::string path;
+    const std::size_t chunkSize;
+    int fd = -1;
+    std::uint64_t windowOffset = 0;  // offset of the mapped chunk in the file
+
+  public:
+    /// default size of a chunk, large enough that growing the file is rare
+    static constexpr std::size_t kDefaultChunkSize = 64u << 20;
+
+    /**
+     * Creates (or empties) the file and maps its first chunk \n
+     * REQUIRE(chunkSize > 0, "chunkSize is larger than zero");
+     * @param path file to write
+     * @param chunkSize bytes the file grows by, rounded up to whole pages
+     */
+    explicit MappedFileSink(const std::string &path, std::size_t chunkSize = kDefaultChunkSize);
+
+    /// closes the file, see close()
+    ~MappedFileSink() override;
+
+    MappedFileSink(const MappedFileSink &) = delete;
+    MappedFileSink &operator=(const MappedFileSink &) = delete;
+
+    /**
+     * Starts writing the written bytes of the mapped chunk back to the file (msync with MS_ASYNC). Readers of the file
+     * see the bytes already, until close() the file is longer than the written bytes. The bytes survive a crash of the
+     * process, not of the system. \n
+     * REQUIRE(fd >= 0, "Sink is not closed");
+     */
+    void flush() override;
+
+    /// unmaps the file and truncates it to the written bytes, nothing can be written after it
+    void close();
+
+  protected:
+    void overflow(const char *data, std::size_t size) override;
+
+  private:
+    /// unmaps the current chunk, grows the file and maps the chunk at the offset
+    void mapChunk(std::uint64_t offset);
+
+    void unmap();
+};
+
+#endif  // SE_PROJECT_OUTPUTSINK_H
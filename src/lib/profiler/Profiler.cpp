@@ -0,0 +1,69 @@
+//============================================================================
+// Name        : Profiler.cpp
+// Description : Implementation of the phase profiler
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "Profiler.h"
+
+#include <stdexcept>
+
+bool Profiler::enabled() {
+#ifndef SIM_NO_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Profiler::reset() {
+    phases.fill(PhaseStats());
+    spawns = 0;
+    despawns = 0;
+}
+
+const char *Profiler::phaseName(EPhase phase) {
+    switch (phase) {
+        case EPhase::kGather:
+            return "gather";
+        case EPhase::kUpdate:
+            return "update";
+        case EPhase::kCommit:
+            return "commit";
+        case EPhase::kCrossRoads:
+            return "crossRoads";
+        case EPhase::kMesoLinks:
+            return "mesoLinks";
+        case EPhase::kLights:
+            return "lights";
+        case EPhase::kGenerators:
+            return "generators";
+        case EPhase::kLogJson:
+            return "logJson";
+        case EPhase::kLogSimple:
+            return "logSimple";
+        case EPhase::kLogAdvanced:
+            return "logAdvanced";
+        case EPhase::kLogBinary:
+            return "logBinary";
+        case EPhase::kLogDelta:
+            return "logDelta";
+        case EPhase::kCount:
+            break;
+    }
+    throw std::runtime_error("[Profiler] Unknown phase.");
+}
+
+void Profiler::writeJson(std::ostream &outStream) const {
+    outStream << "{\"enabled\": " << (enabled() ? "true" : "false") << ", \"spawns\": " << spawns
+              << ", \"despawns\": " << despawns << ", \"phases\": {";
+    for (std::size_t i = 0; i < phases.size(); ++i) {
+        if (i > 0) outStream << ", ";
+        outStream << '"' << phaseName(EPhase(i)) << "\": {\"ns\": " << phases[i].nanoseconds
+                  << ", \"calls\": " << phases[i].calls << ", \"items\": " << phases[i].items << '}';
+    }
+    outStream << "}}\n";
+}
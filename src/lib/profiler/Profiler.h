@@ -0,0 +1,171 @@
+//============================================================================
+// Name        : Profiler.h
+// Description : Timers and counters of the phases of a tick and of the loggers
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_PROFILER_H
+#define SE_PROJECT_PROFILER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+#include "Tracer.h"
+
+// Note: the SIM_PROFILE_* macros compile to nothing when SIM_NO_PROFILING is defined (cmake -DSIM_PROFILING=OFF), the
+// profiler then only ever reports zeros
+
+/// Phases of a tick and of the loggers that are timed separately
+enum class EPhase {
+    kGather,       // leader, light and bus stop search of every vehicle
+    kUpdate,       // car following model of every vehicle
+    kCommit,       // writing the new positions back to the world
+    kCrossRoads,   // crossroad decisions and despawning of the vehicles that left their road
+    kMesoLinks,    // queues of the mesoscopic roads
+    kLights,       // light cycles
+    kGenerators,   // vehicle generators
+    kLogJson,      // Logger::logAsJson
+    kLogSimple,    // Logger::logSimpleOutput
+    kLogAdvanced,  // Logger::logAdvancedOutput
+    kLogBinary,    // Logger::logAsBinary
+    kLogDelta,     // Logger::logAsDelta
+    kCount
+};
+
+/// Accumulated measurements of one phase
+struct PhaseStats {
+    std::uint64_t nanoseconds = 0;  // wall time spent in the phase
+    std::uint64_t calls = 0;        // times the phase ran
+    std::uint64_t items = 0;        // vehicles, links, lights or generators the phase processed
+};
+
+/**
+ * @brief Accumulates the wall time, calls and processed items per phase, and the spawned and despawned vehicles. \n
+ * A phase is measured with a ScopedTimer or with the laps of a PhaseClock, both read the clock only once per phase
+ * and never per vehicle. While a Tracer is active they also record every measurement as a span named after the phase.
+ */
+class Profiler {
+    std::array<PhaseStats, std::size_t(EPhase::kCount)> phases{};
+    std::uint64_t spawns = 0;
+    std::uint64_t despawns = 0;
+
+  public:
+    /**
+     * Adds a measurement to a phase
+     * @param phase measured phase
+     * @param nanoseconds wall time of the measurement
+     * @param items vehicles, links, lights or generators processed during the measurement
+     */
+    void add(EPhase phase, std::uint64_t nanoseconds, std::uint64_t items) {
+        PhaseStats &stats = phases[std::size_t(phase)];
+        stats.nanoseconds += nanoseconds;
+        stats.calls += 1;
+        stats.items += items;
+    }
+
+    /// counts a vehicle that entered the microscopic part of the simulation
+    void countSpawn() { ++spawns; }
+
+    /// counts a vehicle that left the microscopic part of the simulation
+    void countDespawn() { ++despawns; }
+
+    /// @return the measurements of a phase
+    const PhaseStats &get(EPhase phase) const { return phases[std::size_t(phase)]; }
+
+    /// @return vehicles that entered the microscopic part of the simulation
+    std::uint64_t getSpawns() const { return spawns; }
+
+    /// @return vehicles that left the microscopic part of the simulation
+    std::uint64_t getDespawns() const { return despawns; }
+
+    /// @return true if the measurements are built in (SIM_NO_PROFILING is not defined)
+    static bool enabled();
+
+    /// clears all measurements
+    void reset();
+
+    /**
+     * @param phase a phase
+     * @return the name of the phase, as used in the json
+     */
+    static const char *phaseName(EPhase phase);
+
+    /**
+     * Writes all measurements as one json object: {"enabled": bool, "spawns": n, "despawns": n, "phases": {name:
+     * {"ns": n, "calls": n, "items": n}, ...}}
+     * @param outStream stream to write to
+     */
+    void writeJson(std::ostream &outStream) const;
+};
+
+/// Measures the wall time from its construction to the end of its scope and adds it to a phase
+class ScopedTimer {
+    Profiler &profiler;
+    const EPhase phase;
+    const std::uint64_t items;
+    const std::chrono::steady_clock::time_point start;
+
+  public:
+    ScopedTimer(Profiler &profiler, EPhase phase, std::uint64_t items) :
+        profiler(profiler), phase(phase), items(items), start(std::chrono::steady_clock::now()) {}
+
+    ~ScopedTimer() {
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        profiler.add(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), items);
+        if (Tracer *const tracer = Tracer::active()) tracer->record(Profiler::phaseName(phase), start, end);
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+};
+
+/// Measures consecutive phases: every lap adds the time since the previous lap (or the construction) to a phase
+class PhaseClock {
+    Profiler &profiler;
+    Tracer *const tracer;  // tracer that was active when the clock started
+    std::chrono::steady_clock::time_point last;
+
+  public:
+    explicit PhaseClock(Profiler &profiler) :
+        profiler(profiler), tracer(Tracer::active()), last(std::chrono::steady_clock::now()) {}
+
+    /**
+     * Ends the current phase
+     * @param phase phase that just ended
+     * @param items vehicles, links, lights or generators processed during the phase
+     */
+    void lap(EPhase phase, std::uint64_t items) {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        profiler.add(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(now - last).count(), items);
+        if (tracer) tracer->record(Profiler::phaseName(phase), last, now);
+        last = now;
+    }
+};
+
+#define SIM_PROFILE_CONCAT_(a, b) a##b
+#define SIM_PROFILE_CONCAT(a, b) SIM_PROFILE_CONCAT_(a, b)
+
+#ifndef SIM_NO_PROFILING
+/// times the rest of the enclosing scope as the given phase
+#define SIM_PROFILE_SCOPE(profiler, phase, items) \
+    const ScopedTimer SIM_PROFILE_CONCAT(profileScope, __LINE__)((profiler), (phase), (items))
+/// starts a PhaseClock with the given name
+#define SIM_PROFILE_CLOCK(clock, profiler) PhaseClock clock((profiler))
+/// ends the current phase of a PhaseClock
+#define SIM_PROFILE_LAP(clock, phase, items) (clock).lap((phase), (items))
+/// evaluates a counting statement
+#define SIM_PROFILE_COUNT(statement) statement
+#else
+#define SIM_PROFILE_SCOPE(profiler, phase, items) static_cast<void>(0)
+#define SIM_PROFILE_CLOCK(clock, profiler) static_cast<void>(0)
+#define SIM_PROFILE_LAP(clock, phase, items) static_cast<void>(0)
+#define SIM_PROFILE_COUNT(statement) static_cast<void>(0)
+#endif
+
+#endif  // SE_PROJECT_PROFILER_H
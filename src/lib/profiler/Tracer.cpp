@@ -0,0 +1,119 @@
+//============================================================================
+// Name        : Tracer.cpp
+// Description : Implementation of the span tracer
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "Tracer.h"
+
+#include <algorithm>
+#include <array>
+
+#include "../contract/Contract.h"
+
+std::atomic<Tracer *> Tracer::activeTracer{nullptr};
+
+namespace {
+    /// tracks that belong to a running thread
+    std::array<std::atomic<bool>, Tracer::kMaxTracks> tracksInUse{};
+
+    /// the track of a thread, claimed when the thread first records and freed when it ends
+    class TrackClaim {
+      public:
+        std::uint32_t track = Tracer::kMaxTracks - 1;
+
+        TrackClaim() {
+            for (std::uint32_t candidate = 0; candidate < Tracer::kMaxTracks; ++candidate) {
+                if (!tracksInUse[candidate].exchange(true, std::memory_order_acq_rel)) {
+                    track = candidate;
+                    return;
+                }
+            }
+            // more threads than tracks, the threads beyond that share the last one (which is never freed)
+        }
+
+        ~TrackClaim() {
+            if (track != Tracer::kMaxTracks - 1) tracksInUse[track].store(false, std::memory_order_release);
+        }
+
+        TrackClaim(const TrackClaim &) = delete;
+        TrackClaim &operator=(const TrackClaim &) = delete;
+    };
+}  // namespace
+
+/// writes nanoseconds as microseconds with three decimals, the time unit of a Chrome trace
+static void writeMicroseconds(std::ostream &outStream, std::int64_t nanoseconds) {
+    const std::int64_t fraction = nanoseconds % 1000;
+    outStream << nanoseconds / 1000 << '.' << char('0' + fraction / 100) << char('0' + fraction / 10 % 10)
+              << char('0' + fraction % 10);
+}
+
+Tracer::Tracer(std::size_t capacity)
+    : events(capacity), origin(std::chrono::steady_clock::now()), mainTrack(threadIndex()) {
+    REQUIRE(capacity > 0, "capacity is larger than zero");
+}
+
+void Tracer::setActive(Tracer *tracer) { activeTracer.store(tracer, std::memory_order_release); }
+
+void Tracer::record(const char *name, std::chrono::steady_clock::time_point begin,
+                    std::chrono::steady_clock::time_point end) {
+    const std::uint64_t index = recorded.fetch_add(1, std::memory_order_relaxed);
+    Event &event = events[index % events.size()];
+    event.name = name;
+    event.begin = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - origin).count();
+    event.end = std::chrono::duration_cast<std::chrono::nanoseconds>(end - origin).count();
+    event.thread = threadIndex();
+}
+
+std::uint64_t Tracer::getRecorded() const { return recorded.load(std::memory_order_relaxed); }
+
+std::vector<Tracer::Event> Tracer::getEvents() const {
+    const std::uint64_t count = getRecorded();
+    const std::size_t kept = std::min<std::uint64_t>(count, events.size());
+
+    // once the buffer wrapped around, the oldest span is the one that is overwritten next
+    std::vector<Event> result;
+    result.reserve(kept);
+    for (std::uint64_t i = count - kept; i < count; ++i) { result.push_back(events[i % events.size()]); }
+    return result;
+}
+
+void Tracer::writeJson(std::ostream &outStream) const {
+    const std::vector<Event> spans = getEvents();
+
+    // only the tracks of the kept spans are named
+    std::array<bool, kMaxTracks> used{};
+    for (const Event &event : spans) { used[event.thread] = true; }
+
+    outStream << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    const char *separator = "";
+    for (std::uint32_t thread = 0; thread < kMaxTracks; ++thread) {
+        if (!used[thread]) continue;
+        outStream << separator << "\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread
+                  << ", \"args\": {\"name\": \"";
+        if (thread == mainTrack)
+            outStream << "main";
+        else
+            outStream << "worker " << thread;
+        outStream << "\"}}";
+        separator = ",";
+    }
+    for (const Event &event : spans) {
+        outStream << separator << "\n{\"name\": \"" << event.name << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": "
+                  << event.thread << ", \"ts\": ";
+        writeMicroseconds(outStream, event.begin);
+        outStream << ", \"dur\": ";
+        writeMicroseconds(outStream, event.end - event.begin);
+        outStream << '}';
+        separator = ",";
+    }
+    outStream << "\n]}\n";
+}
+
+std::uint32_t Tracer::threadIndex() {
+    static thread_local const TrackClaim claim;
+    return claim.track;
+}
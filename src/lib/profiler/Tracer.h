@@ -0,0 +1,130 @@
+//============================================================================
+// Name        : Tracer.h
+// Description : Ring buffer of timed spans, written as a Chrome trace
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_TRACER_H
+#define SE_PROJECT_TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief Records timed spans (a name, a begin, an end and the thread) in a ring buffer that is allocated up front. \n
+ * When the buffer is full the oldest spans are overwritten, so a long run keeps its last ticks. Recording never
+ * allocates and can happen from several threads at once. Spans are only recorded while the tracer is the active one
+ * (see setActive), the instrumented code checks that with a single load. The recorded spans are written as a Chrome
+ * trace (chrome://tracing, ui.perfetto.dev), with a track per thread.
+ */
+class Tracer {
+  public:
+    /// recorded span, the times are nanoseconds since the construction of the tracer
+    struct Event {
+        const char *name;      // name of the span, must outlive the tracer (string literals)
+        std::int64_t begin;    // start of the span
+        std::int64_t end;      // end of the span
+        std::uint32_t thread;  // track of the thread that recorded the span (see threadIndex)
+    };
+
+  private:
+    std::vector<Event> events;                    // ring buffer
+    std::atomic<std::uint64_t> recorded{0};       // spans recorded so far, the next one goes to recorded % capacity
+    const std::chrono::steady_clock::time_point origin;  // time 0 of the trace
+    const std::uint32_t mainTrack;                        // track of the thread that created the tracer
+
+    static std::atomic<Tracer *> activeTracer;
+
+  public:
+    /// most tracks handed out at once, the threads beyond that share the last track
+    static const std::uint32_t kMaxTracks = 64;
+
+    /**
+     * Creates a tracer that keeps the last capacity spans \n
+     * REQUIRE(capacity > 0, "capacity is larger than zero");
+     * @param capacity amount of spans the ring buffer holds
+     */
+    explicit Tracer(std::size_t capacity);
+
+    Tracer(const Tracer &) = delete;
+    Tracer &operator=(const Tracer &) = delete;
+
+    /// @return the tracer that records the spans of the instrumented code, nullptr when tracing is off
+    static Tracer *active() { return activeTracer.load(std::memory_order_acquire); }
+
+    /**
+     * Lets a tracer record the spans of the instrumented code, or turns tracing off. The tracer must stay alive
+     * until it is no longer active.
+     * @param tracer tracer to record to, nullptr to stop tracing
+     */
+    static void setActive(Tracer *tracer);
+
+    /**
+     * Records a span, overwriting the oldest one when the buffer is full
+     * @param name name of the span (a string literal)
+     * @param begin start of the span
+     * @param end end of the span
+     */
+    void record(const char *name, std::chrono::steady_clock::time_point begin,
+                std::chrono::steady_clock::time_point end);
+
+    /// @return amount of spans recorded so far, including the ones that were overwritten
+    std::uint64_t getRecorded() const;
+
+    /// @return the spans in the buffer, oldest first
+    std::vector<Event> getEvents() const;
+
+    /**
+     * Writes the spans in the buffer in the Chrome trace event format, as complete ("X") events. Only the tracks of
+     * those spans get a thread name: "main" for the thread that created the tracer, "worker N" for the others. Must
+     * not be called while spans are recorded.
+     * @param outStream stream to write to
+     */
+    void writeJson(std::ostream &outStream) const;
+
+    /**
+     * Returns the track of the calling thread. A thread gets the lowest free track when it first asks for one and
+     * frees it when it ends, so threads that do not run at the same time share a track and the amount of tracks
+     * stays at the amount of threads that run at once. Does not allocate.
+     * @return track of the calling thread, below kMaxTracks
+     */
+    static std::uint32_t threadIndex();
+};
+
+/// Records the span from its construction to the end of its scope, if a tracer is active
+class TraceScope {
+    Tracer *const tracer;
+    const char *const name;
+    std::chrono::steady_clock::time_point start;
+
+  public:
+    explicit TraceScope(const char *name) : tracer(Tracer::active()), name(name) {
+        if (tracer) start = std::chrono::steady_clock::now();
+    }
+
+    ~TraceScope() {
+        if (tracer) tracer->record(name, start, std::chrono::steady_clock::now());
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+};
+
+#ifndef SIM_NO_PROFILING
+/// records the rest of the enclosing scope as a span with the given name (a string literal)
+#define SIM_TRACE_SCOPE(name) const TraceScope SIM_TRACE_CONCAT(traceScope, __LINE__)((name))
+#else
+#define SIM_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
+
+#define SIM_TRACE_CONCAT_(a, b) a##b
+#define SIM_TRACE_CONCAT(a, b) SIM_TRACE_CONCAT_(a, b)
+
+#endif  // SE_PROJECT_TRACER_H
@@ -0,0 +1,116 @@
+//============================================================================
+// Name        : Pacer.cpp
+// Description : Implementation of the real time pacer
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "Pacer.h"
+
+#include <algorithm>
+
+#include "../contract/Contract.h"
+
+/// histogram bucket of a latency, see Pacer::kBuckets
+static std::size_t bucketOf(Pacer::Clock::duration latency) {
+    std::uint64_t microseconds = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    std::size_t bucket = 0;
+    while (microseconds > 0 && bucket + 1 < Pacer::kBuckets) {
+        microseconds >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+/// @return upper bound of a histogram bucket
+static Pacer::Clock::duration bucketLimit(std::size_t bucket) {
+    return std::chrono::duration_cast<Pacer::Clock::duration>(std::chrono::microseconds(std::uint64_t(1) << bucket));
+}
+
+Pacer::Pacer(double stepSize, double speed, unsigned int maxStride) :
+    period(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(stepSize / speed))),
+    maxStride(maxStride) {
+    REQUIRE(stepSize > 0, "stepSize is larger than zero");
+    REQUIRE(speed > 0, "speed is larger than zero");
+    REQUIRE(maxStride > 0, "maxStride is at least one");
+}
+
+void Pacer::start(Clock::time_point now) { slotStart = now; }
+
+Pacer::Clock::time_point Pacer::nextSlot() const { return slotStart; }
+
+bool Pacer::shouldOutput() const { return ticks % stride == 0; }
+
+void Pacer::tickDone(Clock::time_point begin, Clock::time_point end) {
+    const Clock::duration latency = end - begin;
+    ++histogram[bucketOf(latency)];
+    worstLatency = std::max(worstLatency, latency);
+    ++ticks;
+
+    const Clock::time_point deadline = slotStart + period;
+    if (end > deadline) ++missed;
+
+    if (latency > period) {
+        // the tick with its frame does not fit in its slot, write fewer frames
+        fastTicks = 0;
+        stride = std::min(maxStride, stride * 2);
+    } else if (latency * 2 >= period) {
+        // on time, but not with room to spare: the run of fast ticks is broken
+        fastTicks = 0;
+    } else if (++fastTicks >= kRecoverTicks) {
+        // comfortably within the budget again
+        fastTicks = 0;
+        stride = std::max(1u, stride / 2);
+    }
+
+    // the next slot follows this one, unless the schedule is too far behind to catch up
+    slotStart = deadline;
+    if (end - slotStart > period * kMaxLagSlots) {
+        ++resyncs;
+        slotStart = end;
+    }
+}
+
+Pacer::Clock::duration Pacer::getPeriod() const { return period; }
+
+std::uint64_t Pacer::getTicks() const { return ticks; }
+
+std::uint64_t Pacer::getMissed() const { return missed; }
+
+std::uint64_t Pacer::getResyncs() const { return resyncs; }
+
+unsigned int Pacer::getOutputStride() const { return stride; }
+
+const std::array<std::uint64_t, Pacer::kBuckets> &Pacer::getHistogram() const { return histogram; }
+
+Pacer::Clock::duration Pacer::latencyPercentile(double fraction) const {
+    REQUIRE(fraction >= 0 && fraction <= 1, "fraction is in [0, 1]");
+
+    const double wanted = fraction * ticks;
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+        seen += histogram[bucket];
+        if (seen > 0 && seen >= wanted) return bucketLimit(bucket);
+    }
+    return bucketLimit(0);
+}
+
+void Pacer::writeJson(std::ostream &outStream) const {
+    typedef std::chrono::microseconds Us;
+    outStream << "{\"periodUs\": " << std::chrono::duration_cast<Us>(period).count() << ", \"ticks\": " << ticks
+              << ", \"missed\": " << missed << ", \"resyncs\": " << resyncs << ", \"outputStride\": " << stride
+              << ", \"p50Us\": " << std::chrono::duration_cast<Us>(latencyPercentile(0.5)).count()
+              << ", \"p99Us\": " << std::chrono::duration_cast<Us>(latencyPercentile(0.99)).count()
+              << ", \"maxUs\": " << std::chrono::duration_cast<Us>(worstLatency).count() << ", \"histogramUs\": [";
+    bool first = true;
+    for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+        if (histogram[bucket] == 0) continue;
+        if (!first) outStream << ", ";
+        first = false;
+        outStream << "{\"below\": " << std::chrono::duration_cast<Us>(bucketLimit(bucket)).count()
+                  << ", \"ticks\": " << histogram[bucket] << '}';
+    }
+    outStream << "]}\n";
+}
@@ -0,0 +1,122 @@
+//============================================================================
+// Name        : Pacer.h
+// Description : Paces the ticks of a simulation to the wall clock and keeps their latency
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_PACER_H
+#define SE_PROJECT_PACER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @brief Schedules the ticks of a simulation against the wall clock. \n
+ * Tick n gets the slot [start + n * period, start + (n + 1) * period), where the period is the step size divided by
+ * the speed factor. A tick waits for the start of its slot and misses its deadline when it (with its output) ends after
+ * the end of its slot. A late simulation catches up by not waiting, unless it is more than kMaxLagSlots slots behind:
+ * then the schedule restarts at the current time instead of running the backlog as fast as possible. \n
+ * The latency of every tick goes into a histogram with power of two buckets. When a tick takes longer than its slot
+ * the output stride doubles (only every stride-th tick writes a frame), after kRecoverTicks ticks in a row that used
+ * less than half of their slot it halves again. A tick that starts late (a woken up thread, a catch up) can miss its
+ * deadline without exceeding its budget, that only counts as a miss. \n
+ * The pacer does not read the clock itself, the caller passes the times, so the schedule can be tested.
+ */
+class Pacer {
+  public:
+    typedef std::chrono::steady_clock Clock;
+
+    /// amount of histogram buckets, bucket i holds the latencies in [2^(i-1), 2^i) microseconds (bucket 0: < 1 us)
+    static constexpr std::size_t kBuckets = 28;
+
+    /// a schedule that is this many slots behind restarts at the current time
+    static constexpr unsigned int kMaxLagSlots = 60;
+
+    /// consecutive ticks that used less than half of their slot before the output stride halves
+    static constexpr unsigned int kRecoverTicks = 120;
+
+  private:
+    const Clock::duration period;  // wall time of one tick
+    const unsigned int maxStride;  // largest output stride
+    Clock::time_point slotStart;   // start of the slot of the next tick
+
+    unsigned int stride = 1;       // every stride-th tick writes its frame
+    unsigned int fastTicks = 0;    // consecutive ticks that used less than half of their slot
+
+    std::uint64_t ticks = 0;
+    std::uint64_t missed = 0;
+    std::uint64_t resyncs = 0;
+    Clock::duration worstLatency = Clock::duration::zero();
+    std::array<std::uint64_t, kBuckets> histogram{};
+
+  public:
+    /**
+     * Creates a pacer, the schedule starts at the first call of start() \n
+     * REQUIRE(stepSize > 0, "stepSize is larger than zero"); \n
+     * REQUIRE(speed > 0, "speed is larger than zero"); \n
+     * REQUIRE(maxStride > 0, "maxStride is at least one");
+     * @param stepSize in-simulation time of one tick in seconds
+     * @param speed simulated seconds per wall clock second
+     * @param maxStride largest amount of ticks per written frame
+     */
+    Pacer(double stepSize, double speed, unsigned int maxStride = 64);
+
+    /**
+     * Starts the schedule, the slot of the first tick starts now
+     * @param now current time
+     */
+    void start(Clock::time_point now);
+
+    /// @return the start of the slot of the next tick, the caller waits until then
+    Clock::time_point nextSlot() const;
+
+    /// @return true if the next tick writes its frame (every stride-th tick)
+    bool shouldOutput() const;
+
+    /**
+     * Accounts a finished tick and moves the schedule to the next slot
+     * @param begin time the tick (including its output) started
+     * @param end time the tick (including its output) ended
+     */
+    void tickDone(Clock::time_point begin, Clock::time_point end);
+
+    /// @return wall time of one tick
+    Clock::duration getPeriod() const;
+
+    /// @return amount of ticks that were accounted
+    std::uint64_t getTicks() const;
+
+    /// @return amount of ticks that ended after the end of their slot
+    std::uint64_t getMissed() const;
+
+    /// @return amount of times the schedule restarted because it was too far behind
+    std::uint64_t getResyncs() const;
+
+    /// @return current output stride
+    unsigned int getOutputStride() const;
+
+    /// @return the latency histogram
+    const std::array<std::uint64_t, kBuckets> &getHistogram() const;
+
+    /**
+     * REQUIRE(fraction >= 0 && fraction <= 1, "fraction is in [0, 1]");
+     * @param fraction fraction of the ticks, in [0, 1]
+     * @return upper bound of the histogram bucket below which the given fraction of the latencies lie
+     */
+    Clock::duration latencyPercentile(double fraction) const;
+
+    /**
+     * Writes the schedule statistics as one json object: {"periodUs", "ticks", "missed", "resyncs", "outputStride",
+     * "p50Us", "p99Us", "maxUs", "histogramUs": [{"below": us, "ticks": n}, ...]}
+     * @param outStream stream to write to
+     */
+    void writeJson(std::ostream &outStream) const;
+};
+
+#endif  // SE_PROJECT_PACER_H
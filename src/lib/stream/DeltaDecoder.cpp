@@ -0,0 +1,148 @@
+//============================================================================
+// Name        : DeltaDecoder.cpp
+// Description : Implementation of the delta decoder
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "DeltaDecoder.h"
+
+#include <stdexcept>
+
+#include "../contract/Contract.h"
+
+bool DeltaDecoder::apply(const std::string &line) { return apply(line.data(), line.data() + line.size()); }
+
+bool DeltaDecoder::apply(const char *begin, const char *end) {
+    // a message that is no json, misses a field or has a field of the wrong type
+    try {
+        return applyMessage(nlohmann::json::parse(begin, end));
+    } catch (const nlohmann::json::exception &e) {
+        throw std::runtime_error(std::string("[DeltaDecoder] Malformed message: ") + e.what());
+    }
+}
+
+bool DeltaDecoder::apply(const nlohmann::json &message) {
+    try {
+        return applyMessage(message);
+    } catch (const nlohmann::json::exception &e) {
+        throw std::runtime_error(std::string("[DeltaDecoder] Malformed message: ") + e.what());
+    }
+}
+
+bool DeltaDecoder::applyMessage(const nlohmann::json &message) {
+    const std::string type = message.value("type", "");
+    if (type == "topology") {
+        roads.clear();
+        resolution = message.at("resolution");
+        stepSize = message.at("stepSize");
+        for (const nlohmann::json &roadJson : message.at("roads")) {
+            Road road{roadJson.at("name"), roadJson.at("length"), {}, {}, {}};
+            for (const nlohmann::json &light : roadJson.at("lights")) { road.lights.emplace_back(light[0], light[1]); }
+            for (const nlohmann::json &x : roadJson.at("busStops")) { road.busStops.push_back(x); }
+            for (const nlohmann::json &x : roadJson.at("crossRoads")) { road.crossRoads.push_back(x); }
+            roads.push_back(std::move(road));
+        }
+        hasTopology = true;
+        inSync = false;
+        return false;
+    }
+    // the keyframe index at the end of a recording, only RecordingReader needs it
+    if (type == "index" || type == "end") return false;
+
+    if (!hasTopology) throw std::runtime_error("[DeltaDecoder] A frame arrived before the topology.");
+
+    if (type == "key") {
+        vehicles.clear();
+        for (const nlohmann::json &vehicle : message.at("vehicles")) {
+            vehicles[vehicle[0]] = Vehicle{roadIndex(vehicle[1]), vehicle[2], vehicle[3], vehicle[4]};
+        }
+        lights.clear();
+        for (const nlohmann::json &light : message.at("lights")) { lights[light[0]] = light[1] != 0; }
+        inSync = true;
+    } else if (type == "delta") {
+        if (!inSync) throw std::runtime_error("[DeltaDecoder] A delta arrived before a keyframe.");
+        // the order of DeltaEncoder: new steps, every vehicle moves, then the vehicles that changed road
+        const nlohmann::json &moved = field(message, "moved");
+        for (std::size_t i = 0; i + 1 < moved.size(); i += 2) { find(moved[i]).step = moved[i + 1]; }
+        for (std::pair<const unsigned int, Vehicle> &vehiclePair : vehicles) {
+            vehiclePair.second.units += vehiclePair.second.step;
+        }
+        for (const nlohmann::json &vehicle : field(message, "turned")) {
+            Vehicle &turning = find(vehicle[0]);
+            turning.road = roadIndex(vehicle[1]);
+            turning.units = vehicle[2];
+            turning.step = 0;
+        }
+        for (const nlohmann::json &vehicle : field(message, "spawned")) {
+            vehicles[vehicle[0]] = Vehicle{roadIndex(vehicle[1]), vehicle[2], 0, vehicle[3]};
+        }
+        for (const nlohmann::json &vehicleId : field(message, "despawned")) {
+            vehicles.erase(vehicleId.get<unsigned int>());
+        }
+        for (const nlohmann::json &light : field(message, "lights")) { lights[light[0]] = light[1] != 0; }
+    } else {
+        throw std::runtime_error("[DeltaDecoder] Unknown message type: '" + type + "'.");
+    }
+
+    tick = message.at("tick");
+    return true;
+}
+
+bool DeltaDecoder::hasFrame() const { return inSync; }
+
+nlohmann::json DeltaDecoder::frame() const {
+    REQUIRE(hasFrame(), "a keyframe was applied");
+
+    std::vector<nlohmann::json> carsByRoad(roads.size(), nlohmann::json::array());
+    for (const std::pair<const unsigned int, Vehicle> &vehiclePair : vehicles) {
+        carsByRoad[vehiclePair.second.road].push_back(
+          nlohmann::json::object({{"x", vehiclePair.second.units * resolution}, {"type", vehiclePair.second.type}}));
+    }
+
+    // the same objects Logger::logAsJson writes, placeholders included
+    nlohmann::json roadsJson = nlohmann::json::array();
+    for (std::size_t i = 0; i < roads.size(); ++i) {
+        const Road &road = roads[i];
+        nlohmann::json lightsJson = nlohmann::json::array();
+        for (const std::pair<unsigned int, double> &light : road.lights) {
+            const std::unordered_map<unsigned int, bool>::const_iterator green = lights.find(light.first);
+            lightsJson.push_back(nlohmann::json::object({{"x", light.second},
+                                                         {"green", green != lights.end() && green->second ? 1 : 0},
+                                                         {"xs", 50},
+                                                         {"xs0", 15}}));
+        }
+        for (const double x : road.busStops) { lightsJson.push_back(nlohmann::json::object({{"x", x}, {"green", 0}})); }
+        for (const double x : road.crossRoads) {
+            lightsJson.push_back(nlohmann::json::object({{"x", x}, {"green", 1}}));
+        }
+
+        roadsJson.push_back(nlohmann::json::object({{"name", road.name},
+                                                    {"length", road.length},
+                                                    {"cars", std::move(carsByRoad[i])},
+                                                    {"lights", std::move(lightsJson)}}));
+    }
+    return nlohmann::json::object({{"roads", std::move(roadsJson)}, {"time", tick * stepSize}});
+}
+
+unsigned int DeltaDecoder::getTick() const { return tick; }
+
+const nlohmann::json &DeltaDecoder::field(const nlohmann::json &message, const char *name) {
+    static const nlohmann::json empty = nlohmann::json::array();
+    const nlohmann::json::const_iterator it = message.find(name);
+    return it == message.end() ? empty : *it;
+}
+
+DeltaDecoder::Vehicle &DeltaDecoder::find(const nlohmann::json &vehicleId) {
+    const std::map<unsigned int, Vehicle>::iterator it = vehicles.find(vehicleId.get<unsigned int>());
+    if (it == vehicles.end()) throw std::runtime_error("[DeltaDecoder] A delta moved an unknown vehicle.");
+    return it->second;
+}
+
+std::size_t DeltaDecoder::roadIndex(const nlohmann::json &value) const {
+    const std::size_t road = value;
+    if (road >= roads.size()) throw std::runtime_error("[DeltaDecoder] A vehicle is on an unknown road.");
+    return road;
+}
@@ -0,0 +1,92 @@
+//============================================================================
+// Name        : DeltaDecoder.h
+// Description : Rebuilds the json frames of the visualizer from the messages of a DeltaEncoder
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_DELTADECODER_H
+#define SE_PROJECT_DELTADECODER_H
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../nlohmann-json/json.hpp"
+
+/**
+ * @brief Keeps the state described by the messages of a DeltaEncoder and turns it into the json frame
+ * Logger::logAsJson writes for the same state. The cars of a road are ordered by vehicle id and their positions are
+ * rounded to the resolution of the encoder, the rest of the frame is the same. \n
+ * @throws std::runtime_error If a message is malformed or does not follow the topology and a keyframe
+ */
+class DeltaDecoder {
+    /// road of the topology
+    struct Road {
+        std::string name;
+        double length;
+        std::vector<std::pair<unsigned int, double>> lights;  // lightId and position
+        std::vector<double> busStops;                         // positions
+        std::vector<double> crossRoads;                       // positions
+    };
+
+    /// vehicle of the current state
+    struct Vehicle {
+        std::size_t road;  // index of the road in the topology
+        long long units;   // position in units of the resolution
+        long long step;    // units the vehicle moves at every delta
+        std::string type;  // type name of the json frames
+    };
+
+    std::vector<Road> roads;
+    double resolution = 0;                         // meters per unit of a position
+    double stepSize = 0;                           // seconds per tick
+    std::map<unsigned int, Vehicle> vehicles;      // ordered, so the cars of a road come out in the same order
+    std::unordered_map<unsigned int, bool> lights;  // colour by lightId
+    bool hasTopology = false;
+    bool inSync = false;  // a keyframe was applied
+    unsigned int tick = 0;
+
+  public:
+    /**
+     * Applies one message
+     * @param line the message, with or without line end
+     * @return true if the message completed a frame (a keyframe or a delta), false for the topology and the footer of
+     * a recording
+     */
+    bool apply(const std::string &line);
+
+    /// applies the message in [begin, end), without copying it, see apply(const std::string&)
+    bool apply(const char *begin, const char *end);
+
+    /// applies a message that was already parsed, see apply(const std::string&)
+    bool apply(const nlohmann::json &message);
+
+    /// @return true once a keyframe was applied, from then on frame() describes the simulation
+    bool hasFrame() const;
+
+    /**
+     * REQUIRE(hasFrame(), "a keyframe was applied");
+     * @return the current state as a json frame of the visualizer
+     */
+    nlohmann::json frame() const;
+
+    /// @return iteration of the last applied frame
+    unsigned int getTick() const;
+
+  private:
+    bool applyMessage(const nlohmann::json &message);
+
+    /// @return the array of a delta, empty when it is left out
+    static const nlohmann::json &field(const nlohmann::json &message, const char *name);
+
+    /// @return the vehicle with the given id, a delta cannot move an unknown vehicle
+    Vehicle &find(const nlohmann::json &vehicleId);
+
+    std::size_t roadIndex(const nlohmann::json &value) const;
+};
+
+#endif  // SE_PROJECT_DELTADECODER_H
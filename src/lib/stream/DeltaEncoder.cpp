@@ -0,0 +1,154 @@
+//============================================================================
+// Name        : DeltaEncoder.cpp
+// Description : Implementation of the delta encoder
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "DeltaEncoder.h"
+
+#include <cmath>
+
+#include "../../objects/entities/light/LightEntity.h"
+#include "../../objects/road/RoadObject.h"
+#include "../contract/Contract.h"
+#include "../logger/Logger.h"
+#include "../nlohmann-json/json.hpp"
+
+DeltaEncoder::DeltaEncoder(const Simulation &sim, double resolution) : resolution(resolution) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(resolution > 0, "resolution is larger than zero");
+
+    // the roads keep the order of the json frames
+    nlohmann::json roadsJson = nlohmann::json::array();
+    for (const std::pair<const id, RoadObject> &roadPair : sim.getRoads()) {
+        roadIndices[roadPair.first] = roadOrder.size();
+        roadOrder.push_back(roadPair.first);
+
+        const RoadFeatures &features = sim.getRoadFeatures(roadPair.first);
+        nlohmann::json lightsJson = nlohmann::json::array();
+        for (const StaticFeature<LightEntity> &light : features.lights) {
+            lightsJson.push_back({light.featureId, light.position});
+            lightIds.push_back(light.featureId);
+            lightGreen.push_back(light.entity->isGreen());
+        }
+        nlohmann::json busStopsJson = nlohmann::json::array();
+        for (const StaticFeature<BusStopEntity> &busStop : features.busStops) {
+            busStopsJson.push_back(busStop.position);
+        }
+        nlohmann::json crossRoadsJson = nlohmann::json::array();
+        for (const CrossRoadFeature &crossRoad : features.crossRoads) { crossRoadsJson.push_back(crossRoad.position); }
+
+        roadsJson.push_back({{"name", roadPair.second.getName()},
+                             {"length", roadPair.second.getLength()},
+                             {"lights", std::move(lightsJson)},
+                             {"busStops", std::move(busStopsJson)},
+                             {"crossRoads", std::move(crossRoadsJson)}});
+    }
+    topologyLine = nlohmann::json::object({{"type", "topology"},
+                                           {"resolution", resolution},
+                                           {"stepSize", sim.getStepSize()},
+                                           {"roads", std::move(roadsJson)}})
+                     .dump();
+}
+
+const std::string &DeltaEncoder::topology() const { return topologyLine; }
+
+std::string DeltaEncoder::delta(const Simulation &sim) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    ++deltas;
+    tick = sim.getIteration();
+
+    nlohmann::json moved = nlohmann::json::array();
+    nlohmann::json turned = nlohmann::json::array();
+    nlohmann::json spawned = nlohmann::json::array();
+    nlohmann::json despawned = nlohmann::json::array();
+    nlohmann::json lights = nlohmann::json::array();
+
+    const WorldView world = sim.getWorld();
+    for (const std::pair<const id, VehicleEntity> &vehiclePair : sim.getVehicles()) {
+        const std::pair<id, double> place = world.at(vehiclePair.first);
+        const std::size_t road = roadIndices.at(place.first);
+        const long long units = std::llround(place.second / resolution);
+        const EVehicleEntityTypes type = vehiclePair.second.getType();
+
+        std::pair<std::unordered_map<id, VehicleState>::iterator, bool> inserted =
+          vehicles.emplace(vehiclePair.first, VehicleState{road, units, 0, type, deltas});
+        if (inserted.second) {
+            spawned.push_back({vehiclePair.first, road, units, Logger::vehicleTypeToName(type)});
+            continue;
+        }
+
+        // the reader moves the vehicle by its step, only a different step is written
+        VehicleState &state = inserted.first->second;
+        state.seen = deltas;
+        if (state.road != road) {
+            state.road = road;
+            state.units = units;
+            state.step = 0;
+            turned.push_back({vehiclePair.first, road, units});
+        } else if (state.units + state.step != units) {
+            state.step = units - state.units;
+            state.units = units;
+            moved.push_back(vehiclePair.first);
+            moved.push_back(state.step);
+        } else {
+            state.units = units;
+        }
+    }
+
+    // a vehicle that was not seen by this delta left the simulation
+    for (std::unordered_map<id, VehicleState>::iterator it = vehicles.begin(); it != vehicles.end();) {
+        if (it->second.seen == deltas) {
+            ++it;
+            continue;
+        }
+        despawned.push_back(it->first);
+        it = vehicles.erase(it);
+    }
+
+    std::size_t light = 0;
+    for (const id roadId : roadOrder) {
+        for (const StaticFeature<LightEntity> &feature : sim.getRoadFeatures(roadId).lights) {
+            const bool green = feature.entity->isGreen();
+            // the first delta sends every light, the keyframe of a reader that joins later does the same
+            if (deltas == 1 || lightGreen[light] != green) {
+                lightGreen[light] = green;
+                lights.push_back({feature.featureId, green ? 1 : 0});
+            }
+            ++light;
+        }
+    }
+
+    nlohmann::json message = nlohmann::json::object({{"type", "delta"}, {"tick", tick}});
+    if (!moved.empty()) message["moved"] = std::move(moved);
+    if (!turned.empty()) message["turned"] = std::move(turned);
+    if (!spawned.empty()) message["spawned"] = std::move(spawned);
+    if (!despawned.empty()) message["despawned"] = std::move(despawned);
+    if (!lights.empty()) message["lights"] = std::move(lights);
+    return message.dump();
+}
+
+unsigned long long DeltaEncoder::getDeltas() const { return deltas; }
+
+double DeltaEncoder::getResolution() const { return resolution; }
+
+std::string DeltaEncoder::keyframe() const {
+    nlohmann::json vehiclesJson = nlohmann::json::array();
+    for (const std::pair<const id, VehicleState> &vehiclePair : vehicles) {
+        const VehicleState &state = vehiclePair.second;
+        vehiclesJson.push_back(
+          {vehiclePair.first, state.road, state.units, state.step, Logger::vehicleTypeToName(state.type)});
+    }
+    nlohmann::json lightsJson = nlohmann::json::array();
+    for (std::size_t light = 0; light < lightIds.size(); ++light) {
+        lightsJson.push_back({lightIds[light], lightGreen[light] ? 1 : 0});
+    }
+
+    nlohmann::json message = nlohmann::json::object({{"type", "key"}, {"tick", tick}});
+    message["vehicles"] = std::move(vehiclesJson);
+    message["lights"] = std::move(lightsJson);
+    return message.dump();
+}
@@ -0,0 +1,94 @@
+//============================================================================
+// Name        : DeltaEncoder.h
+// Description : Encodes the state of a simulation as a topology, keyframes and per tick deltas
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_DELTAENCODER_H
+#define SE_PROJECT_DELTAENCODER_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Simulation.h"
+
+/**
+ * @brief Encodes a running simulation as json lines that only carry what changed. \n
+ * Vehicle positions are whole multiples of the resolution (units). Every vehicle also has a step: the units it moved
+ * between the previous two frames. A reader moves every vehicle by its step at every delta, so a vehicle that keeps
+ * its speed (or stands still) is not mentioned at all. \n
+ * Every message is one json object on one line, its "type" tells what it holds: \n
+ * topology: {"type": "topology", "resolution", "stepSize", "roads": [{"name", "length", "lights": [[lightId, x],
+ * ...], "busStops": [x, ...], "crossRoads": [x, ...]}, ...]}, the parts of the network that never change and the
+ * seconds per tick, roads are referred to by their index in this array \n
+ * key: {"type": "key", "tick", "vehicles": [[vehicleId, road, units, step, type], ...], "lights": [[lightId, green],
+ * ...]}, the complete state \n
+ * delta: {"type": "delta", "tick", "moved": [vehicleId, step, vehicleId, step, ...], "turned": [[vehicleId, road,
+ * units], ...], "spawned": [[vehicleId, road, units, type], ...], "despawned": [vehicleId, ...], "lights": [[lightId,
+ * green], ...]}, the changes since the previous delta. A reader first gives the moved vehicles their new step, then
+ * moves every vehicle by its step, then places the turned vehicles on their new road and the spawned ones (both with
+ * step 0), removes the despawned ones and sets the lights. Empty arrays are left out. \n
+ * Vehicle types are named as in the json frames of Logger::logAsJson, the time of a frame is its tick * stepSize like
+ * in those frames. A reader that has the topology and a keyframe stays in sync by applying every following delta, see
+ * DeltaDecoder.
+ */
+class DeltaEncoder {
+    /// last encoded state of a vehicle
+    struct VehicleState {
+        std::size_t road;          // index of the road in the topology
+        long long units;           // position on the road in units of the resolution
+        long long step;            // units moved between the last two deltas
+        EVehicleEntityTypes type;  // type of the vehicle
+        unsigned long long seen;   // delta that last saw the vehicle
+    };
+
+    const double resolution;  // meters per unit of a position
+
+    std::unordered_map<id, std::size_t> roadIndices;  // index in the topology by roadId
+    std::vector<id> roadOrder;                        // roadId by index in the topology
+    std::string topologyLine;
+
+    std::unordered_map<id, VehicleState> vehicles;  // last encoded vehicles
+    std::vector<id> lightIds;                       // every light, in topology order
+    std::vector<bool> lightGreen;                   // last encoded colour of every light
+    unsigned long long deltas = 0;                  // amount of encoded deltas
+    unsigned int tick = 0;                          // iteration of the last encoded delta
+
+  public:
+    /// default resolution of the positions in meters, far below what a visualizer can show
+    static constexpr double kDefaultResolution = 0.001;
+
+    /**
+     * Creates an encoder for the network of the simulation, nothing has been encoded yet \n
+     * REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(resolution > 0, "resolution is larger than zero");
+     * @param sim simulation to encode
+     * @param resolution meters per unit of a vehicle position, a decoded position is at most half of it off
+     */
+    explicit DeltaEncoder(const Simulation &sim, double resolution = kDefaultResolution);
+
+    /// @return the topology message, without line end
+    const std::string &topology() const;
+
+    /**
+     * Encodes the changes since the previous call (everything at the first call) and remembers the new state
+     * @param sim simulation to encode, the one the encoder was created for
+     * @return the delta message, without line end
+     */
+    std::string delta(const Simulation &sim);
+
+    /// @return a keyframe message of the state remembered by the last delta, without line end
+    std::string keyframe() const;
+
+    /// @return amount of deltas encoded so far
+    unsigned long long getDeltas() const;
+
+    /// @return meters per unit of a vehicle position
+    double getResolution() const;
+};
+
+#endif  // SE_PROJECT_DELTAENCODER_H
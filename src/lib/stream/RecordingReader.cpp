@@ -0,0 +1,126 @@
+//============================================================================
+// Name        : RecordingReader.cpp
+// Description : Implementation of the recording reader
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "RecordingReader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+RecordingReader::RecordingReader(const std::string &path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("[RecordingReader] Cannot open '" + path + "': " + std::strerror(errno) + '.');
+    struct stat status {};
+    if (::fstat(fd, &status) != 0 || status.st_size == 0) {
+        ::close(fd);
+        throw std::runtime_error("[RecordingReader] Empty recording: '" + path + "'.");
+    }
+    size = static_cast<std::size_t>(status.st_size);
+    void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps the file alive
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("[RecordingReader] Cannot map '" + path + "': " + std::strerror(errno) + '.');
+    }
+    data = static_cast<const char *>(mapping);
+
+    try {
+        readIndex(path);
+    } catch (...) {
+        ::munmap(const_cast<char *>(data), size);
+        throw;
+    }
+}
+
+RecordingReader::~RecordingReader() { ::munmap(const_cast<char *>(data), size); }
+
+void RecordingReader::readIndex(const std::string &path) {
+    const std::string unfinished = "[RecordingReader] No keyframe index in '" + path + "', the run did not finish.";
+    if (data[size - 1] != '\n') throw std::runtime_error(unfinished);
+
+    // the last line holds the offset of the index
+    std::size_t endLine = size - 1;
+    while (endLine > 0 && data[endLine - 1] != '\n') --endLine;
+    try {
+        const nlohmann::json end = nlohmann::json::parse(data + endLine, data + size - 1);
+        if (end.value("type", "") != "end") throw std::runtime_error(unfinished);
+        framesEnd = end.at("index");
+        if (framesEnd >= endLine)
+            throw std::runtime_error("[RecordingReader] Index offset out of range in '" + path + "'.");
+
+        const nlohmann::json index = nlohmann::json::parse(data + framesEnd, data + lineEnd(framesEnd));
+        if (index.value("type", "") != "index")
+            throw std::runtime_error("[RecordingReader] Index offset does not point to the index in '" + path + "'.");
+        for (const nlohmann::json &keyframe : index.at("keyframes")) {
+            const std::size_t offset = keyframe[1];
+            if (offset >= framesEnd)
+                throw std::runtime_error("[RecordingReader] Keyframe offset out of range in '" + path + "'.");
+            keyframes.emplace_back(keyframe[0], offset);
+        }
+    } catch (const nlohmann::json::exception &e) {
+        throw std::runtime_error("[RecordingReader] Malformed footer in '" + path + "': " + e.what());
+    }
+    if (keyframes.empty()) throw std::runtime_error("[RecordingReader] Recording without frames: '" + path + "'.");
+    if (!std::is_sorted(keyframes.begin(), keyframes.end()))
+        throw std::runtime_error("[RecordingReader] Keyframes out of order in '" + path + "'.");
+
+    // the topology is the first line
+    decoder.apply(data, data + lineEnd(0));
+    position = keyframes.front().second;
+}
+
+bool RecordingReader::seek(unsigned int tick) {
+    // the last keyframe at or before the tick
+    std::vector<std::pair<unsigned int, std::size_t>>::const_iterator keyframe = std::upper_bound(
+      keyframes.begin(), keyframes.end(), tick,
+      [](unsigned int value, const std::pair<unsigned int, std::size_t> &entry) { return value < entry.first; });
+    if (keyframe == keyframes.begin()) return false;
+    --keyframe;
+
+    position = keyframe->second;
+    next();
+    while (position < framesEnd) {
+        // the frames after the keyframe up to the tick, the frame after the tick is left for next()
+        const std::size_t end = lineEnd(position);
+        try {
+            const nlohmann::json message = nlohmann::json::parse(data + position, data + end);
+            if (message.at("tick").get<unsigned int>() > tick) break;
+            decoder.apply(message);
+        } catch (const nlohmann::json::exception &e) {
+            throw std::runtime_error(std::string("[RecordingReader] Malformed frame: ") + e.what());
+        }
+        position = end + 1;
+    }
+    return true;
+}
+
+bool RecordingReader::next() {
+    if (position >= framesEnd) return false;
+    const std::size_t end = lineEnd(position);
+    decoder.apply(data + position, data + end);
+    position = end + 1;
+    return true;
+}
+
+const DeltaDecoder &RecordingReader::getDecoder() const { return decoder; }
+
+std::size_t RecordingReader::getKeyframes() const { return keyframes.size(); }
+
+unsigned int RecordingReader::getFirstTick() const { return keyframes.front().first; }
+
+std::size_t RecordingReader::lineEnd(std::size_t offset) const {
+    const void *end = std::memchr(data + offset, '\n', size - offset);
+    return end ? static_cast<const char *>(end) - data : size;
+}
@@ -0,0 +1,77 @@
+//============================================================================
+// Name        : RecordingReader.h
+// Description : Seeks in a recording of a RecordingWriter through its keyframe index
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_RECORDINGREADER_H
+#define SE_PROJECT_RECORDINGREADER_H
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DeltaDecoder.h"
+
+/**
+ * @brief Reads a finished recording of a RecordingWriter from a memory mapped file. \n
+ * Only the topology and the footer are read when the file is opened. A seek finds the last keyframe at or before the
+ * tick with a binary search over the index and applies the deltas from there, so it never reads more than one
+ * keyframe interval of the file, however long the run was. The messages are parsed straight from the mapping.
+ * @throws std::runtime_error If the file cannot be mapped, has no index (the run did not finish) or is malformed
+ */
+class RecordingReader {
+    const char *data = nullptr;  // the mapped file
+    std::size_t size = 0;
+    std::size_t framesEnd = 0;  // offset of the index line, where the frames end
+    std::size_t position = 0;   // offset of the next frame line
+
+    std::vector<std::pair<unsigned int, std::size_t>> keyframes;  // tick and offset of every keyframe, by tick
+    DeltaDecoder decoder;
+
+  public:
+    /**
+     * Maps the recording and reads its topology and keyframe index, no frame has been read yet
+     * @param path path of a file written by RecordingWriter
+     */
+    explicit RecordingReader(const std::string &path);
+
+    ~RecordingReader();
+
+    RecordingReader(const RecordingReader &) = delete;
+    RecordingReader &operator=(const RecordingReader &) = delete;
+
+    /**
+     * Moves to the last frame at or before the tick, frames are only written for the ticks the output policy accepted
+     * @param tick iteration of the simulation
+     * @return false if the recording starts after the tick, the reader did not move then
+     */
+    bool seek(unsigned int tick);
+
+    /// @return true if the next frame of the recording was read, false at its end
+    bool next();
+
+    /**
+     * The state of the last read frame, see DeltaDecoder::frame() and DeltaDecoder::getTick()
+     * @return decoder of the recording
+     */
+    const DeltaDecoder &getDecoder() const;
+
+    /// @return amount of keyframes in the index
+    std::size_t getKeyframes() const;
+
+    /// @return tick of the first frame of the recording
+    unsigned int getFirstTick() const;
+
+  private:
+    /// @return the end of the line that starts at the offset, without its line end
+    std::size_t lineEnd(std::size_t offset) const;
+
+    void readIndex(const std::string &path);
+};
+
+#endif  // SE_PROJECT_RECORDINGREADER_H
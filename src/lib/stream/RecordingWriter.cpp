@@ -0,0 +1,70 @@
+//============================================================================
+// Name        : RecordingWriter.cpp
+// Description : Implementation of the recording writer
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "RecordingWriter.h"
+
+#include "../contract/Contract.h"
+#include "../nlohmann-json/json.hpp"
+
+RecordingWriter::RecordingWriter(const Simulation &sim, double resolution, unsigned int keyframeEvery)
+    : encoder(sim, resolution), keyframeEvery(keyframeEvery) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(keyframeEvery > 0, "keyframeEvery is larger than zero");
+}
+
+void RecordingWriter::write(const Simulation &sim, OutputSink &sink) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    REQUIRE(!isFinished(), "Recording is not finished");
+
+    if (frames == 0) writeLine(sink, encoder.topology());
+
+    // a keyframe replaces the delta of its frame, the encoder still has to see the frame for the deltas after it
+    const std::string delta = encoder.delta(sim);
+    if (frames % keyframeEvery == 0) {
+        keyframes.emplace_back(sim.getIteration(), bytes);
+        writeLine(sink, encoder.keyframe());
+    } else {
+        writeLine(sink, delta);
+    }
+    ++frames;
+}
+
+void RecordingWriter::finish(std::ostream &outStream) {
+    StreamSink sink(outStream);
+    finish(sink);
+}
+
+void RecordingWriter::finish(OutputSink &sink) {
+    if (finished) return;
+    finished = true;
+
+    const std::uint64_t indexOffset = bytes;
+    nlohmann::json keyframesJson = nlohmann::json::array();
+    for (const std::pair<unsigned int, std::uint64_t> &keyframe : keyframes) {
+        keyframesJson.push_back({keyframe.first, keyframe.second});
+    }
+    nlohmann::json index = nlohmann::json::object({{"type", "index"}});
+    index["keyframes"] = std::move(keyframesJson);
+    writeLine(sink, index.dump());
+    writeLine(sink, nlohmann::json::object({{"type", "end"}, {"index", indexOffset}}).dump());
+    sink.flush();
+}
+
+bool RecordingWriter::isFinished() const { return finished; }
+
+unsigned long long RecordingWriter::getFrames() const { return frames; }
+
+std::size_t RecordingWriter::getKeyframes() const { return keyframes.size(); }
+
+void RecordingWriter::writeLine(OutputSink &sink, const std::string &line) {
+    // counted here instead of asked from the sink, it can hold bytes from before the recording
+    sink.write(line);
+    sink.put('\n');
+    bytes += line.size() + 1;
+}
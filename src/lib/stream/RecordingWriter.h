@@ -0,0 +1,83 @@
+//============================================================================
+// Name        : RecordingWriter.h
+// Description : Writes a run as delta messages with periodic keyframes and a keyframe index
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_RECORDINGWRITER_H
+#define SE_PROJECT_RECORDINGWRITER_H
+
+#include <cstdint>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "../logger/OutputSink.h"
+#include "DeltaEncoder.h"
+
+/**
+ * @brief Writes the frames of a run as the messages of a DeltaEncoder, so a reader can start at any keyframe. \n
+ * A recording is the topology, a keyframe, then one delta per frame, where every keyframeEvery-th frame is a keyframe
+ * instead of a delta. finish() appends the footer: \n
+ * index: {"type": "index", "keyframes": [[tick, offset], ...]}, the byte offset of every keyframe line \n
+ * end: {"type": "end", "index": offset}, the byte offset of the index line, always the last line \n
+ * DeltaDecoder skips the footer, RecordingReader uses it to seek.
+ */
+class RecordingWriter {
+    DeltaEncoder encoder;
+    const unsigned int keyframeEvery;
+
+    std::vector<std::pair<unsigned int, std::uint64_t>> keyframes;  // tick and byte offset of every keyframe
+    std::uint64_t bytes = 0;                                       // bytes written so far
+    unsigned long long frames = 0;                                 // frames written so far
+    bool finished = false;
+
+  public:
+    /// default amount of frames between two keyframes, 10 seconds of a run at 60 frames per second
+    static constexpr unsigned int kDefaultKeyframeEvery = 600;
+
+    /**
+     * Creates a recording of the simulation, nothing has been written yet \n
+     * REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized"); \n
+     * REQUIRE(keyframeEvery > 0, "keyframeEvery is larger than zero");
+     * @param sim simulation to record
+     * @param resolution meters per unit of a vehicle position, see DeltaEncoder
+     * @param keyframeEvery amount of frames between two keyframes, a seek applies at most this many deltas
+     */
+    explicit RecordingWriter(const Simulation &sim, double resolution = DeltaEncoder::kDefaultResolution,
+                             unsigned int keyframeEvery = kDefaultKeyframeEvery);
+
+    /**
+     * Writes the current state as the next frame, the first call also writes the topology \n
+     * REQUIRE(!isFinished(), "Recording is not finished");
+     * @param sim simulation to record, the one the recording was created for
+     * @param sink sink of the recording, the same one at every call
+     */
+    void write(const Simulation &sim, OutputSink &sink);
+
+    /**
+     * Writes the keyframe index, no frames can follow it. Does nothing the second time.
+     * @param sink sink of the recording
+     */
+    void finish(OutputSink &sink);
+
+    /// finish(OutputSink&) to a stream
+    void finish(std::ostream &outStream);
+
+    /// @return true once the index was written
+    bool isFinished() const;
+
+    /// @return amount of frames written so far
+    unsigned long long getFrames() const;
+
+    /// @return amount of keyframes written so far
+    std::size_t getKeyframes() const;
+
+  private:
+    void writeLine(OutputSink &sink, const std::string &line);
+};
+
+#endif  // SE_PROJECT_RECORDINGWRITER_H
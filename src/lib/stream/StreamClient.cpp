@@ -0,0 +1,50 @@
+//============================================================================
+// Name        : StreamClient.cpp
+// Description : Implementation of the frame stream client
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "StreamClient.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+#include "StreamSocket.h"
+
+StreamClient::StreamClient(const std::string &address) : socket(StreamSocket::connect(address)) {}
+
+StreamClient::~StreamClient() { ::close(socket); }
+
+bool StreamClient::readLine(std::string &line) { return readLine(line, -1); }
+
+bool StreamClient::readLine(std::string &line, int timeoutMs) {
+    while (true) {
+        const std::size_t end = buffer.find('\n', start);
+        if (end != std::string::npos) {
+            line.assign(buffer, start, end - start);
+            start = end + 1;
+            return true;
+        }
+
+        // only the start of the next line is left, move it to the front before reading more
+        buffer.erase(0, start);
+        start = 0;
+
+        pollfd readable{socket, POLLIN, 0};
+        const int ready = ::poll(&readable, 1, timeoutMs);
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready <= 0) return false;
+
+        char chunk[64 * 1024];
+        const ssize_t received = ::recv(socket, chunk, sizeof(chunk), 0);
+        if (received < 0 && errno == EINTR) continue;
+        if (received <= 0) return false;
+        buffer.append(chunk, received);
+    }
+}
@@ -0,0 +1,54 @@
+//============================================================================
+// Name        : StreamClient.h
+// Description : Reads the messages of a StreamServer
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_STREAMCLIENT_H
+#define SE_PROJECT_STREAMCLIENT_H
+
+#include <string>
+
+/**
+ * @brief Blocking connection to a StreamServer that reads its messages line by line, feed them to a DeltaDecoder to
+ * get the json frames of the visualizer. \n
+ * @throws std::runtime_error If the address is invalid or the connection fails
+ */
+class StreamClient {
+    const int socket;
+    std::string buffer;     // received bytes that were not returned yet
+    std::size_t start = 0;  // start of the next line in the buffer
+
+  public:
+    /**
+     * Connects to a server
+     * @param address unix:PATH or tcp:PORT, see StreamSocket
+     */
+    explicit StreamClient(const std::string &address);
+
+    /// closes the connection
+    ~StreamClient();
+
+    StreamClient(const StreamClient &) = delete;
+    StreamClient &operator=(const StreamClient &) = delete;
+
+    /**
+     * Waits for the next message
+     * @param line receives the message, without line end
+     * @return false when the server closed the connection
+     */
+    bool readLine(std::string &line);
+
+    /**
+     * Waits at most the timeout for the next message
+     * @param line receives the message, without line end
+     * @param timeoutMs longest time to wait in milliseconds
+     * @return false when no message arrived in time or the server closed the connection
+     */
+    bool readLine(std::string &line, int timeoutMs);
+};
+
+#endif  // SE_PROJECT_STREAMCLIENT_H
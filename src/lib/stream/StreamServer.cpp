@@ -0,0 +1,152 @@
+//============================================================================
+// Name        : StreamServer.cpp
+// Description : Implementation of the frame stream server
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "StreamServer.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+
+#include "../contract/Contract.h"
+#include "StreamSocket.h"
+
+// a client that disconnected must not kill the simulation with SIGPIPE, platforms without MSG_NOSIGNAL use
+// SO_NOSIGPIPE on the socket instead
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+/// sent bytes at the front of a queue are only erased in blocks of at least this size
+static const std::size_t kCompactBytes = 64u << 10;
+
+StreamServer::StreamServer(const std::string &address, std::size_t maxPending, double resolution) :
+    listener(StreamSocket::listen(address)),
+    unixPath(StreamSocket::unixPath(address)),
+    maxPending(maxPending),
+    resolution(resolution) {}
+
+StreamServer::~StreamServer() {
+    for (const Client &client : clients) { ::close(client.socket); }
+    ::close(listener);
+    if (!unixPath.empty()) ::unlink(unixPath.c_str());
+}
+
+void StreamServer::publish(const Simulation &sim) {
+    REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+    if (!encoder) encoder.reset(new DeltaEncoder(sim, resolution));
+    ++published;
+
+    acceptClients();
+    // without clients nothing is encoded, the next client starts with a keyframe anyway
+    if (clients.empty()) return;
+
+    const std::string delta = encoder->delta(sim) + '\n';
+    std::string keyframe;  // only encoded when a client needs it
+    for (Client &client : clients) {
+        if (client.needsKeyframe) {
+            if (client.pending() > maxPending) {
+                ++dropped;
+                continue;
+            }
+            if (keyframe.empty()) keyframe = encoder->keyframe() + '\n';
+            client.queue += keyframe;
+            client.needsKeyframe = false;
+            ++keyframes;
+        } else if (client.pending() > maxPending) {
+            // the client falls behind, the deltas it misses are made up for by the next keyframe
+            ++dropped;
+            client.needsKeyframe = true;
+        } else {
+            client.queue += delta;
+        }
+    }
+    sendAll();
+}
+
+bool StreamServer::flush(std::chrono::milliseconds timeout) {
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        sendAll();
+        std::vector<pollfd> waiting;
+        for (const Client &client : clients) {
+            if (client.pending() > 0) waiting.push_back(pollfd{client.socket, POLLOUT, 0});
+        }
+        if (waiting.empty()) return true;
+
+        const std::chrono::milliseconds left =
+          std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (left.count() <= 0) return false;
+        ::poll(waiting.data(), waiting.size(), static_cast<int>(left.count()));
+    }
+}
+
+std::size_t StreamServer::getClientCount() const { return clients.size(); }
+
+std::uint64_t StreamServer::getPublished() const { return published; }
+
+std::uint64_t StreamServer::getDropped() const { return dropped; }
+
+std::uint64_t StreamServer::getKeyframes() const { return keyframes; }
+
+void StreamServer::acceptClients() {
+    while (true) {
+        const int socket = ::accept(listener, nullptr, nullptr);
+        if (socket < 0) {
+            if (errno == EINTR) continue;
+            return;  // no more waiting connections (or a failed one, its client can retry)
+        }
+        StreamSocket::setNonBlocking(socket);
+#ifdef SO_NOSIGPIPE
+        const int noSigPipe = 1;
+        ::setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+        Client client{socket};
+        client.queue = encoder->topology() + '\n';
+        clients.push_back(std::move(client));
+    }
+}
+
+bool StreamServer::send(Client &client) {
+    while (client.pending() > 0) {
+        const ssize_t written =
+          ::send(client.socket, client.queue.data() + client.sent, client.pending(), MSG_NOSIGNAL);
+        if (written >= 0) {
+            client.sent += written;
+            continue;
+        }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        return false;
+    }
+
+    if (client.pending() == 0) {
+        client.queue.clear();
+        client.sent = 0;
+    } else if (client.sent >= kCompactBytes && client.sent * 2 >= client.queue.size()) {
+        client.queue.erase(0, client.sent);
+        client.sent = 0;
+    }
+    return true;
+}
+
+void StreamServer::sendAll() {
+    std::vector<Client>::iterator kept = clients.begin();
+    for (Client &client : clients) {
+        if (!send(client)) {
+            ::close(client.socket);
+            continue;
+        }
+        if (&*kept != &client) *kept = std::move(client);
+        ++kept;
+    }
+    clients.erase(kept, clients.end());
+}
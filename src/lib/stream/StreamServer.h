@@ -0,0 +1,110 @@
+//============================================================================
+// Name        : StreamServer.h
+// Description : Streams the frames of a running simulation to clients on a local socket
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_STREAMSERVER_H
+#define SE_PROJECT_STREAMSERVER_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DeltaEncoder.h"
+
+/**
+ * @brief Serves the state of a simulation to the clients that connect to a Unix domain socket or a localhost TCP port,
+ * as the json lines of a DeltaEncoder. \n
+ * The simulation thread calls publish() once per tick, nothing runs in the background. A client that connects gets the
+ * topology and a keyframe, then one delta per tick. Every client has its own queue of unsent bytes and is written
+ * without blocking. When the queue of a slow client is longer than the limit, its frames are dropped: it misses deltas,
+ * so it gets a fresh keyframe as soon as its queue is short again. A client that closes its socket is forgotten. \n
+ * @throws std::runtime_error If the address is invalid or cannot be listened at
+ */
+class StreamServer {
+    /// a connected client
+    struct Client {
+        int socket;                 // connected socket, non-blocking
+        std::string queue;          // bytes that still have to be sent
+        std::size_t sent = 0;       // bytes at the front of the queue that were sent
+        bool needsKeyframe = true;  // the client has no keyframe or missed a delta since
+
+        std::size_t pending() const { return queue.size() - sent; }
+    };
+
+    const int listener;            // listening socket
+    const std::string unixPath;    // path of the Unix domain socket, empty for TCP
+    const std::size_t maxPending;  // longest queue of a client before its frames are dropped
+    const double resolution;       // meters per unit of a vehicle position in the messages
+
+    std::unique_ptr<DeltaEncoder> encoder;  // created at the first publish
+    std::vector<Client> clients;
+    std::uint64_t published = 0;
+    std::uint64_t dropped = 0;
+    std::uint64_t keyframes = 0;
+
+  public:
+    /// default limit on the unsent bytes of a client
+    static constexpr std::size_t kDefaultMaxPending = 4u << 20;
+
+    /**
+     * Listens at the address, clients can connect from now on
+     * @param address unix:PATH or tcp:PORT, see StreamSocket
+     * @param maxPending longest queue of unsent bytes of a client before its frames are dropped
+     * @param resolution meters per unit of a vehicle position in the messages, see DeltaEncoder
+     */
+    explicit StreamServer(const std::string &address, std::size_t maxPending = kDefaultMaxPending,
+                          double resolution = DeltaEncoder::kDefaultResolution);
+
+    /// closes all connections and removes the Unix domain socket
+    ~StreamServer();
+
+    StreamServer(const StreamServer &) = delete;
+    StreamServer &operator=(const StreamServer &) = delete;
+
+    /**
+     * Accepts new clients, queues the current state for every client and sends what their sockets accept \n
+     * REQUIRE(sim.properlyInitialized(), "Simulation is properly initialized");
+     * @param sim simulation to stream, the same one at every call
+     */
+    void publish(const Simulation &sim);
+
+    /**
+     * Waits until every queue is sent or the timeout passed, used at the end of a run
+     * @param timeout longest time to wait
+     * @return true if every queue was sent
+     */
+    bool flush(std::chrono::milliseconds timeout);
+
+    /// @return amount of connected clients
+    std::size_t getClientCount() const;
+
+    /// @return amount of published ticks
+    std::uint64_t getPublished() const;
+
+    /// @return amount of frames that were dropped for slow clients, summed over the clients
+    std::uint64_t getDropped() const;
+
+    /// @return amount of keyframes sent, summed over the clients
+    std::uint64_t getKeyframes() const;
+
+  private:
+    void acceptClients();
+
+    /**
+     * Sends as much of the queue of a client as its socket accepts
+     * @return false if the client disconnected
+     */
+    bool send(Client &client);
+
+    /// sends the queues of all clients and forgets the clients that disconnected
+    void sendAll();
+};
+
+#endif  // SE_PROJECT_STREAMSERVER_H
@@ -0,0 +1,118 @@
+//============================================================================
+// Name        : StreamSocket.cpp
+// Description : Implementation of the sockets of the frame stream
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "StreamSocket.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "../utils/Utils.h"
+
+namespace {
+    const std::string kUnixPrefix = "unix:";
+    const std::string kTcpPrefix = "tcp:";
+
+    /// the socket address of an address string, with its length
+    struct SocketAddress {
+        sockaddr_storage storage{};
+        socklen_t length = 0;
+        int family = AF_UNIX;
+    };
+
+    SocketAddress resolve(const std::string &address) {
+        SocketAddress result;
+        if (address.compare(0, kUnixPrefix.size(), kUnixPrefix) == 0) {
+            const std::string path = address.substr(kUnixPrefix.size());
+            sockaddr_un &unixAddress = reinterpret_cast<sockaddr_un &>(result.storage);
+            if (path.empty() || path.size() >= sizeof(unixAddress.sun_path)) {
+                throw std::runtime_error("[StreamSocket] Invalid socket path: '" + path + "'.");
+            }
+            unixAddress.sun_family = AF_UNIX;
+            std::memcpy(unixAddress.sun_path, path.c_str(), path.size() + 1);
+            result.length = sizeof(sockaddr_un);
+            result.family = AF_UNIX;
+            return result;
+        }
+        if (address.compare(0, kTcpPrefix.size(), kTcpPrefix) == 0) {
+            int port = 0;
+            if (!Utils::parseInt(address.substr(kTcpPrefix.size()), port) || port <= 0 || port > 65535) {
+                throw std::runtime_error("[StreamSocket] Invalid port in address: '" + address + "'.");
+            }
+            sockaddr_in &inetAddress = reinterpret_cast<sockaddr_in &>(result.storage);
+            inetAddress.sin_family = AF_INET;
+            inetAddress.sin_port = htons(static_cast<std::uint16_t>(port));
+            inetAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            result.length = sizeof(sockaddr_in);
+            result.family = AF_INET;
+            return result;
+        }
+        throw std::runtime_error("[StreamSocket] Invalid address: '" + address + "', expected unix:PATH or tcp:PORT.");
+    }
+
+    [[noreturn]] void fail(const std::string &what, const std::string &address, int socket) {
+        const std::string reason = std::strerror(errno);
+        if (socket >= 0) ::close(socket);
+        throw std::runtime_error("[StreamSocket] Cannot " + what + " '" + address + "': " + reason + '.');
+    }
+}  // namespace
+
+int StreamSocket::listen(const std::string &address) {
+    const SocketAddress socketAddress = resolve(address);
+
+    // a socket file left behind by an earlier run would make bind fail, other files are left alone
+    const std::string path = unixPath(address);
+    struct stat status {};
+    if (!path.empty() && ::stat(path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode)) ::unlink(path.c_str());
+
+    const int socket = ::socket(socketAddress.family, SOCK_STREAM, 0);
+    if (socket < 0) fail("open a socket for", address, socket);
+    if (socketAddress.family == AF_INET) {
+        const int reuse = 1;
+        ::setsockopt(socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    }
+    if (::bind(socket, reinterpret_cast<const sockaddr *>(&socketAddress.storage), socketAddress.length) != 0) {
+        fail("bind to", address, socket);
+    }
+    if (::listen(socket, 16) != 0) fail("listen at", address, socket);
+    setNonBlocking(socket);
+    return socket;
+}
+
+int StreamSocket::connect(const std::string &address) {
+    const SocketAddress socketAddress = resolve(address);
+    const int socket = ::socket(socketAddress.family, SOCK_STREAM, 0);
+    if (socket < 0) fail("open a socket for", address, socket);
+    if (::connect(socket, reinterpret_cast<const sockaddr *>(&socketAddress.storage), socketAddress.length) != 0) {
+        fail("connect to", address, socket);
+    }
+    return socket;
+}
+
+void StreamSocket::setNonBlocking(int socket) {
+    const int flags = ::fcntl(socket, F_GETFL, 0);
+    if (flags < 0 || ::fcntl(socket, F_SETFL, flags | O_NONBLOCK) != 0) {
+        throw std::runtime_error(std::string("[StreamSocket] Cannot make a socket non-blocking: ") +
+                                 std::strerror(errno));
+    }
+}
+
+std::string StreamSocket::unixPath(const std::string &address) {
+    if (address.compare(0, kUnixPrefix.size(), kUnixPrefix) != 0) return "";
+    return address.substr(kUnixPrefix.size());
+}
@@ -0,0 +1,52 @@
+//============================================================================
+// Name        : StreamSocket.h
+// Description : Static helper class that opens the local sockets of the frame stream
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_STREAMSOCKET_H
+#define SE_PROJECT_STREAMSOCKET_H
+
+#include <string>
+
+// Note: This is a static class and thus does not need a properlyInitialized
+
+/**
+ * @brief Static helper class for the sockets of the frame stream. An address is either unix:PATH, a Unix domain socket
+ * at the given path, or tcp:PORT, a TCP socket on localhost (127.0.0.1) at the given port. \n
+ * @throws std::runtime_error If an address is invalid or a socket cannot be opened
+ */
+class StreamSocket {
+  public:
+    /**
+     * Opens a non-blocking socket that listens at the address. An existing Unix domain socket at the path (left over
+     * by an earlier run) is replaced.
+     * @param address unix:PATH or tcp:PORT
+     * @return file descriptor of the listening socket
+     */
+    static int listen(const std::string &address);
+
+    /**
+     * Connects a blocking socket to the address
+     * @param address unix:PATH or tcp:PORT
+     * @return file descriptor of the connected socket
+     */
+    static int connect(const std::string &address);
+
+    /**
+     * Makes a socket non-blocking
+     * @param socket file descriptor of the socket
+     */
+    static void setNonBlocking(int socket);
+
+    /**
+     * @param address unix:PATH or tcp:PORT
+     * @return the path of a Unix domain socket address, empty for a TCP address
+     */
+    static std::string unixPath(const std::string &address);
+};
+
+#endif  // SE_PROJECT_STREAMSOCKET_H
@@ -0,0 +1,369 @@
+//============================================================================
+// Name        : SweepRunner.cpp
+// Description : Implementation of the sweep runner
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "SweepRunner.h"
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "../../Simulation.h"
+#include "../contract/Contract.h"
+#include "../nlohmann-json/json.hpp"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    /// velocity (m/s) under which a vehicle counts as stopped, the one of LogPolicy::queueForms
+    constexpr double kStoppedVelocity = 0.1;
+
+    /// a worker process and the attempt it runs
+    struct Worker {
+        pid_t pid = -1;
+        int fd = -1;               // read end of the pipe of its result
+        std::size_t run = 0;       // index of the run
+        unsigned int attempt = 1;  // 1 for the first attempt of the run
+        Clock::time_point start;   // when the worker was forked
+        std::string output;        // what the worker wrote so far
+        bool killed = false;       // killed for exceeding the budget
+    };
+
+    /// the ini lower cases its keys, so the road of a parameter matches the name of the road in any case
+    bool sameRoad(const std::string &name, const std::string &road) {
+        return name.size() == road.size() &&
+               std::equal(name.begin(), name.end(), road.begin(), [](char a, char b) {
+                   return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+               });
+    }
+
+    /// @return the objects of the type in the network (none when the scenario has no objects of the type)
+    std::vector<Validator::Object> *objectsOf(Validator::ValMap &network, Validator::EObjectTypes type) {
+        const Validator::ValMap::iterator objects = network.find(type);
+        return objects == network.end() ? nullptr : &objects->second;
+    }
+
+    /**
+     * Sets the value of the parameter in the lights or generators of its road (or of every road)
+     * @return amount of objects that were changed
+     */
+    unsigned int applyParameter(const SweepParameter &parameter, double value, Validator::ValMap &network) {
+        const Validator::Value text = std::to_string(static_cast<long long>(value));
+        const Validator::EAttributes lightRoad(Validator::ELightAttributes::kRoadName);
+        const Validator::EAttributes lightCycle(Validator::ELightAttributes::kCycleTime);
+        const Validator::EAttributes generatorRoad(Validator::EVehicleGeneratorAttributes::kRoadName);
+        const Validator::EAttributes generatorFrequency(Validator::EVehicleGeneratorAttributes::kFrequency);
+        const Validator::EAttributes crossRoadLights(Validator::ECrossRoadAttributes::kLights);
+        const Validator::EAttributes firstRoad(Validator::ECrossRoadAttributes::kFirstRoad);
+        const Validator::EAttributes secondRoad(Validator::ECrossRoadAttributes::kSecondRoad);
+
+        unsigned int changed = 0;
+        std::vector<Validator::Object> *objects = nullptr;
+        if (parameter.target == ESweepTarget::kLightCycle) {
+            if ((objects = objectsOf(network, Validator::EObjectTypes::kLight)) != nullptr) {
+                for (Validator::Object &light : *objects) {
+                    if (!parameter.road.empty() && !sameRoad(light.at(lightRoad), parameter.road)) continue;
+                    light[lightCycle] = text;
+                    ++changed;
+                }
+            }
+            // the lights of a crossroad are on both of its roads, -1 is a crossroad without lights
+            if ((objects = objectsOf(network, Validator::EObjectTypes::kCrossRoad)) != nullptr) {
+                for (Validator::Object &crossRoad : *objects) {
+                    if (crossRoad.at(crossRoadLights).toInt() == -1) continue;
+                    if (!parameter.road.empty() && !sameRoad(crossRoad.at(firstRoad), parameter.road) &&
+                        !sameRoad(crossRoad.at(secondRoad), parameter.road))
+                        continue;
+                    crossRoad[crossRoadLights] = text;
+                    ++changed;
+                }
+            }
+        } else if (parameter.target == ESweepTarget::kGeneratorFrequency) {
+            if ((objects = objectsOf(network, Validator::EObjectTypes::kVehicleGenerator)) != nullptr) {
+                for (Validator::Object &generator : *objects) {
+                    if (!parameter.road.empty() && !sameRoad(generator.at(generatorRoad), parameter.road)) continue;
+                    generator[generatorFrequency] = text;
+                    ++changed;
+                }
+            }
+        }
+        return changed;
+    }
+
+    /// writes all of the text to the file descriptor
+    void writeAll(int fd, const std::string &text) {
+        std::size_t written = 0;
+        while (written < text.size()) {
+            const ssize_t result = ::write(fd, text.data() + written, text.size() - written);
+            if (result < 0 && errno == EINTR) continue;
+            if (result <= 0) return;
+            written += static_cast<std::size_t>(result);
+        }
+    }
+
+    /// @return seconds since the time point
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+}  // namespace
+
+SweepRunner::SweepRunner(const SweepSpec &spec, Validator::ValMap &network, std::ostream &errStream)
+    : spec(spec), network(network), errStream(errStream) {
+    REQUIRE(!network.empty(), "network contains validated input");
+
+    // a copy, so the check does not change the network
+    for (const SweepParameter &parameter : spec.parameters) {
+        if (parameter.road.empty()) continue;
+        Validator::ValMap copy = network;
+        if (applyParameter(parameter, parameter.values.front(), copy) == 0) {
+            throw std::runtime_error("[SweepRunner] Road '" + parameter.road + "' of parameter '" + parameter.name +
+                                     "' has no " +
+                                     (parameter.target == ESweepTarget::kLightCycle ? "lights." : "generators."));
+        }
+    }
+}
+
+std::vector<RunResult> SweepRunner::run() {
+    const std::size_t runs = spec.getRunCount();
+    std::vector<RunResult> results(runs);
+
+    std::size_t workers = spec.workers;
+    if (workers == 0) workers = std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, runs);
+
+    // run and attempt of every run that still has to start
+    std::deque<std::pair<std::size_t, unsigned int>> pending;
+    for (std::size_t i = 0; i < runs; ++i) pending.emplace_back(i, 1);
+
+    std::vector<Worker> active;
+    std::vector<pollfd> polled;
+    while (!pending.empty() || !active.empty()) {
+        // start workers until every slot is taken
+        while (active.size() < workers && !pending.empty()) {
+            Worker worker;
+            worker.run = pending.front().first;
+            worker.attempt = pending.front().second;
+            pending.pop_front();
+
+            int fds[2];
+            if (::pipe(fds) != 0)
+                throw std::runtime_error(std::string("[SweepRunner] Cannot create a pipe: ") + std::strerror(errno) +
+                                         '.');
+            worker.start = Clock::now();
+            worker.pid = ::fork();
+            if (worker.pid < 0) {
+                ::close(fds[0]);
+                ::close(fds[1]);
+                throw std::runtime_error(std::string("[SweepRunner] Cannot fork a worker: ") + std::strerror(errno) +
+                                         '.');
+            }
+            if (worker.pid == 0) {
+                // the worker: the network is its own copy from here on
+                ::close(fds[0]);
+                std::string line;
+                int code = 0;
+                try {
+                    const RunMetrics metrics = simulate(spec, spec.getRun(worker.run), network);
+                    line = nlohmann::json::object({{"ticksPerSecond", metrics.ticksPerSecond},
+                                                   {"vehiclesEnd", metrics.vehiclesEnd},
+                                                   {"vehiclesMean", metrics.vehiclesMean},
+                                                   {"speedMean", metrics.speedMean},
+                                                   {"stoppedShare", metrics.stoppedShare}})
+                             .dump();
+                } catch (const std::exception &e) {
+                    line = nlohmann::json::object({{"error", e.what()}}).dump();
+                    code = 1;
+                }
+                writeAll(fds[1], line);
+                // no destructors or atexit handlers of the parent run in the worker
+                ::_exit(code);
+            }
+            ::close(fds[1]);
+            worker.fd = fds[0];
+            active.push_back(std::move(worker));
+        }
+
+        // wait for output of a worker or for the first budget to run out
+        int timeout = -1;
+        if (spec.budget > 0) {
+            double remaining = spec.budget;
+            for (const Worker &worker : active) {
+                if (!worker.killed) remaining = std::min(remaining, spec.budget - secondsSince(worker.start));
+            }
+            timeout = static_cast<int>(std::ceil(std::max(0.0, remaining) * 1000));
+        }
+        polled.clear();
+        for (const Worker &worker : active) polled.push_back({worker.fd, POLLIN, 0});
+        if (::poll(polled.data(), polled.size(), timeout) < 0 && errno != EINTR)
+            throw std::runtime_error(std::string("[SweepRunner] Cannot wait for the workers: ") + std::strerror(errno) +
+                                     '.');
+
+        std::vector<Worker> running;
+        for (std::size_t i = 0; i < active.size(); ++i) {
+            Worker &worker = active[i];
+            bool done = false;
+            if (polled[i].revents != 0) {
+                char buffer[4096];
+                const ssize_t received = ::read(worker.fd, buffer, sizeof(buffer));
+                if (received > 0)
+                    worker.output.append(buffer, static_cast<std::size_t>(received));
+                else if (received == 0 || errno != EINTR)
+                    done = true;
+            }
+            if (!done) {
+                if (spec.budget > 0 && !worker.killed && secondsSince(worker.start) >= spec.budget) {
+                    // its pipe closes when it is gone
+                    ::kill(worker.pid, SIGKILL);
+                    worker.killed = true;
+                }
+                running.push_back(std::move(worker));
+                continue;
+            }
+
+            // the worker closed its pipe, collect it
+            ::close(worker.fd);
+            int status = 0;
+            while (::waitpid(worker.pid, &status, 0) < 0 && errno == EINTR) {}
+
+            RunResult &result = results[worker.run];
+            result = RunResult();
+            result.run = spec.getRun(worker.run);
+            result.attempts = worker.attempt;
+            result.metrics.wallSeconds = secondsSince(worker.start);
+
+            const nlohmann::json output = nlohmann::json::parse(worker.output, nullptr, false);
+            const bool exited = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+            if (worker.killed) {
+                result.status = ERunStatus::kTimeout;
+                std::ostringstream message;
+                message << "exceeded the budget of " << spec.budget << " s";
+                result.message = message.str();
+            } else if (exited && output.is_object() && output.contains("ticksPerSecond")) {
+                result.status = ERunStatus::kOk;
+                result.metrics.ticksPerSecond = output["ticksPerSecond"];
+                result.metrics.vehiclesEnd = output["vehiclesEnd"];
+                result.metrics.vehiclesMean = output["vehiclesMean"];
+                result.metrics.speedMean = output["speedMean"];
+                result.metrics.stoppedShare = output["stoppedShare"];
+            } else if (output.is_object() && output.contains("error")) {
+                result.message = output["error"];
+            } else if (WIFSIGNALED(status)) {
+                result.message = "killed by signal " + std::to_string(WTERMSIG(status)) + " (" +
+                                 ::strsignal(WTERMSIG(status)) + ")";
+            } else {
+                result.message = "exited with code " + std::to_string(WEXITSTATUS(status)) + " without a result";
+            }
+
+            if (result.status == ERunStatus::kOk) continue;
+            const bool retry = worker.attempt <= spec.retries;
+            errStream << "[SweepRunner] Run " << worker.run << " attempt " << worker.attempt << ": " << result.message
+                      << (retry ? ", retrying." : ".") << std::endl;
+            if (retry) pending.emplace_back(worker.run, worker.attempt + 1);
+        }
+        active = std::move(running);
+    }
+    return results;
+}
+
+void SweepRunner::applyOverrides(const SweepSpec &spec, const SweepRun &run, Validator::ValMap &network) {
+    // the values for every road first, so the ones for a single road overwrite them
+    for (const bool perRoad : {false, true}) {
+        for (std::size_t i = 0; i < spec.parameters.size(); ++i) {
+            const SweepParameter &parameter = spec.parameters[i];
+            if (parameter.road.empty() == perRoad) continue;
+            applyParameter(parameter, parameter.values[run.at[i]], network);
+        }
+    }
+}
+
+RunMetrics SweepRunner::simulate(const SweepSpec &spec, const SweepRun &run, Validator::ValMap &network) {
+    applyOverrides(spec, run, network);
+
+    std::ostream discard(nullptr);
+    Simulation sim(spec.valueOf(run, ESweepTarget::kStep, 1.0 / 60.0), discard);
+    sim.parse(network);
+    if (spec.has(ESweepTarget::kSeed))
+        sim.setSeed(static_cast<unsigned int>(spec.valueOf(run, ESweepTarget::kSeed, 0)));
+    if (spec.threads > 1) sim.setThreadCount(spec.threads);
+
+    RunMetrics metrics;
+    unsigned long long vehicleTicks = 0;
+    unsigned long long stopped = 0;
+    double speedSum = 0;
+    const Clock::time_point start = Clock::now();
+    for (unsigned int tick = 0; tick < spec.ticks; ++tick) {
+        sim.godTick();
+        for (const std::pair<const id, VehicleEntity> &vehicle : sim.getVehicles()) {
+            const double velocity = vehicle.second.getVelocity();
+            speedSum += velocity;
+            if (velocity < kStoppedVelocity) ++stopped;
+        }
+        vehicleTicks += sim.getVehicles().size();
+    }
+    metrics.wallSeconds = secondsSince(start);
+
+    metrics.ticksPerSecond = metrics.wallSeconds > 0 ? spec.ticks / metrics.wallSeconds : 0;
+    metrics.vehiclesEnd = static_cast<unsigned int>(sim.getVehicles().size());
+    if (spec.ticks > 0) metrics.vehiclesMean = static_cast<double>(vehicleTicks) / spec.ticks;
+    if (vehicleTicks > 0) {
+        metrics.speedMean = speedSum / vehicleTicks;
+        metrics.stoppedShare = static_cast<double>(stopped) / vehicleTicks;
+    }
+    return metrics;
+}
+
+void SweepRunner::writeTable(const SweepSpec &spec, const std::vector<RunResult> &results, std::ostream &outStream) {
+    outStream << "run,status,attempts";
+    for (const SweepParameter &parameter : spec.parameters) outStream << ',' << parameter.name;
+    outStream << ",wall_s,ticks_per_s,vehicles_end,vehicles_mean,speed_mean,stopped_share,message\n";
+
+    for (const RunResult &result : results) {
+        outStream << result.run.index << ',' << statusToString(result.status) << ',' << result.attempts;
+        for (std::size_t i = 0; i < spec.parameters.size(); ++i) {
+            outStream << ',' << spec.parameters[i].texts[result.run.at[i]];
+        }
+        const RunMetrics &metrics = result.metrics;
+        outStream << ',' << metrics.wallSeconds;
+        if (result.status == ERunStatus::kOk) {
+            outStream << ',' << metrics.ticksPerSecond << ',' << metrics.vehiclesEnd << ',' << metrics.vehiclesMean
+                      << ',' << metrics.speedMean << ',' << metrics.stoppedShare;
+        } else {
+            outStream << ",,,,,";
+        }
+        // quoted, the message can hold commas
+        std::string message = result.message;
+        for (std::size_t quote = message.find('"'); quote != std::string::npos; quote = message.find('"', quote + 2)) {
+            message.insert(quote, 1, '"');
+        }
+        outStream << ",\"" << message << "\"\n";
+    }
+}
+
+std::string SweepRunner::statusToString(ERunStatus status) {
+    switch (status) {
+        case ERunStatus::kOk:
+            return "ok";
+        case ERunStatus::kFailed:
+            return "failed";
+        case ERunStatus::kTimeout:
+            return "timeout";
+    }
+    return "failed";
+}
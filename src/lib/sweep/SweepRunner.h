@@ -0,0 +1,105 @@
+//============================================================================
+// Name        : SweepRunner.h
+// Description : Runs the runs of a sweep in forked worker processes that share the parsed scenario
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_SWEEPRUNNER_H
+#define SE_PROJECT_SWEEPRUNNER_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "../xml-validator/Validator.h"
+#include "SweepSpec.h"
+
+/// Measurements of a run
+struct RunMetrics {
+    double wallSeconds = 0;       // wall clock time of the run (of its last attempt)
+    double ticksPerSecond = 0;    // godTicks per wall clock second
+    unsigned int vehiclesEnd = 0;  // vehicles in the simulation after the last tick
+    double vehiclesMean = 0;      // mean amount of vehicles over the ticks
+    double speedMean = 0;         // mean velocity of the vehicles over the ticks, in m/s
+    double stoppedShare = 0;      // share of the vehicles over the ticks that stood still
+};
+
+/// Outcome of a run
+enum class ERunStatus { kOk, kFailed, kTimeout };
+
+/// Result of a run of the sweep
+struct RunResult {
+    SweepRun run;
+    ERunStatus status = ERunStatus::kFailed;
+    unsigned int attempts = 0;  // attempts it took, retries included
+    RunMetrics metrics;         // measurements, only wallSeconds is known when the run did not succeed
+    std::string message;        // why the last attempt did not succeed
+};
+
+/**
+ * @brief Runs every run of a sweep, each in its own process forked from this one. \n
+ * The scenario is validated once, before the sweep starts. Every worker inherits the validated network copy-on-write,
+ * applies the overrides of its run to the lights and generators, builds its simulation and runs it, then writes its
+ * metrics to the parent through a pipe. Only the pages a worker writes to are copied, so the workers share the
+ * network and nothing is read or parsed again. \n
+ * A run that crashes, throws or exceeds the budget of the spec (it is killed) is attempted again up to
+ * spec.retries times, after which it is reported with its status.
+ */
+class SweepRunner {
+    const SweepSpec &spec;
+    Validator::ValMap &network;
+    std::ostream &errStream;
+
+  public:
+    /**
+     * Checks that the roads of the per road parameters have lights or generators to change \n
+     * REQUIRE(!network.empty(), "network contains validated input");
+     * @param spec sweep to run, it outlives the runner
+     * @param network validated scenario, it outlives the runner. Only the workers change it, in their own copy.
+     * @param errStream stream to report runs that did not succeed to
+     * @throws std::runtime_error If a road of a parameter has no lights or generators
+     */
+    SweepRunner(const SweepSpec &spec, Validator::ValMap &network, std::ostream &errStream);
+
+    /**
+     * Runs the sweep with spec.workers processes at the same time. Flush the streams of the process before, a worker
+     * inherits what is still in their buffers.
+     * @return the result of every run, in the order of the sweep
+     * @throws std::runtime_error If a pipe or process cannot be created
+     */
+    std::vector<RunResult> run();
+
+    /**
+     * Sets the parameters of the run in the lights and generators of the network, the values for a single road
+     * after those for every road
+     * @param spec sweep of the run
+     * @param run run to set the parameters of
+     * @param network validated scenario to change
+     */
+    static void applyOverrides(const SweepSpec &spec, const SweepRun &run, Validator::ValMap &network);
+
+    /**
+     * Applies the overrides of the run to the network and runs its simulation in this process
+     * @param spec sweep of the run
+     * @param run run to simulate
+     * @param network validated scenario, it is changed
+     * @return measurements of the run
+     */
+    static RunMetrics simulate(const SweepSpec &spec, const SweepRun &run, Validator::ValMap &network);
+
+    /**
+     * Writes the results as csv: the run, its status and attempts, the value of every parameter and the metrics
+     * @param spec sweep of the results
+     * @param results results of SweepRunner::run()
+     * @param outStream stream to write to
+     */
+    static void writeTable(const SweepSpec &spec, const std::vector<RunResult> &results, std::ostream &outStream);
+
+    /// @return ok, failed or timeout
+    static std::string statusToString(ERunStatus status);
+};
+
+#endif  // SE_PROJECT_SWEEPRUNNER_H
@@ -0,0 +1,178 @@
+//============================================================================
+// Name        : SweepSpec.cpp
+// Description : Implementation of the sweep specification
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "SweepSpec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "../contract/Contract.h"
+#include "../utils/Utils.h"
+
+namespace {
+    const std::string kSweepSection = "sweep";
+    const std::string kParameterSection = "parameters";
+
+    /// @return the text without the whitespace around it
+    std::string trimmed(const std::string &text) {
+        const std::size_t first = text.find_first_not_of(" \t");
+        if (first == std::string::npos) return "";
+        return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+    }
+
+    /// parses a number of the spec, a fraction like 1/60 is allowed
+    double parseNumber(const std::string &key, const std::string &text) {
+        const std::size_t slash = text.find('/');
+        if (slash != std::string::npos) {
+            const double denominator = parseNumber(key, text.substr(slash + 1));
+            if (denominator == 0) throw std::runtime_error("[SweepSpec] Value of '" + key + "' divides by zero.");
+            return parseNumber(key, text.substr(0, slash)) / denominator;
+        }
+        double result = 0;
+        if (!Utils::parseDouble(text, result) || !std::isfinite(result) || result < 0)
+            throw std::runtime_error("[SweepSpec] Value of '" + key + "' is not a positive number: '" + text + "'.");
+        return result;
+    }
+
+    /// parses an unsigned integer of the spec, smaller than or equal to max
+    unsigned int parseUnsigned(const std::string &key, const std::string &text, double max) {
+        double result = 0;
+        if (!Utils::parseDouble(text, result) || result < 0 || result > max || result != std::floor(result))
+            throw std::runtime_error("[SweepSpec] Value of '" + key + "' is not an unsigned integer: '" + text + "'.");
+        return static_cast<unsigned int>(result);
+    }
+
+    /// parses the comma separated values of a parameter
+    void parseValues(SweepParameter &parameter, const std::string &text) {
+        std::size_t begin = 0;
+        while (begin <= text.size()) {
+            const std::size_t comma = std::min(text.find(',', begin), text.size());
+            const std::string value = trimmed(text.substr(begin, comma - begin));
+            begin = comma + 1;
+            if (value.empty())
+                throw std::runtime_error("[SweepSpec] Parameter '" + parameter.name + "' has an empty value.");
+
+            double number = 0;
+            if (parameter.target == ESweepTarget::kStep) {
+                number = parseNumber(parameter.name, value);
+                if (number == 0) throw std::runtime_error("[SweepSpec] Value of 'step' is zero.");
+            } else {
+                // seeds are unsigned, cycles and frequencies end up in an int of the xml
+                const bool seed = parameter.target == ESweepTarget::kSeed;
+                number = parseUnsigned(parameter.name, value, seed ? 4294967295.0 : 2147483647.0);
+                if (!seed && number == 0)
+                    throw std::runtime_error("[SweepSpec] Value of '" + parameter.name + "' is zero.");
+            }
+            parameter.texts.push_back(value);
+            parameter.values.push_back(number);
+        }
+    }
+}  // namespace
+
+SweepSpec SweepSpec::read(const std::string &path) {
+    const mINI::INIFile file(path);
+    mINI::INIStructure ini;
+    if (!file.read(ini)) throw std::runtime_error("[SweepSpec] Cannot read sweep specification: '" + path + "'.");
+    return parse(ini);
+}
+
+SweepSpec SweepSpec::parse(const mINI::INIStructure &ini) {
+    for (const std::pair<std::string, mINI::INIMap<std::string>> &section : ini) {
+        if (section.first != kSweepSection && section.first != kParameterSection)
+            throw std::runtime_error("[SweepSpec] Unknown section: '[" + section.first + "]'.");
+    }
+
+    SweepSpec spec;
+    for (const std::pair<std::string, std::string> &entry : ini.get(kSweepSection)) {
+        const std::string &key = entry.first;
+        const std::string value = trimmed(entry.second);
+        if (key == "scenario") {
+            spec.scenarioPath = value;
+        } else if (key == "ticks") {
+            spec.ticks = parseUnsigned(key, value, 4294967295.0);
+        } else if (key == "workers") {
+            spec.workers = parseUnsigned(key, value, 4294967295.0);
+        } else if (key == "budget") {
+            spec.budget = parseNumber(key, value);
+        } else if (key == "retries") {
+            spec.retries = parseUnsigned(key, value, 4294967295.0);
+        } else if (key == "threads") {
+            spec.threads = parseUnsigned(key, value, 4294967295.0);
+            if (spec.threads == 0) throw std::runtime_error("[SweepSpec] Value of 'threads' is zero.");
+        } else if (key == "output") {
+            spec.outputPath = value;
+        } else {
+            throw std::runtime_error("[SweepSpec] Unknown key in [sweep]: '" + key + "'.");
+        }
+    }
+    if (spec.scenarioPath.empty()) throw std::runtime_error("[SweepSpec] [sweep] has no scenario.");
+
+    for (const std::pair<std::string, std::string> &entry : ini.get(kParameterSection)) {
+        SweepParameter parameter;
+        parameter.name = entry.first;
+
+        const std::size_t at = entry.first.find('@');
+        const std::string kind = entry.first.substr(0, at);
+        if (at != std::string::npos) parameter.road = trimmed(entry.first.substr(at + 1));
+
+        if (kind == "step") {
+            parameter.target = ESweepTarget::kStep;
+        } else if (kind == "seed") {
+            parameter.target = ESweepTarget::kSeed;
+        } else if (kind == "light_cycle") {
+            parameter.target = ESweepTarget::kLightCycle;
+        } else if (kind == "generator_frequency") {
+            parameter.target = ESweepTarget::kGeneratorFrequency;
+        } else {
+            throw std::runtime_error("[SweepSpec] Unknown parameter: '" + entry.first + "'.");
+        }
+        const bool perRoad = parameter.target == ESweepTarget::kLightCycle ||
+                             parameter.target == ESweepTarget::kGeneratorFrequency;
+        if (at != std::string::npos && (!perRoad || parameter.road.empty()))
+            throw std::runtime_error("[SweepSpec] Parameter '" + entry.first + "' cannot be given per road.");
+
+        parseValues(parameter, entry.second);
+        spec.parameters.push_back(std::move(parameter));
+    }
+    return spec;
+}
+
+std::size_t SweepSpec::getRunCount() const {
+    std::size_t runs = 1;
+    for (const SweepParameter &parameter : parameters) runs *= parameter.values.size();
+    return runs;
+}
+
+SweepRun SweepSpec::getRun(std::size_t index) const {
+    REQUIRE(index < getRunCount(), "index is a run of the sweep");
+    SweepRun run;
+    run.index = index;
+    run.at.resize(parameters.size());
+    // the index in a mixed radix, one digit per parameter
+    for (std::size_t i = parameters.size(); i-- > 0;) {
+        run.at[i] = index % parameters[i].values.size();
+        index /= parameters[i].values.size();
+    }
+    return run;
+}
+
+double SweepSpec::valueOf(const SweepRun &run, ESweepTarget target, double fallback) const {
+    for (std::size_t i = 0; i < parameters.size(); ++i) {
+        if (parameters[i].target == target && parameters[i].road.empty()) return parameters[i].values[run.at[i]];
+    }
+    return fallback;
+}
+
+bool SweepSpec::has(ESweepTarget target) const {
+    for (const SweepParameter &parameter : parameters) {
+        if (parameter.target == target) return true;
+    }
+    return false;
+}
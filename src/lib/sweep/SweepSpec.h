@@ -0,0 +1,95 @@
+//============================================================================
+// Name        : SweepSpec.h
+// Description : Specification of a parameter sweep: the scenario, its budget and the values of every parameter
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_SWEEPSPEC_H
+#define SE_PROJECT_SWEEPSPEC_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../mini/ini.h"
+
+/// What a parameter of a sweep changes
+enum class ESweepTarget { kStep, kSeed, kLightCycle, kGeneratorFrequency };
+
+/// A parameter of a sweep and the values it takes
+struct SweepParameter {
+    std::string name;                // key in the spec, for example light_cycle@driesstraat
+    ESweepTarget target;             // what the parameter changes
+    std::string road;                // only the lights or generators of this road (empty: of every road)
+    std::vector<std::string> texts;  // values as written in the spec
+    std::vector<double> values;      // parsed values, in the same order
+};
+
+/// One combination of parameter values, a single run of the simulation
+struct SweepRun {
+    std::size_t index = 0;        // position of the run in the sweep
+    std::vector<std::size_t> at;  // index of the value of every parameter, in the order of SweepSpec::parameters
+};
+
+/**
+ * @brief Specification of a sweep, read from an ini file: \n
+ * [sweep] scenario (xml file, relative to the working directory), ticks, workers (0: one per hardware thread),
+ * budget (wall clock seconds of a run, 0: unlimited), retries (extra attempts of a failed run), threads (of every
+ * simulation) and output (csv file, empty: stdout) \n
+ * [parameters] comma separated values of step (fractions like 1/60 are allowed), seed, light_cycle and
+ * generator_frequency. light_cycle@ROAD and generator_frequency@ROAD only change the lights (also on crossroads) or
+ * generators of one road and win over the value for every road. \n
+ * The runs are every combination of the values, a sweep without parameters is a single run of the scenario as it is.
+ * Without a seed parameter the runs are seeded randomly, like sim without --seed.
+ * @throws std::runtime_error If the file cannot be read or a key or value is invalid
+ */
+struct SweepSpec {
+    std::string scenarioPath;             // xml file to load
+    unsigned int ticks = 3600;            // amount of godTicks of every run
+    unsigned int workers = 0;             // runs at the same time (0: one per hardware thread)
+    double budget = 0;                    // wall clock seconds after which a run is stopped (0: unlimited)
+    unsigned int retries = 1;             // extra attempts of a run that failed or ran out of budget
+    unsigned int threads = 1;             // worker threads of every simulation
+    std::string outputPath;               // csv file to write the results to (empty: stdout)
+    std::vector<SweepParameter> parameters;
+
+    /**
+     * Reads the specification from an ini file
+     * @param path ini file
+     * @return specification
+     */
+    static SweepSpec read(const std::string &path);
+
+    /**
+     * Reads the specification from a parsed ini file (its keys are lower case)
+     * @param ini parsed ini file
+     * @return specification
+     */
+    static SweepSpec parse(const mINI::INIStructure &ini);
+
+    /// @return amount of runs, the product of the amount of values of every parameter
+    std::size_t getRunCount() const;
+
+    /**
+     * REQUIRE(index < getRunCount(), "index is a run of the sweep");
+     * @param index position of the run, the last parameter changes fastest
+     * @return values of the run
+     */
+    SweepRun getRun(std::size_t index) const;
+
+    /**
+     * @param run run of this sweep
+     * @param target parameter target
+     * @param fallback value when the sweep has no parameter for every road with the target
+     * @return value of the parameter for every road with the target in the run
+     */
+    double valueOf(const SweepRun &run, ESweepTarget target, double fallback) const;
+
+    /// @return true if a parameter of the sweep has the target
+    bool has(ESweepTarget target) const;
+};
+
+#endif  // SE_PROJECT_SWEEPSPEC_H
@@ -0,0 +1,114 @@
+//============================================================================
+// Name        : Parallel.cpp
+// Description : Implementation of the worker pool
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include "Parallel.h"
+
+#include <algorithm>
+
+#include "../contract/Contract.h"
+
+namespace Utils {
+    WorkerPool::WorkerPool(unsigned int threads) {
+        REQUIRE(threads > 0, "at least one thread");
+        start(threads);
+    }
+
+    WorkerPool::~WorkerPool() { stop(); }
+
+    void WorkerPool::resize(unsigned int threads) {
+        REQUIRE(threads > 0, "at least one thread");
+        if (threads == getThreadCount()) return;
+        stop();
+        start(threads);
+        ENSURE(getThreadCount() == threads, "thread count is set");
+    }
+
+    unsigned int WorkerPool::getThreadCount() const { return (unsigned int) workers.size() + 1; }
+
+    void WorkerPool::run(std::size_t loopCount, const void *loopFunction,
+                         void (*loopCall)(const void *, std::size_t, std::size_t)) {
+        const std::size_t loopChunks = std::min<std::size_t>(getThreadCount(), loopCount / kMinParallelChunk);
+        if (loopChunks <= 1) {
+            loopCall(loopFunction, 0, loopCount);
+            return;
+        }
+
+        const std::size_t loopChunkSize = (loopCount + loopChunks - 1) / loopChunks;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            ++generation;
+            call = loopCall;
+            function = loopFunction;
+            count = loopCount;
+            chunks = loopChunks;
+            chunkSize = loopChunkSize;
+            pending = loopChunks - 1;
+        }
+        wakeWorkers.notify_all();
+
+        // the workers use the function until they are done, also when the first chunk throws
+        try {
+            loopCall(loopFunction, 0, loopChunkSize);
+        } catch (...) {
+            waitForChunks();
+            throw;
+        }
+        waitForChunks();
+    }
+
+    void WorkerPool::waitForChunks() {
+        std::unique_lock<std::mutex> lock(mutex);
+        chunksDone.wait(lock, [this]() { return pending == 0; });
+    }
+
+    void WorkerPool::work(std::size_t worker) {
+        std::uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wakeWorkers.wait(lock, [this, seen]() { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+
+            // short loops are not split over every worker
+            if (worker >= chunks) continue;
+
+            const std::size_t begin = worker * chunkSize;
+            const std::size_t end = std::min(count, begin + chunkSize);
+            void (*const loopCall)(const void *, std::size_t, std::size_t) = call;
+            const void *const loopFunction = function;
+            lock.unlock();
+            loopCall(loopFunction, begin, end);
+            lock.lock();
+
+            if (--pending == 0) chunksDone.notify_one();
+        }
+    }
+
+    void WorkerPool::start(unsigned int threads) {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            stopping = false;
+            chunks = 0;
+        }
+        workers.reserve(threads - 1);
+        for (std::size_t worker = 1; worker < threads; ++worker) {
+            workers.emplace_back([this, worker]() { work(worker); });
+        }
+    }
+
+    void WorkerPool::stop() {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeWorkers.notify_all();
+        for (std::thread &worker : workers) worker.join();
+        workers.clear();
+    }
+}  // namespace Utils
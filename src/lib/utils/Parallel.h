@@ -0,0 +1,102 @@
+//============================================================================
+// Name        : Parallel.h
+// Description : Pool of persistent worker threads to split a loop over
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/24
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_PARALLEL_H
+#define SE_PROJECT_PARALLEL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Utils {
+    /// loops shorter than this per thread are not worth waking a thread for
+    const std::size_t kMinParallelChunk = 256;
+
+    /**
+     * @brief Worker threads that are started once and wait for loops to split. \n
+     * A loop is cut into consecutive chunks, chunk 0 runs on the calling thread and chunk k always runs on worker k,
+     * so a worker keeps the same part of the loop from call to call. Handing out a loop only takes a lock and a
+     * wake up, no thread is started and the heap is not touched. One thread at a time may hand out loops.
+     */
+    class WorkerPool {
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wakeWorkers;
+        std::condition_variable chunksDone;
+        bool stopping = false;
+
+        // the loop that is handed out, guarded by the mutex
+        std::uint64_t generation = 0;  // counts the loops, a worker waits until it changes
+        void (*call)(const void *, std::size_t, std::size_t) = nullptr;  // calls the function of the loop
+        const void *function = nullptr;                                    // function of the loop
+        std::size_t count = 0;                                             // amount of iterations of the loop
+        std::size_t chunks = 0;                                            // amount of chunks of the loop
+        std::size_t chunkSize = 0;                                         // iterations per chunk
+        std::size_t pending = 0;                                           // chunks of workers that are not done
+
+      public:
+        /**
+         * Starts threads - 1 workers, the calling thread is the other one \n
+         * REQUIRE(threads > 0, "at least one thread");
+         * @param threads amount of threads a loop is split over (including the calling thread)
+         */
+        explicit WorkerPool(unsigned int threads = 1);
+
+        /// stops and joins the workers
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool &) = delete;
+        WorkerPool &operator=(const WorkerPool &) = delete;
+
+        /**
+         * Stops the workers and starts threads - 1 new ones, must not be called while a loop runs \n
+         * REQUIRE(threads > 0, "at least one thread"); \n
+         * ENSURE(getThreadCount() == threads, "thread count is set");
+         * @param threads amount of threads a loop is split over (including the calling thread)
+         */
+        void resize(unsigned int threads);
+
+        /// @return amount of threads a loop is split over (including the calling thread)
+        unsigned int getThreadCount() const;
+
+        /**
+         * Calls function(begin, end) on consecutive chunks of [0, count), one chunk per thread at most. The calling
+         * thread handles the first chunk itself and returns when all chunks are done. The chunks must be independent
+         * of each other. With one thread (or a short loop) everything runs on the calling thread.
+         * @param count amount of iterations
+         * @param function function taking the (begin, end) of a chunk
+         */
+        template <typename Function>
+        void parallelFor(std::size_t count, const Function &function) {
+            run(count, &function, [](const void *function, std::size_t begin, std::size_t end) {
+                (*static_cast<const Function *>(function))(begin, end);
+            });
+        }
+
+      private:
+        /// hands the chunks of a loop to the workers, runs the first one and waits for the others
+        void run(std::size_t loopCount, const void *loopFunction,
+                 void (*loopCall)(const void *, std::size_t, std::size_t));
+
+        /// waits until the workers finished their chunks of the current loop
+        void waitForChunks();
+
+        /// loop of worker thread k: runs chunk k of every loop that has one
+        void work(std::size_t worker);
+
+        void start(unsigned int threads);
+
+        void stop();
+    };
+}  // namespace Utils
+
+#endif  // SE_PROJECT_PARALLEL_H
@@ -0,0 +1,53 @@
+//============================================================================
+// Name        : Span.h
+// Description : Read only view over a contiguous range of values
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_SPAN_H
+#define SE_PROJECT_SPAN_H
+
+#include <cstddef>
+
+/**
+ * Presents a contiguous range of values (a part of a std::vector or an array) without copying it, like the std::span
+ * of C++20. The span only holds a pointer and a size, it is invalidated with the values.
+ */
+template <typename T>
+class Span {
+    const T *first = nullptr;
+    std::size_t count = 0;
+
+  public:
+    using value_type = T;
+    using const_iterator = const T *;
+
+    Span() = default;
+
+    /**
+     * @param first first value of the range
+     * @param count amount of values in the range
+     */
+    Span(const T *first, std::size_t count) : first(first), count(count) {}
+
+    const_iterator begin() const { return first; }
+
+    const_iterator end() const { return first + count; }
+
+    /// @return value at the index, the index is not checked
+    const T &operator[](std::size_t index) const { return first[index]; }
+
+    /// @return first value of the range, nullptr if the span was never given one
+    const T *data() const { return first; }
+
+    /// @return amount of values in the range
+    std::size_t size() const { return count; }
+
+    /// @return true if the range holds no values
+    bool empty() const { return count == 0; }
+};
+
+#endif  // SE_PROJECT_SPAN_H
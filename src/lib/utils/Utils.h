@@ -10,38 +10,105 @@
 #ifndef SE_PROJECT_UTILS_H
 #define SE_PROJECT_UTILS_H
 
-#include <sstream>
-
-#include <sstream>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 #include <string>
+#include <system_error>
 
 namespace Utils {
+    /**
+     * Parses the full string as an integer, without building a stream
+     * @param s text to parse, an optional minus sign followed by digits
+     * @param result is set to the value of the text if it is a valid integer
+     * @return true if the full text is a valid integer that fits in an int
+     */
+    inline bool parseInt(const std::string &s, int &result) {
+        const char *const end = s.data() + s.size();
+        const std::from_chars_result parsed = std::from_chars(s.data(), end, result);
+        return parsed.ec == std::errc() && parsed.ptr == end;
+    }
+
+    /**
+     * Parses the full string as a floating point number, without building a stream
+     * @param s text to parse, in fixed or scientific notation
+     * @param result is set to the value of the text if it is a valid number
+     * @return true if the full text is a valid number that fits in a double
+     */
+    inline bool parseDouble(const std::string &s, double &result) {
+        const char *const end = s.data() + s.size();
+        const std::from_chars_result parsed = std::from_chars(s.data(), end, result);
+        return parsed.ec == std::errc() && parsed.ptr == end;
+    }
+
     /**
      * Converts a string to the integer value it represents
      * @param s
      * @return int
+     * @throws std::runtime_error if the full string is not an integer
      */
     inline int stoi(const std::string &s) {
         int result = 0;
-        int factor = 1;
-        for (std::string::const_reverse_iterator it = s.rbegin(); it != s.rend(); ++it) {
-            if (it == s.rend() - 1 && *it == 45) {
-                result *= -1;
-            } else if (!(48 <= *it && *it <= 57)) {
-                throw std::runtime_error("[Utils::stoi] Conversion error, cannot convert '" + s + "' to an integer.");
-            } else {
-                result += (*it - '0') * factor;
-                factor *= 10;
-            }
+        if (!parseInt(s, result)) {
+            throw std::runtime_error("[Utils::stoi] Conversion error, cannot convert '" + s + "' to an integer.");
         }
         return result;
     }
 
+    /**
+     * Converts a string to the floating point value it represents
+     * @param s
+     * @return double
+     * @throws std::runtime_error if the full string is not a number
+     */
     inline double stod(const std::string &s) {
-        std::stringstream str(s);
-        double tmp = 0;
-        str >> tmp;
-        return tmp;
+        double result = 0;
+        if (!parseDouble(s, result)) {
+            throw std::runtime_error("[Utils::stod] Conversion error, cannot convert '" + s + "' to a number.");
+        }
+        return result;
+    }
+
+    /**
+     * Returns the value after adding step to it count times, rounded after every addition exactly like the loop
+     * would be, without doing every addition. Between two powers of two the doubles are evenly spaced, so every
+     * addition that stays well within that range adds the same amount: step rounded to that spacing. Only the
+     * additions that cross a power of two (or that round half way) are done one by one.
+     * @param value start value, zero or positive
+     * @param step amount added every time, positive
+     * @param count amount of additions
+     * @return the value after count additions
+     */
+    inline double addRepeatedly(double value, const double step, unsigned long count) {
+        const double kUnits = 9007199254740992.0;  // 2^53, the spacing of the doubles in [2^52, 2^53) is 1
+
+        while (count > 0) {
+            if (value >= std::numeric_limits<double>::min()) {
+                // value lies in [2^(exponent - 1), 2^exponent), where the doubles are the multiples of spacing
+                int exponent = 0;
+                std::frexp(value, &exponent);
+                const double spacing = std::ldexp(1.0, exponent - 53);
+                const double units = step / spacing;
+                const double increment = std::nearbyint(units);
+
+                // too small to change the value (a tie rounds to even, so it is done one by one below)
+                if (increment == 0 && units < 0.5) return value;
+
+                // the additions stay at least two spacings below 2^exponent, so each one rounds within the range
+                const double room = std::floor((kUnits - 2 - value / spacing) / increment);
+                if (units < kUnits && units - std::floor(units) != 0.5 && room >= 1) {
+                    const double additions = std::min(room, (double) count);
+                    value = (value / spacing + additions * increment) * spacing;
+                    count -= (unsigned long) additions;
+                    continue;
+                }
+            }
+            value += step;
+            --count;
+        }
+        return value;
     }
 }  // namespace Utils
 
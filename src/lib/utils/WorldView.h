@@ -0,0 +1,130 @@
+//============================================================================
+// Name        : WorldView.h
+// Description : Read only view over the locations of the moving and the static objects of a simulation
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_WORLDVIEW_H
+#define SE_PROJECT_WORLDVIEW_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "Id.h"
+
+/**
+ * Presents two location maps (objectId to roadId + position) as one, without copying them: the locations of the
+ * objects that move (vehicles) and of the objects that never move (lights, bus stops, crossroads and generators).
+ * Iterating visits the moving objects first. The view only holds references, it is invalidated with the maps.
+ */
+class WorldView {
+  public:
+    using Map = std::unordered_map<id, std::pair<id, double>>;
+
+    /// Forward iterator over the moving objects followed by the static ones
+    class const_iterator {
+        Map::const_iterator current;
+        Map::const_iterator dynamicEnd;
+        Map::const_iterator staticBegin;
+        bool inStatic;
+
+        /// continues in the static objects after the last moving object
+        void skipToStatic() {
+            if (!inStatic && current == dynamicEnd) {
+                inStatic = true;
+                current = staticBegin;
+            }
+        }
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Map::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+
+        const_iterator(Map::const_iterator current, Map::const_iterator dynamicEnd, Map::const_iterator staticBegin,
+                       bool inStatic) :
+            current(current), dynamicEnd(dynamicEnd), staticBegin(staticBegin), inStatic(inStatic) {
+            skipToStatic();
+        }
+
+        reference operator*() const { return *current; }
+
+        pointer operator->() const { return &*current; }
+
+        const_iterator &operator++() {
+            ++current;
+            skipToStatic();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const const_iterator &other) const {
+            return inStatic == other.inStatic && current == other.current;
+        }
+
+        bool operator!=(const const_iterator &other) const { return !(*this == other); }
+    };
+
+  private:
+    const Map &dynamicObjects;
+    const Map &staticObjects;
+
+  public:
+    /**
+     * @param dynamicObjects locations of the objects that move
+     * @param staticObjects locations of the objects that never move, no id is in both maps
+     */
+    WorldView(const Map &dynamicObjects, const Map &staticObjects) :
+        dynamicObjects(dynamicObjects), staticObjects(staticObjects) {}
+
+    const_iterator begin() const {
+        return {dynamicObjects.begin(), dynamicObjects.end(), staticObjects.begin(), false};
+    }
+
+    const_iterator end() const { return {staticObjects.end(), dynamicObjects.end(), staticObjects.begin(), true}; }
+
+    /**
+     * @param objectId id of the object
+     * @return iterator to the location of the object, end() if it is not in the world
+     */
+    const_iterator find(const id objectId) const {
+        const Map::const_iterator location = dynamicObjects.find(objectId);
+        if (location != dynamicObjects.end()) {
+            return {location, dynamicObjects.end(), staticObjects.begin(), false};
+        }
+        return {staticObjects.find(objectId), dynamicObjects.end(), staticObjects.begin(), true};
+    }
+
+    /**
+     * @param objectId id of the object
+     * @return roadId and position of the object, throws std::out_of_range if it is not in the world
+     */
+    const Map::mapped_type &at(const id objectId) const {
+        const Map::const_iterator location = dynamicObjects.find(objectId);
+        return location != dynamicObjects.end() ? location->second : staticObjects.at(objectId);
+    }
+
+    /// @return 1 if the object is in the world, 0 otherwise
+    std::size_t count(const id objectId) const { return dynamicObjects.count(objectId) + staticObjects.count(objectId); }
+
+    /// @return amount of objects in the world
+    std::size_t size() const { return dynamicObjects.size() + staticObjects.size(); }
+
+    /// @return true if there are no objects in the world
+    bool empty() const { return size() == 0; }
+};
+
+#endif  // SE_PROJECT_WORLDVIEW_H
@@ -1,15 +0,0 @@
-//============================================================================
-// Name        : SimulationTest.cpp
-// Description : TrafficSimulation tests entry (made using the googletest library)
-// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
-//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
-// Date        : 2022/03/03
-// Version     : 1.0
-//============================================================================
-
-#include <gtest/gtest.h>
-
-int main(int argc, char **argv) {
-    ::testing::InitGoogleTest(&argc, argv);
-    return RUN_ALL_TESTS();
-}
\ No newline at end of file
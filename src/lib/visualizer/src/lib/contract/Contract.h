@@ -1,15 +0,0 @@
-//============================================================================
-// Name        : DesignByContract.h
-// Author      : Serge Demeter
-// Version     :
-// Copyright   : Project Software Engineering - BA1 Informatica - Serge Demeyer - University of Antwerp
-// Description : Declarations for design by contract in C++
-//============================================================================
-
-#include <assert.h>
-
-#define REQUIRE(assertion, what) \
-    if (!(assertion)) __assert(what, __FILE__, __LINE__)
-
-#define ENSURE(assertion, what) \
-    if (!(assertion)) __assert(what, __FILE__, __LINE__)
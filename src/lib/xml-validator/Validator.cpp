@@ -9,6 +9,7 @@
 
 #include "Validator.h"
 #include "../contract/Contract.h"
+#include "../profiler/Tracer.h"
 #include "../pugixml/pugixml.hpp"
 #include "../utils/Utils.h"
 
@@ -23,6 +24,8 @@
  * @return ValMap that contains the correct values for the simulation parser if valid, else it is empty.
  */
 Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errStream) {
+    SIM_TRACE_SCOPE("Validator::validate");
+
     // parse xml file
     pugi::xml_document doc;
     pugi::xml_parse_result res = doc.load(istream);
@@ -55,7 +58,10 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             for (const pugi::xml_node &attribute : object.children()) {
                 if (std::find(requiredAttributes.at(EObjectTypes::kRoad).begin(),
                               requiredAttributes.at(EObjectTypes::kRoad).end(),
-                              attribute.name()) == requiredAttributes.at(EObjectTypes::kRoad).end()) {
+                              attribute.name()) == requiredAttributes.at(EObjectTypes::kRoad).end() &&
+                    std::find(optionalAttributes.at(EObjectTypes::kRoad).begin(),
+                              optionalAttributes.at(EObjectTypes::kRoad).end(),
+                              attribute.name()) == optionalAttributes.at(EObjectTypes::kRoad).end()) {
                     errStream << "[XmlValidator] Attribute '" << attribute.name()
                               << "' is not known for object type 'road'."
                               << "\n";
@@ -75,7 +81,8 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             if (falseAttribute) continue;
 
             // check missing attributes
-            if (attributes.size() != requiredAttributes.at(EObjectTypes::kRoad).size()) {
+            const bool levelSet = std::find(attributes.begin(), attributes.end(), "niveau") != attributes.end();
+            if (attributes.size() - levelSet != requiredAttributes.at(EObjectTypes::kRoad).size()) {
                 errStream << "[XmlValidator] Not all required attributes for type 'road' are set (required: ";
                 for (std::vector<std::string>::const_iterator it = requiredAttributes.at(EObjectTypes::kRoad).begin();
                      it != requiredAttributes.at(EObjectTypes::kRoad).end(); ++it) {
@@ -108,6 +115,11 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             config[EObjectTypes::kRoad].push_back(
               {{EAttributes(ERoadAttributes::kName), name}, {EAttributes(ERoadAttributes::kLength), length}});
 
+            // the level is optional, roads without one are microscopic
+            if (levelSet)
+                config[EObjectTypes::kRoad].back()[EAttributes(ERoadAttributes::kLevel)] =
+                  object.child("niveau").text().as_string();
+
         } else if (std::string(object.name()) == "VERKEERSLICHT") {
             // check only valid attributes are set
             bool falseAttribute = false;
@@ -399,54 +411,59 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
     if (error) return {};
 
     // Validate map
-    std::vector<std::string> validatedRoads;
+    std::unordered_map<std::string, const Object *> validatedRoads;  // valid roads by name
     /* To validate the map the following order is maintained: roads > lights > vehicles */
 
     // ==== go over all roads ====
-    std::vector<Object> roads;
-    bool found = true;
-    try {
-        roads = config.at(EObjectTypes::kRoad);
-    } catch (const std::exception &e) { found = false; }
-    if (found) {
-        for (const Object &road : roads) {
+    const ValMap::const_iterator roads = config.find(EObjectTypes::kRoad);
+    if (roads != config.end()) {
+        for (const Object &road : roads->second) {
             /* For the roads only the types need to validated */
             try {
                 // check if road length is a valid integer
-                const int length = Utils::stoi(road.at(EAttributes(ERoadAttributes::kLength)));
+                const int length = road.at(EAttributes(ERoadAttributes::kLength)).toInt();
                 if (length <= 0) throw std::exception();
-                validatedRoads.push_back(road.at(EAttributes(ERoadAttributes::kName)));
             } catch (std::exception &e) {
                 errStream << "[XmlValidator] road length is not a valid unsigned integer (length: "
                           << road.at(EAttributes(ERoadAttributes::kLength)) << ")."
                           << "\n";
                 error = true;
+                continue;
+            }
+
+            // check if the level of detail is known
+            const Object::const_iterator level = road.find(EAttributes(ERoadAttributes::kLevel));
+            if (level != road.end() &&
+                std::find(roadLevels.begin(), roadLevels.end(), level->second) == roadLevels.end()) {
+                errStream << "[XmlValidator] road level is not known (level: " << level->second
+                          << "). Allowed levels are: micro, meso."
+                          << "\n";
+                error = true;
+                continue;
             }
+
+            validatedRoads.insert({road.at(EAttributes(ERoadAttributes::kName)), &road});
         }
     }
 
     // ==== validate the lights ====
-    std::vector<Object> lights;
     std::unordered_map<std::string, std::vector<double>> lightPositions;
-    found = true;
-    try {
-        lights = config.at(EObjectTypes::kLight);
-    } catch (const std::exception &e) { found = false; }
-    if (found) {
-        for (const Object &light : lights) {
+    const ValMap::const_iterator lights = config.find(EObjectTypes::kLight);
+    if (lights != config.end()) {
+        for (const Object &light : lights->second) {
             /* Lights can only be spawned on an existing road and within the roads length. The types also need
              * validating */
-            const std::string roadName = light.at(EAttributes(ELightAttributes::kRoadName));
-            const std::string positionString = light.at(EAttributes(ELightAttributes::kPosition));
-            const std::string cycleTimeString = light.at(EAttributes(ELightAttributes::kCycleTime));
+            const std::string &roadName = light.at(EAttributes(ELightAttributes::kRoadName));
+            const Value &positionString = light.at(EAttributes(ELightAttributes::kPosition));
+            const Value &cycleTimeString = light.at(EAttributes(ELightAttributes::kCycleTime));
 
             // check types before checking semantic validity
             bool incorrectType = false;
 
             // check that the position type is valid
-            int position;
+            int position = 0;
             try {
-                position = Utils::stoi(positionString);
+                position = positionString.toInt();
                 if (position < 0) throw std::exception();
             } catch (const std::exception &e) {
                 errStream << "[XmlValidator] Cannot create light at a position that is not an integer or that is "
@@ -458,9 +475,9 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             }
 
             // check that the cycleTime type is valid
-            int cycleTime;
+            int cycleTime = 0;
             try {
-                cycleTime = Utils::stoi(cycleTimeString);
+                cycleTime = cycleTimeString.toInt();
                 if (cycleTime < 0) throw std::exception();
             } catch (const std::exception &e) {
                 errStream << "[XmlValidator] Cannot create light with a cycle time that is not an integer or that is "
@@ -474,10 +491,10 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             if (incorrectType) continue;
 
             // check that the road exists
-            if (std::find(validatedRoads.begin(), validatedRoads.end(), roadName) != validatedRoads.end()) {
+            if (validatedRoads.find(roadName) != validatedRoads.end()) {
                 // check that the spawn happens within road length
-                const Object road = findRoadWithName(roadName, config);
-                if (Utils::stoi(road.at(EAttributes(ERoadAttributes::kLength))) < position) {
+                const Object &road = *validatedRoads.at(roadName);
+                if (road.at(EAttributes(ERoadAttributes::kLength)).toInt() < position) {
                     errStream
                       << "[XmlValidator] Cannot create light at a position that is outside the road (road length: "
                       << road.at(EAttributes(ERoadAttributes::kLength)) << "; position: " << positionString << ")."
@@ -508,28 +525,24 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
         }
     }
 
-    std::vector<Object> vehicles;
-    found = true;
-    try {
-        vehicles = config.at(EObjectTypes::kVehicle);
-    } catch (const std::exception &e) { found = false; }
+    const ValMap::const_iterator vehicles = config.find(EObjectTypes::kVehicle);
 
-    if (found) {
+    if (vehicles != config.end()) {
         // ==== validate the vehicles ====
-        for (const Object &vehicle : vehicles) {
+        for (const Object &vehicle : vehicles->second) {
             /* Vehicles can only be spawned on an existing road and within the roads length. The types also need
              * validating */
-            const std::string roadName = vehicle.at(EAttributes(EVehicleAttributes::kRoadName));
-            const std::string positionString = vehicle.at(EAttributes(EVehicleAttributes::kPosition));
-            const std::string type = vehicle.at(EAttributes(EVehicleAttributes::kType));
+            const std::string &roadName = vehicle.at(EAttributes(EVehicleAttributes::kRoadName));
+            const Value &positionString = vehicle.at(EAttributes(EVehicleAttributes::kPosition));
+            const std::string &type = vehicle.at(EAttributes(EVehicleAttributes::kType));
 
             // check types before checking semantic validity
             bool incorrectType = false;
 
             // check that the types are valid
-            int position;
+            int position = 0;
             try {
-                position = Utils::stoi(positionString);
+                position = positionString.toInt();
                 if (position < 0) throw std::exception();
 
             } catch (const std::exception &e) {
@@ -560,10 +573,10 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             if (incorrectType) continue;
 
             // check that the road exists
-            if (std::find(validatedRoads.begin(), validatedRoads.end(), roadName) != validatedRoads.end()) {
+            if (validatedRoads.find(roadName) != validatedRoads.end()) {
                 // check that the spawn happens within road length
-                const Object road = findRoadWithName(roadName, config);
-                if (Utils::stoi(road.at(EAttributes(ERoadAttributes::kLength))) < position) {
+                const Object &road = *validatedRoads.at(roadName);
+                if (road.at(EAttributes(ERoadAttributes::kLength)).toInt() < position) {
                     errStream
                       << "[XmlValidator] Cannot create vehicle at a position that is outside the road (road length: "
                       << road.at(EAttributes(ERoadAttributes::kLength)) << "; position: " << positionString << ")."
@@ -580,27 +593,23 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
     }
 
     // ==== validate the vehicleGenerators ====
-    std::vector<Object> vehicleGenerators;
-    found = true;
-    try {
-        vehicleGenerators = config.at(EObjectTypes::kVehicleGenerator);
-    } catch (const std::exception &e) { found = false; }
-    if (found) {
-        for (const Object &vehicleGenerator : vehicleGenerators) {
+    const ValMap::const_iterator vehicleGenerators = config.find(EObjectTypes::kVehicleGenerator);
+    if (vehicleGenerators != config.end()) {
+        for (const Object &vehicleGenerator : vehicleGenerators->second) {
             /* Vehicles can only be spawned on an existing road and within the roads length. The types also need
              * validating */
-            const std::string roadName = vehicleGenerator.at(EAttributes(EVehicleGeneratorAttributes::kRoadName));
-            const std::string frequencyString =
+            const std::string &roadName = vehicleGenerator.at(EAttributes(EVehicleGeneratorAttributes::kRoadName));
+            const Value &frequencyString =
               vehicleGenerator.at(EAttributes(EVehicleGeneratorAttributes::kFrequency));
-            const std::string type = vehicleGenerator.at(EAttributes(EVehicleGeneratorAttributes::kType));
+            const std::string &type = vehicleGenerator.at(EAttributes(EVehicleGeneratorAttributes::kType));
 
             // check types before checking semantic validity
             bool incorrectType = false;
 
             // check that the types are valid
-            int frequency;
+            int frequency = 0;
             try {
-                frequency = Utils::stoi(frequencyString);
+                frequency = frequencyString.toInt();
                 if (frequency <= 0) throw std::exception();
 
             } catch (const std::exception &e) {
@@ -631,7 +640,7 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             if (incorrectType) continue;
 
             // check that the road exists
-            if (std::find(validatedRoads.begin(), validatedRoads.end(), roadName) == validatedRoads.end()) {
+            if (validatedRoads.find(roadName) == validatedRoads.end()) {
                 errStream << "[XmlValidator] Cannot create vehicleGenerator on road that does not exist or that is not "
                              "valid: on '"
                           << roadName << "'."
@@ -642,26 +651,22 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
     }
 
     // ==== validate the busstops ====
-    std::vector<Object> busstops;
-    found = true;
-    try {
-        busstops = config.at(EObjectTypes::kBusStop);
-    } catch (const std::exception &e) { found = false; }
-    if (found) {
-        for (const Object &busstop : busstops) {
+    const ValMap::const_iterator busstops = config.find(EObjectTypes::kBusStop);
+    if (busstops != config.end()) {
+        for (const Object &busstop : busstops->second) {
             /* Lights can only be spawned on an existing road and within the roads length. The types also need
              * validating */
-            const std::string roadName = busstop.at(EAttributes(EBusStopAttributes::kRoadName));
-            const std::string positionString = busstop.at(EAttributes(EBusStopAttributes::kPosition));
-            const std::string haltTimeString = busstop.at(EAttributes(EBusStopAttributes::kHaltTime));
+            const std::string &roadName = busstop.at(EAttributes(EBusStopAttributes::kRoadName));
+            const Value &positionString = busstop.at(EAttributes(EBusStopAttributes::kPosition));
+            const Value &haltTimeString = busstop.at(EAttributes(EBusStopAttributes::kHaltTime));
 
             // check types before checking semantic validity
             bool incorrectType = false;
 
             // check that the position type is valid
-            int position;
+            int position = 0;
             try {
-                position = Utils::stoi(positionString);
+                position = positionString.toInt();
                 if (position < 0) throw std::exception();
             } catch (const std::exception &e) {
                 errStream << "[XmlValidator] Cannot create busstop at a position that is not an integer or that is "
@@ -673,9 +678,9 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             }
 
             // check that the haltTime type is valid
-            int haltTime;
+            int haltTime = 0;
             try {
-                haltTime = Utils::stoi(haltTimeString);
+                haltTime = haltTimeString.toInt();
                 if (haltTime < 0) throw std::exception();
             } catch (const std::exception &e) {
                 errStream << "[XmlValidator] Cannot create busstop with a halt time that is not an integer or that is "
@@ -689,10 +694,10 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             if (incorrectType) continue;
 
             // check that the road exists
-            if (std::find(validatedRoads.begin(), validatedRoads.end(), roadName) != validatedRoads.end()) {
+            if (validatedRoads.find(roadName) != validatedRoads.end()) {
                 // check that the spawn happens within road length
-                const Object road = findRoadWithName(roadName, config);
-                if (Utils::stoi(road.at(EAttributes(ERoadAttributes::kLength))) < position) {
+                const Object &road = *validatedRoads.at(roadName);
+                if (road.at(EAttributes(ERoadAttributes::kLength)).toInt() < position) {
                     errStream
                       << "[XmlValidator] Cannot create busstop at a position that is outside the road (road length: "
                       << road.at(EAttributes(ERoadAttributes::kLength)) << "; position: " << positionString << ")."
@@ -709,28 +714,24 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
     }
 
     // ==== Validate the crossroads ====
-    std::vector<Object> crossRoads;
-    found = true;
-    try {
-        crossRoads = config.at(EObjectTypes::kCrossRoad);
-    } catch (const std::exception &e) { found = false; }
-    if (found) {
-        for (const Object &crossRoad : crossRoads) {
+    const ValMap::const_iterator crossRoads = config.find(EObjectTypes::kCrossRoad);
+    if (crossRoads != config.end()) {
+        for (const Object &crossRoad : crossRoads->second) {
             /* Lights can only be spawned on an existing road and within the roads length. The types also need
              * validating */
-            const std::string roadOne = crossRoad.at(EAttributes(ECrossRoadAttributes::kFirstRoad));
-            const std::string roadTwo = crossRoad.at(EAttributes(ECrossRoadAttributes::kSecondRoad));
-            const std::string posRoadOneString = crossRoad.at(EAttributes(ECrossRoadAttributes::kFirstRoadPosition));
-            const std::string posRoadTwoString = crossRoad.at(EAttributes(ECrossRoadAttributes::kSecondRoadPosition));
-            const std::string cycleTimeString = crossRoad.at(EAttributes(ECrossRoadAttributes::kLights));
+            const std::string &roadOne = crossRoad.at(EAttributes(ECrossRoadAttributes::kFirstRoad));
+            const std::string &roadTwo = crossRoad.at(EAttributes(ECrossRoadAttributes::kSecondRoad));
+            const Value &posRoadOneString = crossRoad.at(EAttributes(ECrossRoadAttributes::kFirstRoadPosition));
+            const Value &posRoadTwoString = crossRoad.at(EAttributes(ECrossRoadAttributes::kSecondRoadPosition));
+            const Value &cycleTimeString = crossRoad.at(EAttributes(ECrossRoadAttributes::kLights));
 
             // check types before checking semantic validity
             bool incorrectType = false;
 
             // check that the position type is valid
-            int firstRoadPosition;
+            int firstRoadPosition = 0;
             try {
-                firstRoadPosition = Utils::stoi(posRoadOneString);
+                firstRoadPosition = posRoadOneString.toInt();
                 if (firstRoadPosition < 0) throw std::exception();
             } catch (const std::exception &e) {
                 errStream << "[XmlValidator] Cannot create CrossRoad on road '" << roadOne
@@ -743,9 +744,9 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             }
 
             // check that the position type is valid
-            int secondRoadPosition;
+            int secondRoadPosition = 0;
             try {
-                secondRoadPosition = Utils::stoi(posRoadTwoString);
+                secondRoadPosition = posRoadTwoString.toInt();
                 if (secondRoadPosition < 0) throw std::exception();
             } catch (const std::exception &e) {
                 errStream << "[XmlValidator] Cannot create CrossRoad on road '" << roadTwo
@@ -762,10 +763,25 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             if (roadOne == roadTwo) {
                 errStream << "[XmlValidator] Cannot create CrossRoad with duplicate roads. (roadName: " << roadOne
                           << ")\n";
+                error = true;
                 continue;
             }
 
             if (cycleTimeString != "-1") {
+                // the lights stand one meter before the crossroad, so that meter has to be on the road
+                if (firstRoadPosition < 1) {
+                    errStream << "[XmlValidator] Cannot create light attached to crossroad before the start of the "
+                                 "road (roadName: "
+                              << roadOne << "; position: " << posRoadOneString << "; MinPosition: 1).\n";
+                    error = true;
+                }
+                if (secondRoadPosition < 1) {
+                    errStream << "[XmlValidator] Cannot create light attached to crossroad before the start of the "
+                                 "road (roadName: "
+                              << roadTwo << "; position: " << posRoadTwoString << "; MinPosition: 1).\n";
+                    error = true;
+                }
+
                 // check that the lights are at valid positions
                 //// road one
                 for (std::vector<double>::const_iterator it = lightPositions[roadOne].begin();
@@ -793,9 +809,9 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
                     }
                 }
 
-                int cycleTime;
+                int cycleTime = 0;
                 try {
-                    cycleTime = Utils::stoi(cycleTimeString);
+                    cycleTime = cycleTimeString.toInt();
                     if (cycleTime < 0) throw std::exception();
                 } catch (const std::exception &e) {
                     errStream << "[XmlValidator] Cannot create light on a crossroad with a cycle time that is not an "
@@ -808,10 +824,10 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             }
 
             // check that the road exists
-            if (std::find(validatedRoads.begin(), validatedRoads.end(), roadOne) != validatedRoads.end()) {
+            if (validatedRoads.find(roadOne) != validatedRoads.end()) {
                 // check that the spawn happens within road length
-                const Object road = findRoadWithName(roadOne, config);
-                if (Utils::stoi(road.at(EAttributes(ERoadAttributes::kLength))) < firstRoadPosition) {
+                const Object &road = *validatedRoads.at(roadOne);
+                if (road.at(EAttributes(ERoadAttributes::kLength)).toInt() < firstRoadPosition) {
                     errStream
                       << "[XmlValidator] Cannot create CrossRoad at a position that is outside the road (road length: "
                       << road.at(EAttributes(ERoadAttributes::kLength)) << "; roadName: " << roadOne
@@ -827,10 +843,10 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
             }
 
             // check that the road exists
-            if (std::find(validatedRoads.begin(), validatedRoads.end(), roadTwo) != validatedRoads.end()) {
+            if (validatedRoads.find(roadTwo) != validatedRoads.end()) {
                 // check that the spawn happens within road length
-                const Object road = findRoadWithName(roadTwo, config);
-                if (Utils::stoi(road.at(EAttributes(ERoadAttributes::kLength))) < secondRoadPosition) {
+                const Object &road = *validatedRoads.at(roadTwo);
+                if (road.at(EAttributes(ERoadAttributes::kLength)).toInt() < secondRoadPosition) {
                     errStream
                       << "[XmlValidator] Cannot create CrossRoad at a position that is outside the road (road length: "
                       << road.at(EAttributes(ERoadAttributes::kLength)) << "; roadName: " << roadTwo
@@ -856,11 +872,3 @@ Validator::ValMap Validator::validate(std::istream &istream, std::ostream &errSt
 
     return {};
 }
-
-Validator::Object Validator::findRoadWithName(const std::string &name, const ValMap &config) {
-    const std::vector<Object> roads = config.at(EObjectTypes::kRoad);
-    for (const Object &road : roads) {
-        if (road.at(EAttributes(ERoadAttributes::kName)) == name) return road;
-    }
-    return {};
-}
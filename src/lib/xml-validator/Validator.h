@@ -10,11 +10,15 @@
 #ifndef SE_PROJECT_VALIDATOR_H
 #define SE_PROJECT_VALIDATOR_H
 
+#include <ostream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include "../utils/Utils.h"
+
 // Note: This is a static class and thus does not need a properlyInitialized
 
 /// Static class to validate XML input stream.
@@ -22,7 +26,7 @@ class Validator {
   public:
     enum class EObjectTypes { kRoad, kLight, kVehicle, kVehicleGenerator, kBusStop, kCrossRoad };
 
-    enum class ERoadAttributes { kName, kLength };
+    enum class ERoadAttributes { kName, kLength, kLevel };
 
     enum class ELightAttributes { kRoadName, kPosition, kCycleTime };
 
@@ -38,8 +42,51 @@ class Validator {
                          EBusStopAttributes, ECrossRoadAttributes>
       EAttributes;
 
-    typedef std::unordered_map<EObjectTypes, std::vector<std::unordered_map<EAttributes, std::string>>> ValMap;
-    typedef std::unordered_map<EAttributes, std::string> Object;
+    /**
+     * Value of an attribute: the text read from the xml and, when the text is an integer, that integer. The number is
+     * parsed once when the value is read, the validator and the parser use it without converting the text again.
+     * Values compare by their text.
+     */
+    class Value {
+        std::string text;      // text as it appears in the xml
+        int number = 0;        // value of the text if it is an integer
+        bool integer = false;  // true if the full text is an integer
+
+      public:
+        Value() = default;
+
+        Value(std::string text) : text(std::move(text)) { integer = Utils::parseInt(this->text, number); }
+
+        Value(const char *text) : Value(std::string(text)) {}
+
+        /// @return the text as it appears in the xml
+        const std::string &str() const { return text; }
+
+        operator const std::string &() const { return text; }
+
+        /// @return true if the full text is an integer
+        bool isInt() const { return integer; }
+
+        /**
+         * @return the integer the text holds
+         * @throws std::runtime_error if the text is not an integer
+         */
+        int toInt() const {
+            if (!integer) {
+                throw std::runtime_error("[Validator::Value] '" + text + "' is not an integer.");
+            }
+            return number;
+        }
+
+        friend bool operator==(const Value &a, const Value &b) { return a.text == b.text; }
+
+        friend bool operator!=(const Value &a, const Value &b) { return a.text != b.text; }
+
+        friend std::ostream &operator<<(std::ostream &stream, const Value &value) { return stream << value.text; }
+    };
+
+    typedef std::unordered_map<EObjectTypes, std::vector<std::unordered_map<EAttributes, Value>>> ValMap;
+    typedef std::unordered_map<EAttributes, Value> Object;
 
     /**
      * Validates the xmlInput and if valid returns the valMap. If the xml was not valid then an empty valmap is
@@ -49,9 +96,6 @@ class Validator {
      * @return ValMap that contains the correct values for the simulation parser if valid, else it is empty.
      */
     static ValMap validate(std::istream &istream, std::ostream &errStream);
-
-  private:
-    static Object findRoadWithName(const std::string &name, const ValMap &config);
 };
 
 /// allowed attributes for all the objects
@@ -65,9 +109,13 @@ const std::unordered_map<Validator::EObjectTypes, std::vector<std::string>> requ
 };
 
 const std::unordered_map<Validator::EObjectTypes, std::vector<std::string>> optionalAttributes = {
+  {Validator::EObjectTypes::kRoad, {"niveau"}},
   {Validator::EObjectTypes::kCrossRoad, {"lichten"}},
 };
 
+/// allowed levels of detail for the roads (micro when not set)
+const std::vector<std::string> roadLevels = {"micro", "meso"};
+
 /// allowed vehicle types for the input files
 const std::vector<std::string> vehicleTypes = {"auto", "bus", "brandweerwagen", "ziekenwagen", "politiecombi"};
 
@@ -9,12 +9,17 @@
 
 #include "Object.h"
 
-Object::Object(unsigned int id) : _id(id), _initCheck(this) {
+Object::Object(unsigned int id) : _id(id) {
+#ifndef NDEBUG
+    _initCheck = this;
+#endif
     ENSURE(properlyInitialized(), "Object is properly initialized");
 }
 
 Object::Object(const Object &other): _id(other._id) {
+#ifndef NDEBUG
     _initCheck = other._initCheck;
+#endif
 }
 
 // getters and setters
@@ -23,4 +28,6 @@ const unsigned int &Object::getId() const {
     return _id;
 }
 
+#ifndef NDEBUG
 bool Object::properlyInitialized() const { return _initCheck; }
+#endif
@@ -16,7 +16,9 @@
 /// Abstract class to represent all objects inside the simulation
 class Object {
     const id _id;
-    const Object *_initCheck;
+#ifndef NDEBUG
+    const Object *_initCheck;  // only needed by the contracts, release builds (NDEBUG) leave it out
+#endif
 
   public:
     /**
@@ -40,7 +42,11 @@ class Object {
      */
     const unsigned int &getId() const;
 
+#ifdef NDEBUG
+    bool properlyInitialized() const { return true; }
+#else
     bool properlyInitialized() const;
+#endif
 };
 
 #endif  // SE_PROJECT_OBJECT_H
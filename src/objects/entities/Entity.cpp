@@ -9,7 +9,6 @@
 
 #include "Entity.h"
 
-Entity::Entity(unsigned int id, double stepSize) : Object(id), stepSize(stepSize) {
-    REQUIRE(stepSize > 0, "stepSize is larger than zero");
+Entity::Entity(unsigned int id) : Object(id) {
     ENSURE(properlyInitialized(), "Object is properly initialized");
 }
@@ -16,18 +16,14 @@
 
 /// Abstract super class to represent all objects that can be ticked (entities)
 class Entity : public Object {
-  protected:
-    const double stepSize;
-
   public:
     /**
-     * Abstract super class to represent all objects that can be ticked (entities) \n
-     * REQUIRE(stepSize > 0, "stepSize is larger than zero");\n
+     * Abstract super class to represent all objects that can be ticked (entities). The stepSize is not stored per
+     * entity, entities that keep time themselves get it in their constructor. \n
      * ENSURE(properlyInitialized(), "Object is properly initialized");
      * @param id id to be given to the object
-     * @param stepSize in-simulation timesteps between two frames
      */
-    Entity(unsigned int id, double stepSize);
+    explicit Entity(unsigned int id);
 };
 
 #endif  // SE_PROJECT_ENTITY_H
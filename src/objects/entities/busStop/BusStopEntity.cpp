@@ -9,9 +9,7 @@
 
 #include "BusStopEntity.h"
 
-BusStopEntity::BusStopEntity(unsigned int id, unsigned int haltTime, double stepSize) :
-    Entity(id, stepSize), _haltTime(haltTime) {
-    REQUIRE(stepSize > 0, "stepSize must be greater than zero");
+BusStopEntity::BusStopEntity(unsigned int id, unsigned int haltTime) : Entity(id), _haltTime(haltTime) {
     ENSURE(properlyInitialized(), "Object is properly initialized");
 }
 
@@ -21,13 +21,11 @@ class BusStopEntity : protected Entity {
   public:
     /**
      * represents a busstop \n
-     * REQUIRE(stepSize > 0, "stepSize must be greater than zero"); \n
      * ENSURE(properlyInitialized(), "Object is properly initialized");
      * @param id id to be given to the object
      * @param halfTime amount of wait time for busses
-     * @param stepSize in-simulation timesteps between two frames
      */
-    BusStopEntity(unsigned int id, unsigned int haltTime, double stepSize);
+    BusStopEntity(unsigned int id, unsigned int haltTime);
 
     void update();
 
@@ -9,12 +9,14 @@
 
 #include "LightEntity.h"
 
-LightEntity::LightEntity(unsigned int id, unsigned int cycle, double stepSize) : Entity(id, stepSize), _cycle(cycle) {
+LightEntity::LightEntity(unsigned int id, unsigned int cycle, double stepSize) :
+    Entity(id), _cycle(cycle), _stepSize(stepSize) {
     REQUIRE(stepSize > 0, "stepSize must be greater than zero");
     ENSURE(properlyInitialized(), "Object is properly initialized");
 }
 
-LightEntity::LightEntity(unsigned int id, unsigned int cycle, double stepSize, bool isGreen) : Entity(id, stepSize), _cycle(cycle), _isGreen(isGreen) {
+LightEntity::LightEntity(unsigned int id, unsigned int cycle, double stepSize, bool isGreen) :
+    Entity(id), _cycle(cycle), _stepSize(stepSize), _isGreen(isGreen) {
     REQUIRE(stepSize > 0, "stepSize must be greater than zero");
     ENSURE(properlyInitialized(), "Object is properly initialized");
 }
@@ -37,7 +39,7 @@ void LightEntity::update() {
         _timeLastChange = 0;
 
     } else
-        _timeLastChange += stepSize;
+        _timeLastChange += _stepSize;
 }
 
 const bool &LightEntity::isGreen() const {
@@ -17,6 +17,7 @@
 /// Represents a traffic light
 class LightEntity : protected Entity {
     const unsigned int _cycle = 0;
+    const double _stepSize;
     double _timeLastChange = 0;
     bool _isGreen = false;
 
@@ -0,0 +1,142 @@
+//============================================================================
+// Name        : MesoLinkEntity.cpp
+// Description : MesoLinkEntity class implementation
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/26
+// Version     : 1.0
+//============================================================================
+
+#include "MesoLinkEntity.h"
+
+#include <algorithm>
+
+/// orders the heap so the vehicle that arrives first is on top
+static bool arrivesLater(const MesoLinkEntity::Vehicle &a, const MesoLinkEntity::Vehicle &b) {
+    return a.arrival > b.arrival;
+}
+
+const MesoLinkProfile &MesoLinkProfile::get() {
+    // read once, the first mesoscopic road of a simulation pays for it
+    static const MesoLinkProfile profile = []() {
+        const mINI::INIFile file(path::resFolderPath + "config/constants.ini");
+        mINI::INIStructure ini;
+        file.read(ini);
+        return MesoLinkProfile{Utils::stod(ini["mesoLink"]["capacity"]), Utils::stod(ini["mesoLink"]["jamSpacing"])};
+    }();
+
+    return profile;
+}
+
+MesoLinkEntity::MesoLinkEntity(id roadId, double stepSize, double length, const MesoLinkProfile &profile) :
+    Entity(roadId), stepSize(stepSize), length(length), capacity(profile.capacity) {
+    REQUIRE(stepSize > 0, "stepSize is larger than zero");
+    REQUIRE(length > 0, "length is larger than zero");
+
+    storage = std::max(1u, (unsigned int) (length / profile.jamSpacing));
+
+    ENSURE(properlyInitialized(), "Object is properly initialized");
+    ENSURE(getCapacity() > 0, "capacity is larger than zero");
+}
+
+void MesoLinkEntity::addCrossRoad(double position, id crossRoadId) {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    REQUIRE(getVehicleCount() == 0, "link is empty");
+    REQUIRE(position >= 0 && position <= length, "crossroad is on the road");
+
+    crossRoads.insert(std::upper_bound(crossRoads.begin(), crossRoads.end(), std::make_pair(position, crossRoadId)),
+                      {position, crossRoadId});
+}
+
+void MesoLinkEntity::update() {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+
+    // a coarse step lets more than one vehicle through per tick
+    const double perTick = capacity * stepSize;
+    const double limit = std::max(1.0, perTick);
+    entryBudget = std::min(limit, entryBudget + perTick);
+    exitBudget = std::min(limit, exitBudget + perTick);
+}
+
+bool MesoLinkEntity::canEnter() const {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    return queue.size() < storage && entryBudget >= 1;
+}
+
+void MesoLinkEntity::enter(EVehicleEntityTypes type, double position, double now) {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    REQUIRE(position >= 0 && position <= length, "position is on the road");
+    const unsigned int oldCount = getVehicleCount();
+
+    entryBudget -= 1;
+    place(type, position, now);
+
+    ENSURE(getVehicleCount() == oldCount + 1, "vehicle is on the link");
+}
+
+bool MesoLinkEntity::hasDeparture(double now) const {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    return !queue.empty() && queue.front().arrival <= now && exitBudget >= 1;
+}
+
+MesoLinkEntity::Vehicle MesoLinkEntity::depart(double now) {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    REQUIRE(hasDeparture(now), "a vehicle can leave");
+
+    std::pop_heap(queue.begin(), queue.end(), arrivesLater);
+    const Vehicle vehicle = queue.back();
+    queue.pop_back();
+    exitBudget -= 1;
+    return vehicle;
+}
+
+void MesoLinkEntity::pass(const Vehicle &vehicle, double now) {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    REQUIRE(vehicle.crossRoad != getId(), "vehicle did not reach the end of the road");
+
+    // the vehicle stays on the link, only vehicles leaving it count for the exit capacity
+    exitBudget += 1;
+    place(vehicle.type, vehicle.position, now);
+}
+
+void MesoLinkEntity::place(EVehicleEntityTypes type, double position, double now) {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    REQUIRE(position >= 0 && position <= length, "position is on the road");
+    const unsigned int oldCount = getVehicleCount();
+
+    // first crossroad strictly after the position, a vehicle entering at a crossroad does not decide there again
+    const std::vector<std::pair<double, id>>::const_iterator next =
+      std::upper_bound(crossRoads.begin(), crossRoads.end(), position,
+                       [](double value, const std::pair<double, id> &crossRoad) { return value < crossRoad.first; });
+
+    Vehicle vehicle{};
+    vehicle.type = type;
+    if (next != crossRoads.end()) {
+        vehicle.position = next->first;
+        vehicle.crossRoad = next->second;
+    } else {
+        vehicle.position = length;
+        vehicle.crossRoad = getId();
+    }
+    vehicle.arrival = now + (vehicle.position - position) / VehicleProfile::of(type).maxVelocity;
+
+    queue.push_back(vehicle);
+    std::push_heap(queue.begin(), queue.end(), arrivesLater);
+
+    ENSURE(getVehicleCount() == oldCount + 1, "vehicle is on the link");
+}
+
+unsigned int MesoLinkEntity::getVehicleCount() const {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    return queue.size();
+}
+
+double MesoLinkEntity::getCapacity() const {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    return capacity;
+}
+
+unsigned int MesoLinkEntity::getStorage() const {
+    REQUIRE(properlyInitialized(), "Object is properly initialized");
+    return storage;
+}
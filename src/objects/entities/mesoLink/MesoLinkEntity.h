@@ -0,0 +1,164 @@
+//============================================================================
+// Name        : MesoLinkEntity.h
+// Description : MesoLinkEntity class, point queue model of a mesoscopic road
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/26
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_MESOLINKENTITY_H
+#define SE_PROJECT_MESOLINKENTITY_H
+
+#include <utility>
+#include <vector>
+
+#include "../Entity.h"
+#include "../vehicle/VehicleEntity.h"
+
+/// Constants shared by all mesoscopic roads
+struct MesoLinkProfile {
+    double capacity;    // vehicles per second that can leave a link
+    double jamSpacing;  // meters of road a vehicle takes in a jam
+
+    /**
+     * Returns the profile of the mesoscopic roads, it is read from the constants file on first use
+     * @return the profile
+     */
+    static const MesoLinkProfile &get();
+};
+
+/**
+ * @brief Point queue model of a mesoscopic road. \n
+ * A vehicle on the link is only a type and the time at which it reaches its next point of interest (the next crossroad
+ * or the end of the road) when driving at its maximal velocity. Vehicles that arrived leave that point in order of
+ * arrival. At most capacity vehicles per second leave the link (by turning or at the end of the road), the others wait
+ * in the queue. The link holds at most storage vehicles (the road length divided by the jam spacing), a full link does
+ * not let vehicles in. Nothing is done for a vehicle between entering the link and reaching its next point of interest.
+ */
+class MesoLinkEntity : public Entity {
+  public:
+    /// vehicle on a mesoscopic road
+    struct Vehicle {
+        double arrival;            // simulation time at which the vehicle reaches position
+        double position;           // position of the next crossroad, or the length of the road
+        id crossRoad;              // crossroad at position, the id of the link when it is the end of the road
+        EVehicleEntityTypes type;  // type of the vehicle, used when it is materialized on a microscopic road
+    };
+
+  private:
+    const double stepSize;      // in-simulation time between two ticks
+    const double length;        // length of the road
+    double capacity;            // vehicles per second that can leave the link
+    unsigned int storage;       // vehicles the link holds when it is jammed
+    double entryBudget = 1;     // vehicles that can still enter during this tick
+    double exitBudget = 1;      // vehicles that can still leave during this tick
+    std::vector<Vehicle> queue;  // heap of the vehicles on the link, the earliest arrival on top
+
+    std::vector<std::pair<double, id>> crossRoads;  // positions and ids of the crossroads on the road, sorted
+
+  public:
+    /**
+     * Represents a mesoscopic road with the capacity and jam spacing of a profile \n
+     * REQUIRE(stepSize > 0, "stepSize is larger than zero"); \n
+     * REQUIRE(length > 0, "length is larger than zero"); \n
+     * ENSURE(properlyInitialized(), "Object is properly initialized"); \n
+     * ENSURE(getCapacity() > 0, "capacity is larger than zero");
+     * @param roadId id of the road the link models
+     * @param stepSize in-simulation timesteps between two frames
+     * @param length length of the road
+     * @param profile capacity and jam spacing of the link, usually MesoLinkProfile::get()
+     */
+    MesoLinkEntity(id roadId, double stepSize, double length, const MesoLinkProfile &profile);
+
+    /**
+     * Adds a crossroad on the road, vehicles passing it stop there to decide their direction \n
+     * REQUIRE(properlyInitialized(), "Object is properly initialized"); \n
+     * REQUIRE(getVehicleCount() == 0, "link is empty"); \n
+     * REQUIRE(position >= 0 && position <= length, "crossroad is on the road");
+     * @param position position of the crossroad
+     * @param crossRoadId id of the crossroad
+     */
+    void addCrossRoad(double position, id crossRoadId);
+
+    /**
+     * Restores the entry and exit capacity for the next tick, unused capacity is not saved up \n
+     * REQUIRE(properlyInitialized(), "Object is properly initialized");
+     */
+    void update();
+
+    /**
+     * REQUIRE(properlyInitialized(), "Object is properly initialized");
+     * @return true if the link has room for a vehicle and its entry capacity for this tick is not used up
+     */
+    bool canEnter() const;
+
+    /**
+     * Lets a vehicle drive onto the link, it reaches the first crossroad after the given position (or the end of the
+     * road) after driving there at its maximal velocity \n
+     * REQUIRE(properlyInitialized(), "Object is properly initialized"); \n
+     * REQUIRE(position >= 0 && position <= length, "position is on the road"); \n
+     * ENSURE(getVehicleCount() == old count + 1, "vehicle is on the link");
+     * @param type type of the vehicle
+     * @param position position at which the vehicle enters
+     * @param now current simulation time
+     */
+    void enter(EVehicleEntityTypes type, double position, double now);
+
+    /**
+     * Puts a vehicle of the scenario on the link, without using the entry capacity or checking the storage \n
+     * REQUIRE(properlyInitialized(), "Object is properly initialized"); \n
+     * REQUIRE(position >= 0 && position <= length, "position is on the road"); \n
+     * ENSURE(getVehicleCount() == old count + 1, "vehicle is on the link");
+     * @param type type of the vehicle
+     * @param position position of the vehicle
+     * @param now current simulation time
+     */
+    void place(EVehicleEntityTypes type, double position, double now);
+
+    /**
+     * REQUIRE(properlyInitialized(), "Object is properly initialized");
+     * @param now current simulation time
+     * @return true if a vehicle reached its position and the exit capacity for this tick is not used up
+     */
+    bool hasDeparture(double now) const;
+
+    /**
+     * Takes the vehicle that arrived first from the link \n
+     * REQUIRE(properlyInitialized(), "Object is properly initialized"); \n
+     * REQUIRE(hasDeparture(now), "a vehicle can leave");
+     * @param now current simulation time
+     * @return the vehicle
+     */
+    Vehicle depart(double now);
+
+    /**
+     * Lets a departed vehicle drive on from its crossroad to the next point of interest. It does not leave the link,
+     * so it uses neither the entry nor the exit capacity. \n
+     * REQUIRE(properlyInitialized(), "Object is properly initialized"); \n
+     * REQUIRE(vehicle.crossRoad != getId(), "vehicle did not reach the end of the road");
+     * @param vehicle vehicle returned by depart()
+     * @param now current simulation time
+     */
+    void pass(const Vehicle &vehicle, double now);
+
+    /**
+     * REQUIRE(properlyInitialized(), "Object is properly initialized");
+     * @return amount of vehicles on the link
+     */
+    unsigned int getVehicleCount() const;
+
+    /**
+     * REQUIRE(properlyInitialized(), "Object is properly initialized");
+     * @return vehicles that can leave the link per second
+     */
+    double getCapacity() const;
+
+    /**
+     * REQUIRE(properlyInitialized(), "Object is properly initialized");
+     * @return vehicles the link holds when it is jammed
+     */
+    unsigned int getStorage() const;
+};
+
+#endif  // SE_PROJECT_MESOLINKENTITY_H
@@ -9,32 +9,67 @@
 
 #include "VehicleEntity.h"
 
-VehicleEntity::VehicleEntity(unsigned int id, double stepSize, EVehicleEntityTypes type) :
-    Entity(id, stepSize), type(type) {
+#include <array>
+
+const VehicleProfile &VehicleProfile::of(EVehicleEntityTypes type) {
+    // read once, the first vehicle of a simulation pays for it
+    static const std::array<VehicleProfile, 5> profiles = []() {
+        const mINI::INIFile file(path::resFolderPath + "config/constants.ini");
+        mINI::INIStructure ini;
+        file.read(ini);
+
+        std::array<VehicleProfile, 5> result{};
+        for (const std::pair<const EVehicleEntityTypes, std::string> &section :
+             vehicleEntityEnumToIniFileSubsectionNameConverter) {
+            VehicleProfile &profile = result.at(section.first);
+            profile.length = Utils::stod(ini[section.second]["length"]);
+            profile.maxVelocity = Utils::stod(ini[section.second]["vMax"]);
+            profile.maxAcceleration = Utils::stod(ini[section.second]["aMax"]);
+            profile.maxBrakeForce = Utils::stod(ini[section.second]["bMax"]);
+            profile.minimalFollow = Utils::stod(ini[section.second]["fMin"]);
+        }
+        return result;
+    }();
+
+    return profiles[type];
+}
+
+VehicleEntity::VehicleEntity(unsigned int id, EVehicleEntityTypes type) : Entity(id), type(type) {
     targetVelocity = 20.0;
 
-    const mINI::INIFile file(path::resFolderPath + "config/constants.ini");
-    mINI::INIStructure ini;
-    file.read(ini);
-
-    length = Utils::stod(ini[vehicleEntityEnumToIniFileSubsectionNameConverter[type]]["length"]);
-    maxVelocity = Utils::stod(ini[vehicleEntityEnumToIniFileSubsectionNameConverter[type]]["vMax"]);
-    maxAcceleration = Utils::stod(ini[vehicleEntityEnumToIniFileSubsectionNameConverter[type]]["aMax"]);
-    maxBrakeForce = Utils::stod(ini[vehicleEntityEnumToIniFileSubsectionNameConverter[type]]["bMax"]);
-    minimalFollow = Utils::stod(ini[vehicleEntityEnumToIniFileSubsectionNameConverter[type]]["fMin"]);
-
-    ENSURE(stepSize > 0, "stepSize is larger than zero");
-    ENSURE(length > 0, "length is greater than zero");
-    ENSURE(maxVelocity > 0, "maxVelocity is greater than zero");
-    ENSURE(maxAcceleration > 0, "maxAcceleration is greater than zero");
-    ENSURE(maxBrakeForce > 0, "maxBreakforce is greater than zero");
-    ENSURE(minimalFollow > 0, "minimalFollow is greater than zero");
+    ENSURE(getLength() > 0, "length is greater than zero");
+    ENSURE(getMaxVelocity() > 0, "maxVelocity is greater than zero");
+    ENSURE(getMaxAcceleration() > 0, "maxAcceleration is greater than zero");
+    ENSURE(getMaxBrakeForce() > 0, "maxBreakforce is greater than zero");
+    ENSURE(getMinimalFollow() > 0, "minimalFollow is greater than zero");
     ENSURE(properlyInitialized(), "Object is properly initialized");
 }
 
 double VehicleEntity::update(double distToCar, double velNextCar, double distToLight, double distToBusStop,
-                             int busHaltTime, unsigned int busStopId, const bool priorityVehicleInFront) {
+                             int busHaltTime, unsigned int busStopId, const bool priorityVehicleInFront,
+                             const double stepSize, const double tickFraction) {
+    REQUIRE(properlyInitialized(), "object is properly initialized");
+
+    switch (vehicleClassOf(type)) {
+        case EVehicleClass::kBus:
+            return update<BusPolicy>(distToCar, velNextCar, distToLight, distToBusStop, busHaltTime, busStopId,
+                                     priorityVehicleInFront, stepSize, tickFraction);
+        case EVehicleClass::kPriority:
+            return update<PriorityVehiclePolicy>(distToCar, velNextCar, distToLight, distToBusStop, busHaltTime,
+                                                 busStopId, priorityVehicleInFront, stepSize, tickFraction);
+        case EVehicleClass::kRegular:
+        default:
+            return update<RegularVehiclePolicy>(distToCar, velNextCar, distToLight, distToBusStop, busHaltTime,
+                                                busStopId, priorityVehicleInFront, stepSize, tickFraction);
+    }
+}
+
+template <typename Policy>
+double VehicleEntity::update(double distToCar, double velNextCar, double distToLight, double distToBusStop,
+                             int busHaltTime, unsigned int busStopId, const bool priorityVehicleInFront,
+                             const double stepSize, const double tickFraction) {
     REQUIRE(properlyInitialized(), "object is properly initialized");
+    REQUIRE(vehicleClassOf(type) == Policy::kClass, "vehicle belongs to the class of the policy");
     REQUIRE((distToLight > 0 && distToLight != std::numeric_limits<double>::infinity()) ||
               distToLight == std::numeric_limits<double>::infinity(),
             "distToLight is positive or light is not found");
@@ -46,41 +81,51 @@ double VehicleEntity::update(double distToCar, double velNextCar, double distToL
              busHaltTime == std::numeric_limits<int>::infinity()) ||
               (type == EVehicleEntityTypes::kBus),
             "Type is not a bus and busattributes are not set");
+    REQUIRE(stepSize > 0, "stepSize is larger than zero");
+    REQUIRE(tickFraction > 0 && tickFraction <= 1, "update covers at most one tick");
+
+    const VehicleProfile &profile = VehicleProfile::of(type);
+    const double timeStep = stepSize * tickFraction;
+
+    // state before the update, to detect a fixed point
+    const double oldVelocity = velocity;
+    const double oldAcceleration = acceleration;
+    const double oldTargetVelocity = targetVelocity;
+    const int oldBusStop = busStop;
+    steady = false;
+    settled = false;
 
     if (priorityVehicleInFront) {
         distToCar = std::numeric_limits<double>::infinity();
         velNextCar = std::numeric_limits<double>::infinity();
     }
 
-    if (type == EVehicleEntityTypes::kPoliceCruiser || type == EVehicleEntityTypes::kAmbulance || type == EVehicleEntityTypes::kFireTruck) {
-        distToLight = std::numeric_limits<double>::infinity();
-    }
+    if constexpr (Policy::kIgnoresLights) distToLight = std::numeric_limits<double>::infinity();
 
     // halt at current stop for haltTime
-    if (ticksStopped != -1 && ticksStopped * stepSize < busHaltTime) {
-        // std::cout << "timeStopped: " << ticksStopped * stepSize << '\n';
-        ++ticksStopped;
-        return 0;
+    if constexpr (Policy::kUsesBusStops) {
+        if (ticksStopped != -1 && ticksStopped * stepSize < busHaltTime) {
+            ticksStopped += tickFraction;
+            return 0;
+        }
     }
 
     // determine closest obstacle
-    double distToObstacle;
+    double distToObstacle = std::min(distToCar, distToLight);
     // if we passed the time of the current stop, then other obstacles are of interest
-    if (busStop == (int) busStopId) {
-        distToObstacle = std::min(distToCar, distToLight);
-    } else {
-        distToObstacle = std::min({distToCar, distToLight, distToBusStop});
+    if constexpr (Policy::kUsesBusStops) {
+        if (busStop != (int) busStopId) distToObstacle = std::min(distToObstacle, distToBusStop);
     }
 
     double result;
 
     // calculate velocity
-    if (velocity + acceleration * stepSize < 0) {
+    if (velocity + acceleration * timeStep < 0) {
         result = -std::pow(velocity, 2) / (2 * acceleration);
         velocity = 0;
     } else {
-        velocity += acceleration * stepSize;
-        result = velocity * stepSize + acceleration * (std::pow(stepSize, 2) / 2);
+        velocity += acceleration * timeStep;
+        result = velocity * timeStep + acceleration * (std::pow(timeStep, 2) / 2);
     }
 
     // calculate velocity difference
@@ -89,39 +134,45 @@ double VehicleEntity::update(double distToCar, double velNextCar, double distToL
     // calculate δ
     double delta = 0;
     if (distToObstacle == distToCar) {
-        delta = (minimalFollow +
-                 std::max(0.0, velocity + (velocity * velDiff) / 2 * std::sqrt(maxAcceleration * maxBrakeForce))) /
-                distToCar;
+        const double brakeTerm = std::sqrt(profile.maxAcceleration * profile.maxBrakeForce);
+        delta = (profile.minimalFollow + std::max(0.0, velocity + (velocity * velDiff) / 2 * brakeTerm)) / distToCar;
     }
 
     // calculate acceleration
-    acceleration = maxAcceleration * (1 - std::pow(velocity / targetVelocity, 4) - std::pow(delta, 2));
+    acceleration = profile.maxAcceleration * (1 - std::pow(velocity / targetVelocity, 4) - std::pow(delta, 2));
 
     // check for obstacles
-    if ((distToObstacle == distToLight || distToObstacle == distToBusStop) && distToObstacle <= 50) {
+    if ((distToObstacle == distToLight || distToObstacle == distToBusStop) && distToObstacle <= kObstacleReach) {
         if (distToObstacle <= 15.0) {
             // stop the vehicle
-            acceleration = -maxBrakeForce * velocity / targetVelocity;
+            acceleration = -profile.maxBrakeForce * velocity / targetVelocity;
         } else if (distToObstacle >= 15.0) {
             // slow down the vehicle
-            targetVelocity = 0.4 * maxVelocity;
+            targetVelocity = 0.4 * profile.maxVelocity;
         }
     } else {
-        targetVelocity = maxVelocity;
+        targetVelocity = profile.maxVelocity;
     }
 
-    // check if bus is stopped for busstop that it hasn't done yet
-    if (distToObstacle == distToBusStop && distToBusStop < 15 && velocity < 0.1 && busStop == -1) {
-        ticksStopped = 0;
-        busStop = busStopId;
-    }
+    if constexpr (Policy::kUsesBusStops) {
+        // check if bus is stopped for busstop that it hasn't done yet
+        if (distToObstacle == distToBusStop && distToBusStop < 15 && velocity < 0.1 && busStop == -1) {
+            ticksStopped = 0;
+            busStop = busStopId;
+        }
 
-    // if we drive ahead of the current busstop
-    if (busStop != -1 && (int) busStopId != busStop) {
-        ticksStopped = -1;
-        busStop = -1;
+        // if we drive ahead of the current busstop
+        if (busStop != -1 && (int) busStopId != busStop) {
+            ticksStopped = -1;
+            busStop = -1;
+        }
     }
 
+    // halting busses are never steady, their ticksStopped changes every tick
+    steady = velocity == oldVelocity && acceleration == oldAcceleration && targetVelocity == oldTargetVelocity &&
+             busStop == oldBusStop && ticksStopped == -1;
+    settled = steady && result == 0;
+
     ENSURE(velocity >= 0, "velocity is greater or equal to zero");
     ENSURE(result != INFINITY, "result is not infinity (division by zero)");
 
@@ -129,31 +180,38 @@ double VehicleEntity::update(double distToCar, double velNextCar, double distToL
     return result;
 }
 
+template double VehicleEntity::update<RegularVehiclePolicy>(double, double, double, double, int, unsigned int,
+                                                            const bool, const double, const double);
+template double VehicleEntity::update<BusPolicy>(double, double, double, double, int, unsigned int, const bool,
+                                                 const double, const double);
+template double VehicleEntity::update<PriorityVehiclePolicy>(double, double, double, double, int, unsigned int,
+                                                             const bool, const double, const double);
+
 // getters and setters
 // ==== Max constants ====
 const double &VehicleEntity::getLength() const {
     REQUIRE(properlyInitialized(), "object is properly initialized");
-    return length;
+    return VehicleProfile::of(type).length;
 }
 
 const double &VehicleEntity::getMaxVelocity() const {
     REQUIRE(properlyInitialized(), "object is properly initialized");
-    return maxVelocity;
+    return VehicleProfile::of(type).maxVelocity;
 }
 
 const double &VehicleEntity::getMaxBrakeForce() const {
     REQUIRE(properlyInitialized(), "object is properly initialized");
-    return maxBrakeForce;
+    return VehicleProfile::of(type).maxBrakeForce;
 }
 
 const double &VehicleEntity::getMinimalFollow() const {
     REQUIRE(properlyInitialized(), "object is properly initialized");
-    return minimalFollow;
+    return VehicleProfile::of(type).minimalFollow;
 }
 
 const double &VehicleEntity::getMaxAcceleration() const {
     REQUIRE(properlyInitialized(), "object is properly initialized");
-    return maxAcceleration;
+    return VehicleProfile::of(type).maxAcceleration;
 }
 
 // ==== World parameters ====
@@ -162,6 +220,11 @@ EVehicleEntityTypes VehicleEntity::getType() const {
     return type;
 }
 
+EVehicleClass VehicleEntity::getClass() const {
+    REQUIRE(properlyInitialized(), "object is properly initialized");
+    return vehicleClassOf(type);
+}
+
 const double &VehicleEntity::getVelocity() const {
     REQUIRE(properlyInitialized(), "object is properly initialized");
     return velocity;
@@ -171,6 +234,8 @@ void VehicleEntity::setVelocity(const double &velocity_) {
     REQUIRE(velocity_ >= 0, "velocity is greater than zero");
     REQUIRE(properlyInitialized(), "object is properly initialized");
     VehicleEntity::velocity = velocity_;
+    steady = false;
+    settled = false;
     ENSURE(velocity >= 0, "velocity is greater than zero");
 }
 
@@ -182,6 +247,8 @@ const double &VehicleEntity::getTargetVelocity() const {
 void VehicleEntity::setTargetVelocity(const double &targetVelocity_) {
     REQUIRE(properlyInitialized(), "object is properly initialized");
     VehicleEntity::targetVelocity = targetVelocity_;
+    steady = false;
+    settled = false;
 }
 
 const double &VehicleEntity::getAcceleration() const {
@@ -192,40 +259,16 @@ const double &VehicleEntity::getAcceleration() const {
 void VehicleEntity::setAcceleration(const double &acceleration_) {
     REQUIRE(properlyInitialized(), "object is properly initialized");
     VehicleEntity::acceleration = acceleration_;
+    steady = false;
+    settled = false;
 }
 
-const double &VehicleEntity::getBrakeDistance() const {
-    REQUIRE(properlyInitialized(), "object is properly initialized");
-    return brakeDistance;
-}
-
-void VehicleEntity::setBrakeDistance(const double &brakeDistance_) {
-    REQUIRE(brakeDistance_ > 0, "brakeDistance is greater than zero");
-    REQUIRE(properlyInitialized(), "object is properly initialized");
-    VehicleEntity::brakeDistance = brakeDistance_;
-    ENSURE(brakeDistance > 0, "brakeDistnce is greater than zero");
-}
-
-const double &VehicleEntity::getStopDistance() const {
-    REQUIRE(properlyInitialized(), "object is properly initialized");
-    return stopDistance;
-}
-
-void VehicleEntity::setStopDistance(const double &stopDistance_) {
-    REQUIRE(stopDistance_ >= 0, "stopdistance is greater than zero");
-    REQUIRE(properlyInitialized(), "object is properly initialized");
-    VehicleEntity::stopDistance = stopDistance_;
-    ENSURE(stopDistance >= 0, "stopDistance is greater than zero");
-}
-
-const double &VehicleEntity::getBrakeForce() const {
+bool VehicleEntity::isSettled() const {
     REQUIRE(properlyInitialized(), "object is properly initialized");
-    return brakeForce;
+    return settled;
 }
 
-void VehicleEntity::setBrakeForce(const double &brakeForce_) {
-    REQUIRE(brakeForce_ >= 0, "brakeForce is greater than zero");
+bool VehicleEntity::isSteady() const {
     REQUIRE(properlyInitialized(), "object is properly initialized");
-    VehicleEntity::brakeForce = brakeForce_;
-    ENSURE(brakeForce >= 0, "brakeForce is greater than zero");
+    return steady;
 }
@@ -30,53 +30,91 @@ static std::unordered_map<EVehicleEntityTypes, std::string> vehicleEntityEnumToI
   {kAmbulance, "vehicleEntityAmbulance"},
   {kPoliceCruiser, "vehicleEntityPoliceCruiser"}};
 
-/// Represents a vehicle
+/// Groups of vehicle types that follow different traffic rules
+enum class EVehicleClass { kRegular, kBus, kPriority };
+
+/// amount of vehicle classes
+constexpr unsigned int kVehicleClassCount = 3;
+
+/// converts the type of the vehicle to its class
+constexpr EVehicleClass vehicleClassOf(EVehicleEntityTypes type) {
+    return type == kBus ? EVehicleClass::kBus : type == kCar ? EVehicleClass::kRegular : EVehicleClass::kPriority;
+}
+
+/// Traffic rules of cars, every policy has the same members
+struct RegularVehiclePolicy {
+    /// class of the vehicles that follow these rules
+    static constexpr EVehicleClass kClass = EVehicleClass::kRegular;
+    /// true if the vehicles drive through red lights, false if they stop for them
+    static constexpr bool kIgnoresLights = false;
+    /// true if the vehicles halt at the bus stops on their road, false if they drive past them
+    static constexpr bool kUsesBusStops = false;
+};
+
+/// Traffic rules of busses, the members are the ones of RegularVehiclePolicy
+struct BusPolicy {
+    static constexpr EVehicleClass kClass = EVehicleClass::kBus;
+    static constexpr bool kIgnoresLights = false;
+    static constexpr bool kUsesBusStops = true;
+};
+
+/// Traffic rules of fire trucks, ambulances and police cruisers, the members are the ones of RegularVehiclePolicy
+struct PriorityVehiclePolicy {
+    static constexpr EVehicleClass kClass = EVehicleClass::kPriority;
+    static constexpr bool kIgnoresLights = true;
+    static constexpr bool kUsesBusStops = false;
+};
+
+/// Constants shared by all vehicles of a type
+struct VehicleProfile {
+    double length;           // l -> length in meters
+    double maxVelocity;      // V_max -> maximal velocity in m/s
+    double maxAcceleration;  // a_max -> maximum acceleration of the engine in m/s^2
+    double maxBrakeForce;    // b_max -> maximal brake force of the car in Newtons
+    double minimalFollow;    // f_min -> minimal distance to a car in front in meters
+
+    /**
+     * Returns the profile of a vehicle type, the profiles are read from the constants file on first use
+     * @param type type of the vehicle
+     * @return profile of the type
+     */
+    static const VehicleProfile &of(EVehicleEntityTypes type);
+};
+
+/// Represents a vehicle, only its dynamic state is stored per vehicle
 class VehicleEntity : public Entity {
-    const EVehicleEntityTypes type;
+    // ordered to leave no padding: busStop fills the gap after the id (in release builds)
+    int busStop{-1};          // bus stop a bus is halting at or has halted at, -1 if none
 
-    double length;            // l -> length in meters  (const)
     double velocity{};        // v -> velocity in m/s
     double targetVelocity{};  // v_max -> velocity to be maintained in m/s
-    double maxVelocity;       // V_max -> maximal velocity in m/s   (const)
     double acceleration{};    // a -> current acceleration in m/s^2
-    double maxAcceleration;   // a_max -> maximum acceleration of the engine in
-                              // m/s^2   (const)
-    double maxBrakeForce;     // b_max -> maximal brake force of the car in Newtons
-                              // (const)
-    double minimalFollow;     // f_min -> minimal distance to a car in front in
-                              // meters  (const)
-    double brakeDistance{};   // Δx_s -> distance to braking zone + stopDistance in
-                              // meters
-    double stopDistance{};    // Δx_s0 -> distance to position to be stopped in meters
-    double brakeForce{};      // s -> current force applied to brakes in Newtons
-
-    // Bus variables
-    int ticksStopped{-1};  // amount of ticks a bus has been stopped
-    // bool ignoreStops = false;  // boolean used when the haltime of a busstop is reached
-    int busStop{-1};
+    double ticksStopped{-1};  // amount of ticks a bus has been stopped (fractional when its road is sub-stepped)
+
+    const EVehicleEntityTypes type;
+
+    bool steady{false};   // the last update left the state unchanged, repeating it moves the vehicle by the same amount
+    bool settled{false};  // the last update changed nothing, repeating it with the same input changes nothing either
 
   public:
+    /// lights and bus stops further away than this (in meters) do not influence the vehicle
+    static constexpr double kObstacleReach = 50;
+
     /**
-     * Represents a vehicle \n
-     * ENSURE(stepSize > 0, "stepSize is larger than zero"); \n
-     * ENSURE(length > 0, "length is greater than zero"); \n
-     * ENSURE(maxVelocity > 0, "maxVelocity is greater than zero"); \n
-     * ENSURE(maxAcceleration > 0, "maxAcceleration is greater than zero"); \n
-     * ENSURE(maxBrakeForce > 0, "maxBreakforce is greater than zero"); \n
-     * ENSURE(minimalFollow > 0, "minimalFollow is greater than zero"); \n
+     * Represents a vehicle, the constants of its type are read from its VehicleProfile \n
+     * ENSURE(getLength() > 0, "length is greater than zero"); \n
+     * ENSURE(getMaxVelocity() > 0, "maxVelocity is greater than zero"); \n
+     * ENSURE(getMaxAcceleration() > 0, "maxAcceleration is greater than zero"); \n
+     * ENSURE(getMaxBrakeForce() > 0, "maxBreakforce is greater than zero"); \n
+     * ENSURE(getMinimalFollow() > 0, "minimalFollow is greater than zero"); \n
      * ENSURE(properlyInitialized(), "Object is properly initialized"); \n
      * @param id entity identification number
-     * @param stepSize simulation stepsize
-     * @param length vehicle length measured from nose
-     * @param maxVelocity maximal velocity
-     * @param maxAcceleration maximal acceleration
-     * @param maxBrakeForce maximal brake force
-     * @param minimalFollow minimal follow distance between vehicles
+     * @param type type of the vehicle
      */
-    VehicleEntity(unsigned int id, double stepSize, EVehicleEntityTypes type);
+    VehicleEntity(unsigned int id, EVehicleEntityTypes type);
 
     /**
-     * Ticks the vehicle and updates the values accordingly with the stepSize \n
+     * Ticks the vehicle and updates the values accordingly with the stepSize, following the rules of its class \n
      * REQUIRE(properlyInitialized(), "object is properly initialized");
      * REQUIRE((distToLight > 0 && distToLight != std::numeric_limits<double>::infinity()) ||
               distToLight == std::numeric_limits<double>::infinity(),
@@ -87,13 +125,34 @@ class VehicleEntity : public Entity {
      * REQUIRE((distToBusStop == std::numeric_limits<double>::infinity() && busHaltTime ==
      std::numeric_limits<int>::infinity()) || (type == EVehicleEntityTypes::kBus), "Type is not a bus and busattributes
      are not set");
+     * REQUIRE(stepSize > 0, "stepSize is larger than zero"); \n
+     * REQUIRE(tickFraction > 0 && tickFraction <= 1, "update covers at most one tick");
      * @param distToCar
      * @param velOfNextCar
      * @param distToLight
+     * @param stepSize in-simulation time between two ticks
+     * @param tickFraction part of a tick covered by this update, the vehicle is integrated over stepSize * tickFraction
+     * (a power of two fraction keeps the halting time of busses exact)
+     * @return the change in position
+     */
+    double update(double distToCar, double velOfNextCar, double distToLight, double distToBusStop, int busHaltTime,
+                  unsigned int busStopId, const bool priorityVehicleInFront, const double stepSize,
+                  const double tickFraction = 1);
+
+    /**
+     * Same as update, specialized for one class of vehicles: the rules of the other classes are compiled out, so a
+     * loop over vehicles of the same class does not check the type of every vehicle. Instantiated for
+     * RegularVehiclePolicy, BusPolicy and PriorityVehiclePolicy. \n
+     * REQUIRE(properlyInitialized(), "object is properly initialized"); \n
+     * REQUIRE(vehicleClassOf(getType()) == Policy::kClass, "vehicle belongs to the class of the policy"); \n
+     * (and the contracts of update)
+     * @tparam Policy traffic rules of the class of the vehicle
      * @return the change in position
      */
+    template <typename Policy>
     double update(double distToCar, double velOfNextCar, double distToLight, double distToBusStop, int busHaltTime,
-                  unsigned int busStopId, const bool priorityVehicleInFront);
+                  unsigned int busStopId, const bool priorityVehicleInFront, const double stepSize,
+                  const double tickFraction = 1);
 
     // getters and setters
 
@@ -140,6 +199,12 @@ class VehicleEntity : public Entity {
      */
     EVehicleEntityTypes getType() const;
 
+    /**
+     * REQUIRE(properlyInitialized(), "object is properly initialized");
+     * @return class of the vehicle, which decides the traffic rules it follows
+     */
+    EVehicleClass getClass() const;
+
     /**
      * REQUIRE(properlyInitialized(), "object is properly initialized");
      * @return current velocity
@@ -179,46 +244,26 @@ class VehicleEntity : public Entity {
     void setAcceleration(const double &acceleration_);
 
     /**
-     * REQUIRE(brakeDistance_ > 0, "brakeDistance is greater than zero"); \n
-     * REQUIRE(properlyInitialized(), "object is properly initialized"); \n
-     * ENSURE(brakeDistance > 0, "brakeDistnce is greater than zero");
-     * @return brake distance
-     */
-    const double &getBrakeDistance() const;
-
-    /**
+     * Checks if the last update was a fixed point: the vehicle did not move and its state (velocity, acceleration,
+     * target velocity and bus stop bookkeeping) did not change. Since update only depends on this state and its
+     * arguments, updating again with the same arguments would change nothing either. Setting the velocity, target
+     * velocity or acceleration clears the flag. \n
      * REQUIRE(properlyInitialized(), "object is properly initialized");
-     * @param brakeDistance
+     * @return true if the vehicle is settled
      */
-    void setBrakeDistance(const double &brakeDistance);
+    bool isSettled() const;
 
     /**
+     * Checks if the last update left the state of the vehicle (velocity, acceleration, target velocity and bus stop
+     * bookkeeping) unchanged. Updating again with the same arguments then returns exactly the same displacement.
+     * Setting the velocity, target velocity or acceleration clears the flag. \n
      * REQUIRE(properlyInitialized(), "object is properly initialized");
-     * @return stop distance
+     * @return true if the vehicle is steady
      */
-    const double &getStopDistance() const;
-
-    /**
-     * REQUIRE(stopDistance_ > 0, "stopdistance is greater than zero"); \n
-     * REQUIRE(properlyInitialized(), "object is properly initialized"); \n
-     * ENSURE(stopDistance > 0, "stopDistance is greater than zero");
-     * @param stopDistance
-     */
-    void setStopDistance(const double &stopDistance);
-
-    /**
-     * REQUIRE(properlyInitialized(), "object is properly initialized");
-     * @return brake force
-     */
-    const double &getBrakeForce() const;
-
-    /**
-     * REQUIRE(brakeForce_ > 0, "brakeForce is greater than zero"); \n
-     * REQUIRE(properlyInitialized(), "object is properly initialized"); \n
-     * ENSURE(brakeForce > 0, "brakeForce is greater than zero");
-     * @param brakeForce
-     */
-    void setBrakeForce(const double &brakeForce);
+    bool isSteady() const;
 };
 
+// the state of a vehicle is read and written by every update, it has to fit in one cache line
+static_assert(sizeof(VehicleEntity) <= 64, "VehicleEntity fits in one cache line");
+
 #endif  // SE_PROJECT_VEHICLEENTITY_H
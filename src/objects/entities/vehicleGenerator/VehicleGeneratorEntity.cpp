@@ -16,7 +16,7 @@
 
 VehicleGeneratorEntity::VehicleGeneratorEntity(const unsigned int &id, double stepSize, const unsigned int &frequency,
                                                EVehicleEntityTypes type) :
-    Entity(id, stepSize), _frequency(frequency), _type(type), _timeLastChange(frequency) {
+    Entity(id), _frequency(frequency), _type(type), _stepSize(stepSize), _timeLastChange(frequency) {
     REQUIRE(stepSize > 0, "stepSize is larger than zero");
     REQUIRE(frequency > 0, "frequency is larger than zero");
     ENSURE(properlyInitialized(), "The object is properly initialized");
@@ -30,7 +30,7 @@ bool VehicleGeneratorEntity::update() {
         _timeLastChange = 0;
         return true;
     } else {
-        _timeLastChange += stepSize;
+        _timeLastChange += _stepSize;
         return false;
     }
 }
@@ -17,6 +17,7 @@
 class VehicleGeneratorEntity : public Entity {
     const unsigned int _frequency;
     const EVehicleEntityTypes _type;
+    const double _stepSize;
     double _timeLastChange = 0;
 
   public:
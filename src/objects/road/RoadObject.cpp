@@ -11,8 +11,9 @@
 
 #include <string>
 
-RoadObject::RoadObject(const unsigned int &id, const std::string &name, const unsigned int &length) :
-    Object(id), _name(name), _length(length) {
+RoadObject::RoadObject(const unsigned int &id, const std::string &name, const unsigned int &length,
+                       ERoadLevel level) :
+    Object(id), _name(name), _length(length), _level(level) {
     ENSURE(properlyInitialized(), "Object is properly initialized");
 }
 
@@ -25,3 +26,8 @@ const unsigned int &RoadObject::getLength() const {
     REQUIRE(properlyInitialized(), "Object is properlyInitialized");
     return _length;
 }
+
+ERoadLevel RoadObject::getLevel() const {
+    REQUIRE(properlyInitialized(), "Object is properlyInitialized");
+    return _level;
+}
@@ -18,10 +18,17 @@
 // Note: there are no pre/post- conditions because the parameter types solve all
 // of them
 
+/// Level of detail a road is simulated at
+enum class ERoadLevel {
+    kMicro,  // every vehicle is a VehicleEntity following the vehicle in front of it
+    kMeso    // the road is a point queue (MesoLinkEntity), vehicles only have a type and an arrival time
+};
+
 /// Represents a road
 class RoadObject : public Object {
     const std::string _name;
     const unsigned int _length;
+    const ERoadLevel _level;
 
   public:
     /**
@@ -30,8 +37,10 @@ class RoadObject : public Object {
      * @param id id to given to the object
      * @param name name of the road
      * @param length length of the road
+     * @param level level of detail the road is simulated at
      */
-    RoadObject(const unsigned int &id, const std::string &name, const unsigned int &length);
+    RoadObject(const unsigned int &id, const std::string &name, const unsigned int &length,
+               ERoadLevel level = ERoadLevel::kMicro);
 
     /**
      * REQUIRE(properlyInitialized(), "Object is properlyInitialized");
@@ -44,6 +53,12 @@ class RoadObject : public Object {
      * @return length of the road
      */
     const unsigned int &getLength() const;
+
+    /**
+     * REQUIRE(properlyInitialized(), "Object is properlyInitialized");
+     * @return level of detail of the road
+     */
+    ERoadLevel getLevel() const;
 };
 
 #endif  // SE_PROJECT_ROADOBJECT_H
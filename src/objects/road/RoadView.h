@@ -0,0 +1,139 @@
+//============================================================================
+// Name        : RoadView.h
+// Description : Read only view over a road of a simulation, the vehicles and the lights on it
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_ROADVIEW_H
+#define SE_PROJECT_ROADVIEW_H
+
+#include <cstddef>
+#include <iterator>
+
+#include "../../lib/utils/Id.h"
+#include "../../lib/utils/Span.h"
+#include "../entities/vehicle/VehicleEntity.h"
+#include "RoadObject.h"
+
+/// State of a vehicle on a road, as a RoadView presents it
+struct RoadVehicle {
+    id vehicleId;              // id of the vehicle
+    double position;           // position of the front of the vehicle on the road
+    double velocity;           // velocity in m/s
+    EVehicleEntityTypes type;  // type of the vehicle
+};
+
+/**
+ * Presents a road, the vehicles on it and its lights as read only spans of a snapshot of the simulation, one span per
+ * attribute (structure of arrays), so a consumer reads them without copies or hash lookups. The vehicles are sorted by
+ * position (back of the road first), the i-th value of every vehicle span belongs to the same vehicle. The lights are
+ * sorted by position as well. Valid until the simulation changes (a tick, an injected or a removed vehicle).
+ */
+class RoadView {
+  public:
+    /// Forward iterator over the vehicles of the road, gathers the values of a vehicle from the spans
+    class const_iterator {
+        const RoadView *view;
+        std::size_t index;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = RoadVehicle;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type *;
+        using reference = value_type;
+
+        const_iterator(const RoadView &view, std::size_t index) : view(&view), index(index) {}
+
+        value_type operator*() const {
+            return {view->vehicleIds[index], view->positions[index], view->velocities[index], view->types[index]};
+        }
+
+        const_iterator &operator++() {
+            ++index;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const const_iterator &other) const { return index == other.index; }
+
+        bool operator!=(const const_iterator &other) const { return !(*this == other); }
+    };
+
+  private:
+    const RoadObject &road;
+    Span<id> vehicleIds;
+    Span<double> positions;
+    Span<double> velocities;
+    Span<EVehicleEntityTypes> types;
+    Span<id> lightIds;
+    Span<double> lightPositions;
+    Span<unsigned char> lightsGreen;
+
+  public:
+    /**
+     * @param road the road
+     * @param vehicleIds ids of the vehicles on the road
+     * @param positions positions of the same vehicles
+     * @param velocities velocities of the same vehicles
+     * @param types types of the same vehicles
+     * @param lightIds ids of the lights on the road
+     * @param lightPositions positions of the same lights
+     * @param lightsGreen 1 for every one of the same lights that is green, 0 if it is red
+     */
+    RoadView(const RoadObject &road, Span<id> vehicleIds, Span<double> positions, Span<double> velocities,
+             Span<EVehicleEntityTypes> types, Span<id> lightIds, Span<double> lightPositions,
+             Span<unsigned char> lightsGreen) :
+        road(road),
+        vehicleIds(vehicleIds),
+        positions(positions),
+        velocities(velocities),
+        types(types),
+        lightIds(lightIds),
+        lightPositions(lightPositions),
+        lightsGreen(lightsGreen) {}
+
+    /// @return the road
+    const RoadObject &getRoad() const { return road; }
+
+    const_iterator begin() const { return {*this, 0}; }
+
+    const_iterator end() const { return {*this, vehicleIds.size()}; }
+
+    /// @return amount of vehicles on the road
+    std::size_t size() const { return vehicleIds.size(); }
+
+    /// @return true if there are no vehicles on the road
+    bool empty() const { return vehicleIds.empty(); }
+
+    /// @return ids of the vehicles on the road
+    Span<id> getVehicleIds() const { return vehicleIds; }
+
+    /// @return positions of the fronts of the vehicles on the road, ascending
+    Span<double> getPositions() const { return positions; }
+
+    /// @return velocities of the vehicles on the road in m/s
+    Span<double> getVelocities() const { return velocities; }
+
+    /// @return types of the vehicles on the road
+    Span<EVehicleEntityTypes> getTypes() const { return types; }
+
+    /// @return ids of the lights on the road
+    Span<id> getLightIds() const { return lightIds; }
+
+    /// @return positions of the lights on the road, ascending
+    Span<double> getLightPositions() const { return lightPositions; }
+
+    /// @return 1 for every light on the road that is green, 0 if it is red (a byte, std::vector<bool> has no span)
+    Span<unsigned char> getLightsGreen() const { return lightsGreen; }
+};
+
+#endif  // SE_PROJECT_ROADVIEW_H
@@ -0,0 +1,23 @@
+//============================================================================
+// Name        : AllocationCounter.h
+// Description : Counts heap allocations made by the test binary
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/20
+// Version     : 1.0
+//============================================================================
+
+#ifndef SE_PROJECT_ALLOCATIONCOUNTER_H
+#define SE_PROJECT_ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+// Note: the global operator new of the test binary is replaced in SimulationTest.cpp (test entry) to keep track of
+// this counter
+
+namespace AllocationCounter {
+    /// @return amount of heap allocations done through operator new since the start of the test binary
+    std::size_t count();
+}  // namespace AllocationCounter
+
+#endif  // SE_PROJECT_ALLOCATIONCOUNTER_H
@@ -0,0 +1,224 @@
+//============================================================================
+// Name        : CApiTest.c
+// Description : Test program of the C interface of the trafficsim library, written in C to check that it is plain C
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../../TrafficSimC.h"
+
+/// amount of checks that failed
+static int failures = 0;
+
+/// reports a failed check and continues with the next one
+#define CHECK(condition)                                                                  \
+    do {                                                                                  \
+        if (!(condition)) {                                                               \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++failures;                                                                   \
+        }                                                                                 \
+    } while (0)
+
+/// checks that a call returns the expected status, the last error is written when it does not
+#define CHECK_STATUS(expected, call)                                                                      \
+    do {                                                                                                  \
+        const TsStatus status = (call);                                                                   \
+        if (status != (expected)) {                                                                       \
+            fprintf(stderr, "%s:%d: %s returned %s instead of %s (%s)\n", __FILE__, __LINE__, #call,      \
+                    ts_status_name(status), ts_status_name(expected), ts_last_error());                   \
+            ++failures;                                                                                   \
+        }                                                                                                 \
+    } while (0)
+
+static const char kScenario[] = "<ROOT>\n"
+                                "<BAAN><naam>main</naam><lengte>1000</lengte></BAAN>\n"
+                                "<BAAN><naam>side</naam><lengte>400</lengte></BAAN>\n"
+                                "<VERKEERSLICHT><baan>main</baan><positie>500</positie><cyclus>5</cyclus>"
+                                "</VERKEERSLICHT>\n"
+                                "<VOERTUIG><baan>main</baan><positie>20</positie><type>auto</type></VOERTUIG>\n"
+                                "<VOERTUIG><baan>main</baan><positie>100</positie><type>bus</type></VOERTUIG>\n"
+                                "<VOERTUIG><baan>side</baan><positie>50</positie><type>ziekenwagen</type></VOERTUIG>\n"
+                                "</ROOT>\n";
+
+/// a simulation from memory: the roads, the vehicles and the lights are exported into arrays of the caller
+static void testBuffer(void) {
+    TsSimulation *sim = NULL;
+    CHECK_STATUS(TS_OK, ts_create_from_buffer(kScenario, strlen(kScenario), 1.0 / 60.0, &sim));
+    if (!sim) return;
+    CHECK_STATUS(TS_OK, ts_set_seed(sim, 7));
+
+    uint32_t mainRoad = 0;
+    uint32_t sideRoad = 0;
+    CHECK_STATUS(TS_OK, ts_find_road(sim, "main", &mainRoad));
+    CHECK_STATUS(TS_OK, ts_find_road(sim, "side", &sideRoad));
+    CHECK_STATUS(TS_NOT_FOUND, ts_find_road(sim, "nowhere", &mainRoad));
+    CHECK(strstr(ts_last_error(), "nowhere") != NULL);
+
+    uint32_t roadIds[4];
+    double lengths[4];
+    size_t count = 0;
+    CHECK_STATUS(TS_OK, ts_export_roads(sim, 4, roadIds, lengths, &count));
+    CHECK(count == 2);
+    CHECK(roadIds[0] < roadIds[1]);
+    CHECK((roadIds[0] == mainRoad ? lengths[0] : lengths[1]) == 1000);
+
+    // too small: nothing is copied, the required capacity is returned
+    uint32_t vehicleIds[8];
+    uint32_t vehicleRoads[8];
+    double positions[8];
+    double velocities[8];
+    int32_t types[8];
+    CHECK_STATUS(TS_OK, ts_get_vehicle_count(sim, &count));
+    CHECK(count == 3);
+    positions[0] = -1;
+    CHECK_STATUS(TS_BUFFER_TOO_SMALL, ts_export_vehicles(sim, 2, vehicleIds, vehicleRoads, positions, velocities,
+                                                         types, &count));
+    CHECK(count == 3);
+    CHECK(positions[0] == -1);
+
+    // grouped by road, sorted by position on a road
+    CHECK_STATUS(TS_OK, ts_export_vehicles(sim, 8, vehicleIds, vehicleRoads, positions, velocities, types, &count));
+    CHECK(count == 3);
+    for (size_t i = 0; i < count; ++i) {
+        if (vehicleRoads[i] == mainRoad) {
+            CHECK(positions[i] == (types[i] == TS_BUS ? 100 : 20));
+        } else {
+            CHECK(vehicleRoads[i] == sideRoad && positions[i] == 50 && types[i] == TS_AMBULANCE);
+        }
+        CHECK(velocities[i] == 0);
+    }
+    CHECK(vehicleRoads[0] <= vehicleRoads[1] && vehicleRoads[1] <= vehicleRoads[2]);
+
+    // ticked in a batch, the vehicles drive off
+    CHECK_STATUS(TS_OK, ts_tick(sim, 120));
+    uint32_t iteration = 0;
+    double seconds = 0;
+    CHECK_STATUS(TS_OK, ts_get_time(sim, &iteration, &seconds));
+    CHECK(iteration == 120);
+    CHECK(seconds > 1.99 && seconds < 2.01);
+    CHECK_STATUS(TS_OK, ts_export_road_vehicles(sim, mainRoad, 8, vehicleIds, positions, velocities, NULL, &count));
+    CHECK(count == 2);
+    CHECK(positions[0] > 20 && positions[0] < positions[1] && velocities[0] > 0);
+
+    // the light changes color every 5 seconds
+    uint32_t lightIds[2];
+    double lightPositions[2];
+    uint8_t green[2];
+    CHECK_STATUS(TS_OK, ts_export_road_lights(sim, mainRoad, 2, lightIds, lightPositions, green, &count));
+    CHECK(count == 1 && lightPositions[0] == 500);
+    const uint8_t wasGreen = green[0];
+    CHECK_STATUS(TS_OK, ts_tick(sim, 300));
+    CHECK_STATUS(TS_OK, ts_export_road_lights(sim, mainRoad, 2, NULL, NULL, green, &count));
+    CHECK(green[0] != wasGreen);
+    CHECK_STATUS(TS_OK, ts_export_road_lights(sim, sideRoad, 0, NULL, NULL, NULL, &count));
+    CHECK(count == 0);
+
+    // vehicles are added and taken out between ticks
+    uint32_t injected = 0;
+    CHECK_STATUS(TS_OK, ts_inject_vehicle(sim, sideRoad, 300, TS_FIRE_TRUCK, &injected));
+    CHECK_STATUS(TS_REFUSED, ts_inject_vehicle(sim, sideRoad, 301, TS_CAR, NULL));
+    CHECK_STATUS(TS_REFUSED, ts_inject_vehicle(sim, sideRoad, 401, TS_CAR, NULL));
+    CHECK_STATUS(TS_OK, ts_export_road_vehicles(sim, sideRoad, 8, vehicleIds, positions, NULL, types, &count));
+    CHECK(count == 2 && vehicleIds[1] == injected && positions[1] == 300 && types[1] == TS_FIRE_TRUCK);
+    CHECK_STATUS(TS_OK, ts_remove_vehicle(sim, injected));
+    CHECK_STATUS(TS_NOT_FOUND, ts_remove_vehicle(sim, injected));
+    CHECK_STATUS(TS_OK, ts_export_road_vehicles(sim, sideRoad, 8, NULL, NULL, NULL, NULL, &count));
+    CHECK(count == 1);
+
+    // broken arguments are refused instead of aborting
+    CHECK_STATUS(TS_INVALID_ARGUMENT, ts_inject_vehicle(sim, sideRoad, -1, TS_CAR, NULL));
+    CHECK_STATUS(TS_INVALID_ARGUMENT, ts_inject_vehicle(sim, sideRoad, 10, 9, NULL));
+    CHECK_STATUS(TS_NOT_FOUND, ts_inject_vehicle(sim, 12345, 10, TS_CAR, NULL));
+    CHECK_STATUS(TS_NOT_FOUND, ts_export_road_vehicles(sim, 12345, 8, NULL, NULL, NULL, NULL, &count));
+    CHECK_STATUS(TS_INVALID_ARGUMENT, ts_set_threads(sim, 0));
+    CHECK_STATUS(TS_INVALID_ARGUMENT, ts_export_vehicles(sim, 8, NULL, NULL, NULL, NULL, NULL, NULL));
+    CHECK_STATUS(TS_INVALID_ARGUMENT, ts_tick(NULL, 1));
+
+    ts_destroy(sim);
+    ts_destroy(NULL);
+}
+
+/// a simulation from a file, two simulations with the same seed export the same state
+static void testPath(const char *directory) {
+    char path[4096];
+    snprintf(path, sizeof(path), "%s../SimulationTest/res/test12.xml", directory);
+
+    TsSimulation *first = NULL;
+    TsSimulation *second = NULL;
+    CHECK_STATUS(TS_OK, ts_create_from_path(path, 1.0 / 60.0, &first));
+    CHECK_STATUS(TS_OK, ts_create_from_path(path, 1.0 / 60.0, &second));
+    if (!first || !second) return;
+    CHECK_STATUS(TS_OK, ts_set_seed(first, 3));
+    CHECK_STATUS(TS_OK, ts_set_seed(second, 3));
+    CHECK_STATUS(TS_OK, ts_set_threads(second, 2));
+    CHECK_STATUS(TS_OK, ts_tick(first, 600));
+    for (int i = 0; i < 6; ++i) CHECK_STATUS(TS_OK, ts_tick(second, 100));
+
+    enum { kCapacity = 256 };
+    uint32_t firstIds[kCapacity];
+    uint32_t secondIds[kCapacity];
+    double firstPositions[kCapacity];
+    double secondPositions[kCapacity];
+    size_t firstCount = 0;
+    size_t secondCount = 0;
+    CHECK_STATUS(TS_OK, ts_export_vehicles(first, kCapacity, firstIds, NULL, firstPositions, NULL, NULL, &firstCount));
+    CHECK_STATUS(TS_OK,
+                 ts_export_vehicles(second, kCapacity, secondIds, NULL, secondPositions, NULL, NULL, &secondCount));
+    CHECK(firstCount > 0 && firstCount == secondCount);
+    CHECK(memcmp(firstIds, secondIds, firstCount * sizeof(uint32_t)) == 0);
+    CHECK(memcmp(firstPositions, secondPositions, firstCount * sizeof(double)) == 0);
+    ts_destroy(first);
+    ts_destroy(second);
+}
+
+/// a scenario that cannot be loaded is a status with the reason
+static void testErrors(void) {
+    TsSimulation *sim = NULL;
+    CHECK_STATUS(TS_IO_ERROR, ts_create_from_path("/tmp/sim_capi_missing.xml", 1.0 / 60.0, &sim));
+    CHECK(sim == NULL);
+    CHECK(strstr(ts_last_error(), "/tmp/sim_capi_missing.xml") != NULL);
+
+    const char broken[] = "<ROOT><BAAN><naam>main</naam></BAAN></ROOT>";
+    CHECK_STATUS(TS_INVALID_SCENARIO, ts_create_from_buffer(broken, strlen(broken), 1.0 / 60.0, &sim));
+    CHECK(sim == NULL);
+    CHECK(strlen(ts_last_error()) > 0);
+
+    // valid xml that the simulation cannot build: the lights of the crossroad would stand before the start of road a
+    const char noRoomForLights[] = "<ROOT><BAAN><naam>a</naam><lengte>500</lengte></BAAN>"
+                                   "<BAAN><naam>b</naam><lengte>500</lengte></BAAN>"
+                                   "<KRUISPUNT><baan positie=\"0\">a</baan><baan positie=\"100\">b</baan>"
+                                   "<lichten>5</lichten></KRUISPUNT></ROOT>";
+    CHECK_STATUS(TS_INVALID_SCENARIO,
+                 ts_create_from_buffer(noRoomForLights, strlen(noRoomForLights), 1.0 / 60.0, &sim));
+    CHECK(sim == NULL);
+    CHECK(strstr(ts_last_error(), "crossroad") != NULL);
+
+    CHECK_STATUS(TS_INVALID_ARGUMENT, ts_create_from_buffer(kScenario, strlen(kScenario), 0, &sim));
+    CHECK_STATUS(TS_INVALID_ARGUMENT, ts_create_from_buffer(NULL, 0, 1.0 / 60.0, &sim));
+    CHECK_STATUS(TS_INVALID_ARGUMENT, ts_create_from_path("unused.xml", 1.0 / 60.0, NULL));
+    CHECK(strcmp(ts_status_name(TS_REFUSED), "TS_REFUSED") == 0);
+}
+
+int main(void) {
+    // the resources are found next to this file, like the tests of sim_test do
+    char directory[4096];
+    snprintf(directory, sizeof(directory), "%s", __FILE__);
+    char *slash = strrchr(directory, '/');
+    if (slash) slash[1] = '\0';
+
+    testBuffer();
+    testPath(directory);
+    testErrors();
+
+    if (failures) {
+        fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,133 @@
+//============================================================================
+// Name        : CommandLineTest.cpp
+// Description : Test file of the command line parser
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/21
+// Version     : 1.0
+//============================================================================
+
+#include <gtest/gtest.h>
+
+#include "../../lib/cli/CommandLine.h"
+
+TEST(CommandLineTest, Defaults) {
+    const char *argv[] = {"sim"};
+
+    const RunOptions options = CommandLine::parse(1, argv);
+
+    EXPECT_EQ(30000u, options.ticks);
+    EXPECT_DOUBLE_EQ(1.0 / 60.0, options.stepSize);
+    EXPECT_EQ(EOutputFormat::kJson, options.format);
+    EXPECT_EQ(1u, options.outputEvery);
+    EXPECT_EQ(1u, options.threads);
+    EXPECT_EQ(1u, options.substeps);
+    EXPECT_FALSE(options.seed.has_value());
+    EXPECT_TRUE(options.profilePath.empty());
+    EXPECT_FALSE(options.help);
+}
+
+TEST(CommandLineTest, AllOptions) {
+    const char *argv[] = {"sim", "scenario.xml", "--ticks", "100", "--step", "1/30", "--format", "binary",
+                          "-o",  "out.bin",      "--every", "10",  "-j",     "4",    "--seed",   "42",
+                          "--profile", "profile.json", "--trace", "trace.json", "--trace-spans", "100"};
+
+    const RunOptions options = CommandLine::parse(22, argv);
+
+    EXPECT_EQ("scenario.xml", options.scenarioPath);
+    EXPECT_EQ(100u, options.ticks);
+    EXPECT_DOUBLE_EQ(1.0 / 30.0, options.stepSize);
+    EXPECT_EQ(EOutputFormat::kBinary, options.format);
+    EXPECT_EQ("out.bin", options.outputPath);
+    EXPECT_EQ(10u, options.outputEvery);
+    EXPECT_EQ(4u, options.threads);
+    EXPECT_EQ(42u, options.seed.value());
+    EXPECT_EQ("profile.json", options.profilePath);
+    EXPECT_EQ("trace.json", options.tracePath);
+    EXPECT_EQ(100u, options.traceSpans);
+}
+
+TEST(CommandLineTest, DurationUsesStepSize) {
+    const char *argv[] = {"sim", "-d", "10", "-s", "0.5"};
+
+    EXPECT_EQ(20u, CommandLine::parse(5, argv).ticks);
+}
+
+TEST(CommandLineTest, AdaptiveStepping) {
+    const char *argv[] = {"sim", "--step", "0.5", "--substeps", "16", "--tolerance", "0.01"};
+
+    const RunOptions options = CommandLine::parse(7, argv);
+
+    EXPECT_EQ(16u, options.substeps);
+    EXPECT_DOUBLE_EQ(0.01, options.tolerance);
+}
+
+TEST(CommandLineTest, InvalidArguments) {
+    const char *unknown[] = {"sim", "--frobnicate", "1"};
+    const char *missingValue[] = {"sim", "--ticks"};
+    const char *negative[] = {"sim", "--ticks", "-5"};
+    const char *badFormat[] = {"sim", "--format", "xml"};
+    const char *zeroStep[] = {"sim", "--step", "0"};
+    const char *twoScenarios[] = {"sim", "a.xml", "b.xml"};
+    const char *oddSubsteps[] = {"sim", "--substeps", "6"};
+    const char *zeroSpeed[] = {"sim", "--realtime", "0"};
+    const char *latencyWithoutPacing[] = {"sim", "--latency", "latency.json"};
+    const char *zeroServeBuffer[] = {"sim", "--serve-buffer", "0"};
+    const char *zeroResolution[] = {"sim", "--resolution", "0"};
+    const char *zeroKeyframes[] = {"sim", "--keyframes", "0"};
+    const char *badSink[] = {"sim", "-o", "out.bin", "--sink", "pipe"};
+    const char *mappedStdout[] = {"sim", "--sink", "mmap"};
+
+    EXPECT_THROW(CommandLine::parse(3, unknown), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(2, missingValue), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, negative), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, badFormat), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, zeroStep), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, twoScenarios), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, oddSubsteps), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, zeroSpeed), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, latencyWithoutPacing), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, zeroServeBuffer), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, zeroResolution), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, zeroKeyframes), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(5, badSink), std::runtime_error);
+    EXPECT_THROW(CommandLine::parse(3, mappedStdout), std::runtime_error);
+}
+
+TEST(CommandLineTest, RealTime) {
+    const char *argv[] = {"sim", "--realtime", "10", "--latency", "latency.json"};
+
+    const RunOptions options = CommandLine::parse(5, argv);
+
+    EXPECT_DOUBLE_EQ(10, options.realtime);
+    EXPECT_EQ("latency.json", options.latencyPath);
+}
+
+TEST(CommandLineTest, Serve) {
+    const char *argv[] = {"sim", "--serve", "unix:/tmp/sim.sock", "--serve-buffer", "65536"};
+
+    const RunOptions options = CommandLine::parse(5, argv);
+
+    EXPECT_EQ("unix:/tmp/sim.sock", options.serveAddress);
+    EXPECT_EQ(65536u, options.serveBuffer);
+    EXPECT_EQ("", CommandLine::parse(1, argv).serveAddress);
+}
+
+TEST(CommandLineTest, DeltaFormat) {
+    const char *argv[] = {"sim", "--format", "delta", "--resolution", "0.01", "--keyframes", "60"};
+
+    const RunOptions options = CommandLine::parse(7, argv);
+
+    EXPECT_EQ(EOutputFormat::kDelta, options.format);
+    EXPECT_DOUBLE_EQ(0.01, options.deltaResolution);
+    EXPECT_EQ(60u, options.keyframeEvery);
+    EXPECT_DOUBLE_EQ(0.001, CommandLine::parse(1, argv).deltaResolution);
+    EXPECT_EQ(600u, CommandLine::parse(1, argv).keyframeEvery);
+}
+
+TEST(CommandLineTest, MappedOutput) {
+    const char *argv[] = {"sim", "--sink", "mmap", "-o", "out.bin"};
+
+    EXPECT_TRUE(CommandLine::parse(5, argv).mappedOutput);
+    EXPECT_FALSE(CommandLine::parse(1, argv).mappedOutput);
+}
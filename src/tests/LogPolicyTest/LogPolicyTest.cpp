@@ -0,0 +1,85 @@
+//============================================================================
+// Name        : LogPolicyTest.cpp
+// Description : Test file of the log policy
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/22
+// Version     : 1.0
+//============================================================================
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include "../../Simulation.h"
+#include "../../lib/logger/LogPolicy.h"
+#include "../../lib/logger/Logger.h"
+
+namespace {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "../SimulationTest/res/";
+
+    /// runs test0.xml for the given amount of ticks and returns the iterations that were logged
+    std::vector<unsigned int> loggedIterations(LogPolicy &policy, unsigned int ticks) {
+        std::ostream dummyStream(nullptr);
+        const std::ifstream xmlFile(kResPath + "test0.xml");
+        Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+
+        std::vector<unsigned int> result;
+        for (unsigned int i = 0; i < ticks; ++i) {
+            std::stringstream outputStream("");
+            if (Logger::logAsJson(sim, outputStream, policy)) {
+                EXPECT_FALSE(outputStream.str().empty());
+                result.push_back(sim.getIteration());
+            } else {
+                EXPECT_TRUE(outputStream.str().empty());
+            }
+            sim.godTick();
+        }
+        return result;
+    }
+}  // namespace
+
+TEST(LogPolicyTest, EveryFrameByDefault) {
+    LogPolicy policy;
+    EXPECT_EQ(50u, loggedIterations(policy, 50).size());
+}
+
+TEST(LogPolicyTest, EveryNTicks) {
+    LogPolicy policy;
+    policy.everyTicks(10);
+    EXPECT_EQ(std::vector<unsigned int>({0, 10, 20, 30, 40}), loggedIterations(policy, 50));
+}
+
+TEST(LogPolicyTest, EveryTSecondsInsideWindow) {
+    LogPolicy policy;
+    // one frame every half second between second 1 and 2 (ticks of 1/60 s)
+    policy.everySeconds(0.5).window(1, 2);
+    EXPECT_EQ(std::vector<unsigned int>({60, 90, 120}), loggedIterations(policy, 200));
+}
+
+TEST(LogPolicyTest, SameAnswerWithinOneIteration) {
+    std::ostream dummyStream(nullptr);
+    const std::ifstream xmlFile(kResPath + "test0.xml");
+    Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+
+    LogPolicy policy;
+    policy.everySeconds(1);
+    EXPECT_TRUE(policy.shouldLog(sim));
+    EXPECT_TRUE(policy.shouldLog(sim));
+    sim.godTick();
+    EXPECT_FALSE(policy.shouldLog(sim));
+}
+
+TEST(LogPolicyTest, QueueTrigger) {
+    // the only vehicle of test0.xml stops in front of the red light at 500m
+    LogPolicy policy;
+    policy.onEvent(LogPolicy::queueForms(1));
+    const std::vector<unsigned int> logged = loggedIterations(policy, 3000);
+
+    // the vehicle starts standing still, drives off and then waits in front of the light
+    ASSERT_FALSE(logged.empty());
+    EXPECT_EQ(0u, logged.front());
+    EXPECT_GT(logged.back(), 1000u);
+    EXPECT_LT(logged.size(), 3000u);
+}
@@ -0,0 +1,95 @@
+//============================================================================
+// Name        : MesoLinkTest.cpp
+// Description : Test file of the point queue of mesoscopic roads
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/26
+// Version     : 1.0
+//============================================================================
+
+#include <gtest/gtest.h>
+
+#include "../../objects/entities/mesoLink/MesoLinkEntity.h"
+
+namespace {
+    const double kStepSize = 1.0 / 60.0;
+    const id kRoadId = 7;
+    const id kCrossRoadId = 12;
+}  // namespace
+
+TEST(MesoLinkTest, VehiclesStopAtCrossRoads) {
+    MesoLinkEntity link(kRoadId, kStepSize, 1000, MesoLinkProfile::get());
+    link.addCrossRoad(500, kCrossRoadId);
+
+    // a car drives at 16.6 m/s, it reaches the crossroad after about 30 seconds
+    link.enter(EVehicleEntityTypes::kCar, 0, 0);
+    EXPECT_FALSE(link.hasDeparture(30));
+    ASSERT_TRUE(link.hasDeparture(31));
+
+    const MesoLinkEntity::Vehicle atCrossRoad = link.depart(31);
+    EXPECT_EQ(kCrossRoadId, atCrossRoad.crossRoad);
+    EXPECT_DOUBLE_EQ(500, atCrossRoad.position);
+    EXPECT_DOUBLE_EQ(500 / 16.6, atCrossRoad.arrival);
+    EXPECT_EQ(0u, link.getVehicleCount());
+
+    // going straight ahead it drives on to the end of the road
+    link.pass(atCrossRoad, 31);
+    EXPECT_EQ(1u, link.getVehicleCount());
+    ASSERT_TRUE(link.hasDeparture(62));
+
+    const MesoLinkEntity::Vehicle atEnd = link.depart(62);
+    EXPECT_EQ(kRoadId, atEnd.crossRoad);
+    EXPECT_DOUBLE_EQ(1000, atEnd.position);
+    EXPECT_EQ(EVehicleEntityTypes::kCar, atEnd.type);
+}
+
+TEST(MesoLinkTest, ExitCapacity) {
+    MesoLinkEntity link(kRoadId, kStepSize, 1000, MesoLinkProfile::get());
+
+    // all vehicles are at the end of the road right away
+    for (unsigned int i = 0; i < 3; ++i) link.place(EVehicleEntityTypes::kCar, 1000, 0);
+
+    // a vehicle leaves every 1 / capacity seconds
+    const unsigned int ticksPerVehicle = (unsigned int) std::ceil(1 / (link.getCapacity() * kStepSize) - 1e-9);
+    unsigned int departures = 0;
+    for (unsigned int tick = 0; tick < 2 * ticksPerVehicle; ++tick) {
+        while (link.hasDeparture(tick * kStepSize)) {
+            link.depart(tick * kStepSize);
+            ++departures;
+        }
+        link.update();
+    }
+
+    EXPECT_EQ(2u, departures);
+    EXPECT_EQ(1u, link.getVehicleCount());
+}
+
+TEST(MesoLinkTest, Storage) {
+    MesoLinkEntity link(kRoadId, kStepSize, 40, MesoLinkProfile::get());
+    ASSERT_LT(0u, link.getStorage());
+
+    unsigned int ticks = 0;
+    while (link.getVehicleCount() < link.getStorage() && ticks < 100000) {
+        if (link.canEnter()) link.enter(EVehicleEntityTypes::kCar, 0, ticks * kStepSize);
+        link.update();
+        ++ticks;
+    }
+
+    // the entry capacity spaces the vehicles, once the link is full nothing enters anymore
+    EXPECT_EQ(link.getStorage(), link.getVehicleCount());
+    EXPECT_GE(ticks * kStepSize * link.getCapacity(), link.getStorage() - 1);
+    link.update();
+    EXPECT_FALSE(link.canEnter());
+}
+
+TEST(MesoLinkTest, ProfileIsReadOnce) {
+    // every link shares the profile of the constants file
+    EXPECT_EQ(&MesoLinkProfile::get(), &MesoLinkProfile::get());
+    EXPECT_LT(0, MesoLinkProfile::get().capacity);
+
+    // the capacity and storage follow the profile that is passed in
+    const MesoLinkProfile profile{0.25, 8};
+    MesoLinkEntity link(kRoadId, kStepSize, 100, profile);
+    EXPECT_EQ(0.25, link.getCapacity());
+    EXPECT_EQ(12u, link.getStorage());
+}
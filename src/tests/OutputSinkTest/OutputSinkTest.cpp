@@ -0,0 +1,123 @@
+//============================================================================
+// Name        : OutputSinkTest.cpp
+// Description : Test file of the output sinks of the loggers
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "../../Simulation.h"
+#include "../../lib/logger/Logger.h"
+#include "../../lib/logger/OutputSink.h"
+#include "../../lib/stream/RecordingWriter.h"
+
+namespace {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "../SimulationTest/res/";
+
+    /// an output file of this test run
+    std::string outputPath(const std::string &name) {
+        return "/tmp/sim_sink_" + std::to_string(::getpid()) + '_' + name + ".out";
+    }
+
+    std::string readFile(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    /// writes every format of a few hundred ticks of test10.xml to the sink
+    void writeRun(OutputSink &sink) {
+        std::ostream dummyStream(nullptr);
+        std::ifstream xmlFile(kResPath + "test10.xml");
+        Simulation sim(xmlFile, 1.0 / 60.0, dummyStream);
+        sim.setSeed(2);
+        RecordingWriter recording(sim);
+        for (unsigned int i = 0; i < 300; ++i) {
+            Logger::logAsJson(sim, sink);
+            Logger::logSimpleOutput(sim, sink);
+            Logger::logAdvancedOutput(sim, sink, 40);
+            Logger::logAsBinary(sim, sink);
+            Logger::logAsDelta(sim, sink, recording);
+            sim.godTick();
+        }
+        recording.finish(sink);
+    }
+}  // namespace
+
+TEST(OutputSinkTest, NumbersAreWrittenLikeOstream) {
+    std::ostringstream expected;
+    std::ostringstream actual;
+    {
+        StreamSink sink(actual);
+        for (const double value : {0.0, 1.5, 1.0 / 3.0, -2.25, 123456789.0, 1e-7, 1e21, 17.0 / 60.0, 4999.99999}) {
+            expected << value << ' ';
+            sink.writeNumber(value);
+            sink.put(' ');
+        }
+        expected << 0ull << ' ' << 18446744073709551615ull;
+        sink.writeNumber(0ull);
+        sink.put(' ');
+        sink.writeNumber(18446744073709551615ull);
+    }
+    EXPECT_EQ(expected.str(), actual.str());
+}
+
+TEST(OutputSinkTest, StreamSinkBuffersUntilFlush) {
+    std::ostringstream out;
+    StreamSink sink(out);
+    sink.write("frame\n");
+    EXPECT_EQ("", out.str());
+    EXPECT_EQ(6u, sink.getBytes());
+    sink.flush();
+    EXPECT_EQ("frame\n", out.str());
+
+    // a write larger than the buffer goes straight through
+    const std::string large(StreamSink::kBufferSize * 3 + 5, 'x');
+    sink.put('a');
+    sink.write(large);
+    EXPECT_EQ("frame\na" + large, out.str());
+    EXPECT_EQ(7u + large.size(), sink.getBytes());
+}
+
+TEST(OutputSinkTest, MappedFileMatchesStream) {
+    std::ostringstream expected;
+    {
+        StreamSink sink(expected);
+        writeRun(sink);
+    }
+
+    // one page per chunk, so many writes cross the end of a chunk
+    const std::string path = outputPath("mapped");
+    {
+        MappedFileSink sink(path, 1);
+        writeRun(sink);
+        EXPECT_EQ(expected.str().size(), sink.getBytes());
+        sink.close();
+        sink.close();
+    }
+    EXPECT_EQ(expected.str(), readFile(path));
+
+    // the default chunks are truncated to the written bytes as well
+    {
+        MappedFileSink sink(path);
+        sink.write("short");
+        // a reader sees the flushed bytes before the file is closed, followed by the rest of the chunk
+        sink.flush();
+        EXPECT_EQ("short", readFile(path).substr(0, 5));
+    }
+    EXPECT_EQ("short", readFile(path));
+    std::remove(path.c_str());
+
+    EXPECT_THROW(MappedFileSink("/tmp/sim_sink_missing_directory/out.bin"), std::runtime_error);
+}
@@ -0,0 +1,141 @@
+//============================================================================
+// Name        : PacerTest.cpp
+// Description : Test file of the real time pacer
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "../../lib/nlohmann-json/json.hpp"
+#include "../../lib/realtime/Pacer.h"
+
+namespace {
+    typedef std::chrono::milliseconds Ms;
+    typedef std::chrono::microseconds Us;
+
+    /// ticks of 1/100 s at the given speed, starting at time 0
+    Pacer startedPacer(double speed) {
+        Pacer pacer(0.01, speed, 8);
+        pacer.start(Pacer::Clock::time_point());
+        return pacer;
+    }
+}  // namespace
+
+TEST(PacerTest, SlotsFollowTheSpeed) {
+    Pacer pacer = startedPacer(10);
+    EXPECT_EQ(Us(1000), pacer.getPeriod());
+
+    // a fast tick lets the next one wait for its slot
+    const Pacer::Clock::time_point start = pacer.nextSlot();
+    pacer.tickDone(start, start + Us(100));
+    EXPECT_EQ(start + Us(1000), pacer.nextSlot());
+    pacer.tickDone(pacer.nextSlot(), pacer.nextSlot() + Us(100));
+    EXPECT_EQ(start + Us(2000), pacer.nextSlot());
+
+    EXPECT_EQ(2u, pacer.getTicks());
+    EXPECT_EQ(0u, pacer.getMissed());
+    EXPECT_EQ(1u, pacer.getOutputStride());
+}
+
+TEST(PacerTest, MissedDeadlinesThinOutTheOutput) {
+    Pacer pacer = startedPacer(1);
+
+    // ticks of 15 ms against a budget of 10 ms: every one misses, the stride doubles up to its maximum
+    Pacer::Clock::time_point now = pacer.nextSlot();
+    for (unsigned int i = 0; i < 5; ++i) {
+        pacer.tickDone(now, now + Ms(15));
+        now += Ms(15);
+    }
+    EXPECT_EQ(5u, pacer.getMissed());
+    EXPECT_EQ(8u, pacer.getOutputStride());
+
+    // only every 8th tick writes its frame
+    unsigned int outputs = 0;
+    for (unsigned int i = 0; i < 8; ++i) {
+        outputs += pacer.shouldOutput();
+        const Pacer::Clock::time_point slot = std::max(now, pacer.nextSlot());
+        pacer.tickDone(slot, slot + Ms(1));
+        now = slot + Ms(1);
+    }
+    EXPECT_EQ(1u, outputs);
+
+    // a long run of fast ticks halves the stride again
+    for (unsigned int i = 0; i < Pacer::kRecoverTicks; ++i) {
+        const Pacer::Clock::time_point slot = std::max(now, pacer.nextSlot());
+        pacer.tickDone(slot, slot + Ms(1));
+        now = slot + Ms(1);
+    }
+    EXPECT_EQ(4u, pacer.getOutputStride());
+}
+
+TEST(PacerTest, OnlyConsecutiveFastTicksRecover) {
+    Pacer pacer = startedPacer(1);
+
+    // one missed deadline doubles the stride
+    Pacer::Clock::time_point now = pacer.nextSlot();
+    pacer.tickDone(now, now + Ms(15));
+    now += Ms(15);
+    EXPECT_EQ(2u, pacer.getOutputStride());
+
+    // fast ticks (1 ms) alternating with ticks that are on time but use more than half of their slot (8 ms)
+    for (unsigned int i = 0; i < 2 * Pacer::kRecoverTicks; ++i) {
+        const Pacer::Clock::time_point slot = std::max(now, pacer.nextSlot());
+        now = slot + Ms(i % 2 == 0 ? 1 : 8);
+        pacer.tickDone(slot, now);
+    }
+    EXPECT_EQ(2u, pacer.getOutputStride());
+
+    // the first run of kRecoverTicks fast ticks in a row halves the stride
+    for (unsigned int i = 0; i < Pacer::kRecoverTicks; ++i) {
+        const Pacer::Clock::time_point slot = std::max(now, pacer.nextSlot());
+        now = slot + Ms(1);
+        pacer.tickDone(slot, now);
+    }
+    EXPECT_EQ(1u, pacer.getOutputStride());
+}
+
+TEST(PacerTest, FarBehindRestartsTheSchedule) {
+    Pacer pacer = startedPacer(1);
+
+    // a single tick of 2 s is more than kMaxLagSlots slots of 10 ms late
+    const Pacer::Clock::time_point start = pacer.nextSlot();
+    pacer.tickDone(start, start + Ms(2000));
+    EXPECT_EQ(1u, pacer.getResyncs());
+    EXPECT_EQ(start + Ms(2000), pacer.nextSlot());
+
+    // a little behind is caught up by not waiting
+    pacer.tickDone(pacer.nextSlot(), pacer.nextSlot() + Ms(100));
+    EXPECT_EQ(1u, pacer.getResyncs());
+    EXPECT_EQ(start + Ms(2010), pacer.nextSlot());
+}
+
+TEST(PacerTest, LatencyHistogram) {
+    Pacer pacer = startedPacer(1);
+
+    // 99 ticks of 3 us and one of 5 ms
+    Pacer::Clock::time_point now = pacer.nextSlot();
+    for (unsigned int i = 0; i < 100; ++i) {
+        const Pacer::Clock::duration latency = i == 99 ? Pacer::Clock::duration(Ms(5)) : Us(3);
+        pacer.tickDone(now, now + latency);
+        now = pacer.nextSlot();
+    }
+
+    EXPECT_EQ(99u, pacer.getHistogram()[2]);  // [2, 4) us
+    EXPECT_EQ(Us(4), pacer.latencyPercentile(0.5));
+    EXPECT_EQ(Us(4), pacer.latencyPercentile(0.99));
+    EXPECT_EQ(Us(8192), pacer.latencyPercentile(1));
+
+    std::ostringstream json;
+    pacer.writeJson(json);
+    const nlohmann::json parsed = nlohmann::json::parse(json.str());
+    EXPECT_EQ(100u, parsed["ticks"]);
+    EXPECT_EQ(0u, parsed["missed"]);
+    EXPECT_EQ(5000u, parsed["maxUs"]);
+    ASSERT_EQ(2u, parsed["histogramUs"].size());
+    EXPECT_EQ(8192u, parsed["histogramUs"][1]["below"]);
+}
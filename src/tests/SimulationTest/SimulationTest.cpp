@@ -13,6 +13,41 @@
 
 #include "../../Simulation.h"
 #include "../../lib/logger/Logger.h"
+#include "../../lib/utils/Parallel.h"
+#include "../../lib/utils/Utils.h"
+#include "../AllocationCounter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+/// Builds a scenario with four long roads that share the vehicles (some busses and ambulances) and each have a light
+/// and a bus stop. The vehicles can be declared in reverse order, which gives them different ids.
+static std::string makeBusyScenario(int vehicles, bool reversed, bool withCrossRoads) {
+    std::stringstream xml;
+    xml << "<ROOT>\n";
+    for (int road = 0; road < 4; ++road) {
+        xml << "<BAAN><naam>r" << road << "</naam><lengte>5000</lengte></BAAN>\n";
+        xml << "<VERKEERSLICHT><baan>r" << road << "</baan><positie>4100</positie><cyclus>" << 20 + road
+            << "</cyclus></VERKEERSLICHT>\n";
+        xml << "<BUSHALTE><baan>r" << road << "</baan><positie>4500</positie><wachttijd>5</wachttijd></BUSHALTE>\n";
+    }
+    for (int i = 0; i < vehicles; ++i) {
+        const int vehicle = reversed ? vehicles - 1 - i : i;
+        const char *type = vehicle % 10 == 0 ? "bus" : vehicle % 25 == 1 ? "ziekenwagen" : "auto";
+        xml << "<VOERTUIG><baan>r" << vehicle % 4 << "</baan><positie>" << 5 + 20 * (vehicle / 4)
+            << "</positie><type>" << type << "</type></VOERTUIG>\n";
+    }
+    if (withCrossRoads) {
+        // just in front of a vehicle so they are passed within the first seconds, leading to an empty stretch
+        xml << "<KRUISPUNT><baan positie=\"206\">r0</baan><baan positie=\"3000\">r1</baan></KRUISPUNT>\n";
+        xml << "<KRUISPUNT><baan positie=\"406\">r2</baan><baan positie=\"3500\">r3</baan></KRUISPUNT>\n";
+    }
+    xml << "</ROOT>\n";
+    return xml.str();
+}
 
 TEST(SimulationTest, HappyDay) {
     const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
@@ -465,4 +500,734 @@ TEST(SimulationTest, ExpectedOutputCompare15) {
     Logger::logAdvancedOutput(sim, outputStream);
 
     EXPECT_EQ(expectedOutput.str(), outputStream.str());
-}
\ No newline at end of file
+}
+
+TEST(SimulationTest, NoHeapAllocationsPerTick) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    const std::ifstream xmlFile(kResPath + "test10.xml");
+
+    Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+
+    // the vehicle on test0 passes the crossroad, the turn is blocked by the vehicle waiting on test1
+    const std::size_t allocationsBefore = AllocationCounter::count();
+    for (unsigned int i = 0; i < 1200; ++i) { sim.godTick(); }
+    const std::size_t allocationsAfter = AllocationCounter::count();
+
+    const std::list<id> &vehiclesOnRoad = sim.getVehiclesOnRoads().at(sim.getRoadMap().at("test0"));
+    ASSERT_EQ(1u, vehiclesOnRoad.size());
+    EXPECT_GT(sim.getWorld().at(vehiclesOnRoad.front()).second, 50.0);
+    EXPECT_EQ(allocationsBefore, allocationsAfter);
+}
+
+TEST(SimulationTest, SeedIsDeterministic) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::string outputs[2];
+    for (std::string &output : outputs) {
+        const std::ifstream xmlFile(kResPath + "test7.xml");
+        std::stringstream outputStream("");
+
+        Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+        sim.setSeed(1234);
+
+        for (unsigned int i = 0; i < 1500; ++i) {
+            sim.godTick();
+            Logger::logSimpleOutput(sim, outputStream);
+        }
+        output = outputStream.str();
+    }
+
+    EXPECT_EQ(outputs[0], outputs[1]);
+}
+
+TEST(SimulationTest, ActiveRoadsFollowVehicles) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    // test2.xml has a vehicle generator, test7.xml moves a vehicle over a crossroad and off the road
+    for (const std::string fileName : {"test2.xml", "test7.xml"}) {
+        const std::ifstream xmlFile(kResPath + fileName);
+
+        Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+        sim.setSeed(1234);
+
+        for (unsigned int i = 0; i < 1500; ++i) {
+            sim.godTick();
+
+            unsigned int activeRoads = 0;
+            for (const std::pair<const id, RoadObject> &road : sim.getRoads()) {
+                const bool occupied = !sim.getVehiclesOnRoads().at(road.first).empty();
+                ASSERT_EQ(occupied, sim.isRoadActive(road.first)) << fileName << ", tick " << i;
+                if (occupied) ++activeRoads;
+            }
+            ASSERT_EQ(activeRoads, sim.getActiveRoads().size());
+        }
+    }
+
+    // a generator that spawns every 20 s on a short road: the road is idle between the spawns and active from the
+    // tick a spawn is due
+    std::istringstream xml("<ROOT><BAAN><naam>short</naam><lengte>50</lengte></BAAN>"
+                           "<VOERTUIGGENERATOR><baan>short</baan><frequentie>20</frequentie><type>auto</type>"
+                           "</VOERTUIGGENERATOR></ROOT>");
+    Simulation sim(xml, 1.0 / 60.0, dummyStream);
+    const id roadId = sim.getRoadMap().at("short");
+    EXPECT_FALSE(sim.isRoadActive(roadId));
+
+    unsigned int idleTicks = 0;
+    unsigned int spawns = 0;
+    bool wasActive = false;
+    for (unsigned int i = 0; i < 60 * 60; ++i) {
+        sim.godTick();
+        const bool active = sim.isRoadActive(roadId);
+        EXPECT_EQ(!sim.getVehiclesOnRoads().at(roadId).empty(), active) << "tick " << i;
+        if (!active) ++idleTicks;
+        if (active && !wasActive) ++spawns;
+        wasActive = active;
+    }
+    EXPECT_GE(spawns, 2u);
+    EXPECT_GT(idleTicks, 60u * 30);
+}
+
+TEST(SimulationTest, RemovedVehiclesLeaveTheTick) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::stringstream xml(makeBusyScenario(200, false, false));
+    Simulation sim(xml, 1.0 / 60.0, dummyStream);
+    sim.godTicks(10);
+
+    // every other vehicle is removed between two ticks, the others are still updated
+    std::vector<id> vehicleIds;
+    for (const std::pair<const id, VehicleEntity> &vehicle : sim.getVehicles()) vehicleIds.push_back(vehicle.first);
+    std::sort(vehicleIds.begin(), vehicleIds.end());
+    std::map<id, double> positions;
+    for (std::size_t i = 0; i < vehicleIds.size(); ++i) {
+        if (i % 2 == 0)
+            EXPECT_TRUE(sim.removeVehicle(vehicleIds[i]));
+        else
+            positions[vehicleIds[i]] = sim.getWorld().at(vehicleIds[i]).second;
+    }
+
+    sim.godTicks(60);
+    ASSERT_EQ(positions.size(), sim.getVehicles().size());
+    for (const std::pair<const id, double> &vehicle : positions) {
+        ASSERT_EQ(1u, sim.getVehicles().count(vehicle.first));
+        EXPECT_GT(sim.getWorld().at(vehicle.first).second, vehicle.second) << "vehicle " << vehicle.first;
+    }
+}
+
+TEST(SimulationTest, ResultsIndependentOfThreadCount) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    // enough vehicles to really split the updates over the threads
+    const std::string scenario = makeBusyScenario(Utils::kMinParallelChunk * 2 + 8, false, true);
+
+    std::string reference;
+    for (const unsigned int threads : {1u, 2u, 3u, 8u}) {
+        std::stringstream xml(scenario);
+        std::stringstream outputStream("");
+
+        Simulation sim(xml, 1.0 / 60.0, dummyStream);
+        sim.setSeed(42);
+        sim.setThreadCount(threads);
+
+        for (unsigned int i = 0; i < 150; ++i) {
+            sim.godTick();
+            if (i % 50 == 0) Logger::logSimpleOutput(sim, outputStream);
+        }
+
+        if (threads == 1)
+            reference = outputStream.str();
+        else
+            EXPECT_EQ(reference, outputStream.str()) << threads << " threads";
+    }
+}
+
+TEST(SimulationTest, WorkerPoolRunsEveryIterationOnce) {
+    // more iterations than chunks of the minimal size, so the last chunk is shorter
+    const std::size_t count = Utils::kMinParallelChunk * 3 + 5;
+    std::vector<unsigned int> visits(count, 0);
+    const auto visit = [&visits](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) ++visits[i];
+    };
+
+    Utils::WorkerPool pool(3);
+    EXPECT_EQ(3u, pool.getThreadCount());
+
+    // the workers are started once, handing out a loop does not touch the heap
+    const std::size_t allocationsBefore = AllocationCounter::count();
+    for (unsigned int i = 0; i < 100; ++i) pool.parallelFor(count, visit);
+    pool.parallelFor(10, visit);
+    const std::size_t allocationsAfter = AllocationCounter::count();
+    EXPECT_EQ(allocationsBefore, allocationsAfter);
+
+    for (std::size_t i = 0; i < 10; ++i) EXPECT_EQ(101u, visits[i]);
+    for (std::size_t i = 10; i < count; ++i) EXPECT_EQ(100u, visits[i]);
+
+    // resized, the new workers split the loop the same way
+    for (const unsigned int threads : {1u, 5u, 2u}) {
+        pool.resize(threads);
+        EXPECT_EQ(threads, pool.getThreadCount());
+        std::fill(visits.begin(), visits.end(), 0);
+        pool.parallelFor(count, visit);
+        EXPECT_EQ(count, std::size_t(std::count(visits.begin(), visits.end(), 1u))) << threads << " threads";
+    }
+}
+
+TEST(SimulationTest, ResultsIndependentOfVehicleOrder) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    // road, position and velocity of every vehicle, sorted so the ids do not matter
+    std::vector<std::tuple<id, double, double>> states[2];
+    for (const bool reversed : {false, true}) {
+        std::stringstream xml(makeBusyScenario(200, reversed, false));
+
+        Simulation sim(xml, 1.0 / 60.0, dummyStream);
+
+        for (unsigned int i = 0; i < 300; ++i) { sim.godTick(); }
+
+        std::vector<std::tuple<id, double, double>> &state = states[reversed];
+        for (const std::pair<const id, VehicleEntity> &vehicle : sim.getVehicles()) {
+            const std::pair<id, double> &location = sim.getWorld().at(vehicle.first);
+            state.emplace_back(location.first, location.second, vehicle.second.getVelocity());
+        }
+        std::sort(state.begin(), state.end());
+    }
+
+    ASSERT_EQ(200u, states[0].size());
+    EXPECT_TRUE(states[0] == states[1]);
+}
+
+TEST(SimulationTest, SleepingVehiclesMatchFullUpdates) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::string outputs[2];
+    unsigned int mostAsleep = 0;
+    unsigned int asleepAtEnd = 0;
+    for (const bool sleeping : {false, true}) {
+        const std::ifstream xmlFile(kResPath + "test11.xml");
+        std::stringstream outputStream("");
+
+        Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+        sim.setSleeping(sleeping);
+
+        // the queue builds up in front of the red light, which turns green after 40 seconds
+        for (unsigned int i = 0; i < 4000; ++i) {
+            sim.godTick();
+            if (i % 10 == 0) Logger::logSimpleOutput(sim, outputStream);
+            if (sleeping)
+                mostAsleep = std::max(mostAsleep, sim.getSleepingVehicles());
+            else
+                EXPECT_EQ(0u, sim.getSleepingVehicles());
+        }
+        outputs[sleeping] = outputStream.str();
+        if (sleeping) asleepAtEnd = sim.getSleepingVehicles();
+    }
+
+    EXPECT_EQ(outputs[0], outputs[1]);
+    EXPECT_GE(mostAsleep, 5u);
+    EXPECT_LT(asleepAtEnd, mostAsleep);
+}
+
+TEST(SimulationTest, FreeFlowMatchesFullUpdates) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::string outputs[2];
+    unsigned int mostFree = 0;
+    for (const bool freeFlow : {false, true}) {
+        const std::ifstream xmlFile(kResPath + "test12.xml");
+        std::stringstream outputStream("");
+
+        Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+        sim.setSeed(1);
+        sim.setFreeFlow(freeFlow);
+
+        // the generated vehicles are spaced far apart, most of them only ever see the light in front of them
+        for (unsigned int i = 0; i < 6000; ++i) {
+            sim.godTick();
+            if (i % 10 == 0) Logger::logSimpleOutput(sim, outputStream);
+            if (freeFlow)
+                mostFree = std::max(mostFree, sim.getFreeFlowingVehicles());
+            else
+                EXPECT_EQ(0u, sim.getFreeFlowingVehicles());
+        }
+        outputs[freeFlow] = outputStream.str();
+    }
+
+    EXPECT_EQ(outputs[0], outputs[1]);
+    EXPECT_GE(mostFree, 2u);
+}
+
+TEST(SimulationTest, CoastingMatchesPerTickSteps) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    // without free flow every vehicle is stepped every tick
+    const std::ifstream stepXml(kResPath + "test15.xml");
+    Simulation stepped((std::istream &) stepXml, 1.0 / 60.0, dummyStream);
+    stepped.setSeed(1);
+    stepped.setFreeFlow(false);
+
+    const std::ifstream coastXml(kResPath + "test15.xml");
+    Simulation coasting((std::istream &) coastXml, 1.0 / 60.0, dummyStream);
+    coasting.setSeed(1);
+
+    // a vehicle on a free road is steady after about 90 seconds, from then on the vehicles alone on their road coast
+    // up to the crossroad, the light and the end of the road, until a vehicle enters their road. Their positions are
+    // only computed when they are read (here at a different tick every time).
+    unsigned int mostCoasting = 0;
+    unsigned long coastedTicks = 0;
+    for (unsigned int i = 0; i < 40000; ++i) {
+        stepped.godTick();
+        coasting.godTick();
+        mostCoasting = std::max(mostCoasting, coasting.getCoastingVehicles());
+        coastedTicks += coasting.getCoastingVehicles();
+
+        // the car that turned onto the exit coasts there, a car entering the exit behind it wakes it
+        if (i == 20000) {
+            EXPECT_EQ(1u, coasting.getCoastingVehicles());
+            for (Simulation *sim : {&stepped, &coasting}) {
+                const id exit = sim->getRoadMap().at("exit");
+                EXPECT_TRUE(sim->injectVehicle(exit, 10, EVehicleEntityTypes::kCar).has_value());
+            }
+        }
+        if (i % 37 != 0) continue;
+
+        ASSERT_EQ(stepped.getVehicles().size(), coasting.getVehicles().size()) << "tick " << i;
+        for (const std::pair<const id, VehicleEntity> &vehicle : stepped.getVehicles()) {
+            ASSERT_EQ(stepped.getWorld().at(vehicle.first), coasting.getWorld().at(vehicle.first)) << "tick " << i;
+            EXPECT_EQ(vehicle.second.getVelocity(), coasting.getVehicles().at(vehicle.first).getVelocity());
+        }
+        for (const std::pair<const id, RoadObject> &road : stepped.getRoads()) {
+            const RoadView steppedView = stepped.getRoadView(road.first);
+            const RoadView coastingView = coasting.getRoadView(road.first);
+            ASSERT_EQ(steppedView.size(), coastingView.size());
+            for (std::size_t v = 0; v < steppedView.size(); ++v) {
+                EXPECT_EQ(steppedView.getVehicleIds()[v], coastingView.getVehicleIds()[v]);
+                EXPECT_EQ(steppedView.getPositions()[v], coastingView.getPositions()[v]);
+            }
+        }
+    }
+    EXPECT_EQ(2u, mostCoasting);
+    EXPECT_GT(coastedTicks, 20000u);
+    EXPECT_EQ(0u, stepped.getCoastingVehicles());
+}
+
+TEST(SimulationTest, RepeatedAdditionMatchesLoop) {
+    // steps of vehicles, a step that rounds half way at every spacing, and starts that cross powers of two
+    const double starts[] = {0, 1e-3, 0.75, 1, 20, 511.9, 1023.99, 4096};
+    const double steps[] = {1.0 / 3, 0.2958333333333333, 1.5 * std::ldexp(1.0, -52), 0.1, 7e-17, 33.3};
+    for (const double start : starts) {
+        for (const double step : steps) {
+            double value = start;
+            for (unsigned long count = 0; count <= 3000; ++count) {
+                ASSERT_EQ(value, Utils::addRepeatedly(start, step, count)) << start << " + " << count << " * " << step;
+                value += step;
+            }
+        }
+    }
+}
+
+TEST(SimulationTest, AdaptiveSteppingWithinTolerance) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    const double kFineStep = 1.0 / 60.0;
+    const unsigned int kSubsteps = 8;
+    const unsigned int kTicks = 1200;
+
+    // ticks the platoon for 20 seconds, returns the positions by vehicle id and counts the vehicle updates
+    const auto run = [&](double stepSize, unsigned int substeps, double tolerance, unsigned int &updates,
+                         unsigned int &leastSubsteps) {
+        const std::ifstream xmlFile(kResPath + "test13.xml");
+        Simulation sim((std::istream &) xmlFile, stepSize, dummyStream);
+        if (substeps > 1) sim.setAdaptiveStepping(substeps, tolerance);
+
+        updates = 0;
+        leastSubsteps = substeps;
+        const id roadId = sim.getRoadMap().at("long");
+        for (unsigned int i = 0; i < (unsigned int) std::lround(kTicks * kFineStep / stepSize); ++i) {
+            sim.godTick();
+            updates += sim.getSubsteps(roadId) * sim.getVehicles().size();
+            leastSubsteps = std::min(leastSubsteps, sim.getSubsteps(roadId));
+        }
+
+        std::map<id, double> positions;
+        for (const std::pair<const id, VehicleEntity> &vehicle : sim.getVehicles()) {
+            positions[vehicle.first] = sim.getWorld().at(vehicle.first).second;
+        }
+        return positions;
+    };
+
+    const auto largestError = [](const std::map<id, double> &reference, const std::map<id, double> &positions) {
+        double error = 0;
+        for (const std::pair<const id, double> &vehicle : reference) {
+            error = std::max(error, std::abs(positions.at(vehicle.first) - vehicle.second));
+        }
+        return error;
+    };
+
+    unsigned int referenceUpdates, coarseUpdates, adaptiveUpdates, exactUpdates, leastSubsteps, unused;
+    const std::map<id, double> reference = run(kFineStep, 1, 0, referenceUpdates, unused);
+    const std::map<id, double> coarse = run(kFineStep * kSubsteps, 1, 0, coarseUpdates, unused);
+    const std::map<id, double> adaptive = run(kFineStep * kSubsteps, kSubsteps, 1e-3, adaptiveUpdates, leastSubsteps);
+    const std::map<id, double> exact = run(kFineStep * kSubsteps, kSubsteps, 1e-6, exactUpdates, unused);
+
+    ASSERT_EQ(reference.size(), adaptive.size());
+    ASSERT_EQ(reference.size(), coarse.size());
+
+    // the coarse step alone is meters off, the adaptive steps stay within a few centimeters
+    EXPECT_GT(largestError(reference, coarse), 1.0);
+    EXPECT_LT(largestError(reference, adaptive), 0.1);
+    EXPECT_LT(adaptiveUpdates, referenceUpdates);
+    EXPECT_LT(leastSubsteps, kSubsteps);
+
+    // with a tight tolerance every update uses the fine step
+    EXPECT_EQ(referenceUpdates, exactUpdates);
+    EXPECT_NEAR(0, largestError(reference, exact), 1e-9);
+}
+
+TEST(SimulationTest, MesoRoadsExchangeVehicles) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    const std::ifstream xmlFile(kResPath + "test14.xml");
+    Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+    sim.setSeed(1);
+
+    const id ringId = sim.getRoadMap().at("ring");
+    const id coreId = sim.getRoadMap().at("core");
+    const id exitId = sim.getRoadMap().at("exit");
+
+    EXPECT_EQ(ERoadLevel::kMeso, sim.getRoads().at(ringId).getLevel());
+    EXPECT_EQ(ERoadLevel::kMicro, sim.getRoads().at(coreId).getLevel());
+    ASSERT_EQ(2u, sim.getMesoLinks().size());
+
+    // the bus on the ring only lives in the queue of its link
+    EXPECT_EQ(1u, sim.getVehicles().size());
+    EXPECT_EQ(1u, sim.getMesoLinks().at(ringId).getVehicleCount());
+
+    unsigned int mostOnCore = 0;
+    unsigned int mostOnExit = 0;
+    for (unsigned int i = 0; i < 12000; ++i) {
+        sim.godTick();
+
+        // only the core is simulated per vehicle
+        for (const std::pair<const id, std::pair<id, double>> &location : sim.getWorld()) {
+            if (sim.getVehicles().find(location.first) != sim.getVehicles().end()) {
+                ASSERT_EQ(coreId, location.second.first);
+            }
+        }
+        EXPECT_LE(sim.getMesoLinks().at(ringId).getVehicleCount(), sim.getMesoLinks().at(ringId).getStorage());
+
+        mostOnCore = std::max(mostOnCore, (unsigned int) sim.getVehiclesOnRoads().at(coreId).size());
+        mostOnExit = std::max(mostOnExit, sim.getMesoLinks().at(exitId).getVehicleCount());
+    }
+
+    EXPECT_GT(mostOnCore, 1u);
+    EXPECT_GT(mostOnExit, 0u);
+}
+
+TEST(SimulationTest, StaticFeaturesSortedByPosition) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    for (const char *scenario : {"test5.xml", "test9.xml", "test12.xml"}) {
+        const std::ifstream xmlFile(kResPath + scenario);
+        const Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+
+        unsigned int lights = 0;
+        unsigned int busStops = 0;
+        for (const std::pair<const id, RoadObject> &road : sim.getRoads()) {
+            const RoadFeatures &features = sim.getRoadFeatures(road.first);
+
+            for (std::size_t i = 0; i < features.lights.size(); ++i) {
+                const StaticFeature<LightEntity> &light = features.lights[i];
+                if (i > 0) { EXPECT_LE(features.lights[i - 1].position, light.position); }
+                EXPECT_EQ(&sim.getLights().at(light.featureId), light.entity);
+                EXPECT_EQ(std::make_pair(road.first, light.position), sim.getWorld().at(light.featureId));
+                ++lights;
+            }
+            for (std::size_t i = 0; i < features.busStops.size(); ++i) {
+                const StaticFeature<BusStopEntity> &busStop = features.busStops[i];
+                if (i > 0) { EXPECT_LE(features.busStops[i - 1].position, busStop.position); }
+                EXPECT_EQ(&sim.getBusstops().at(busStop.featureId), busStop.entity);
+                EXPECT_EQ(std::make_pair(road.first, busStop.position), sim.getWorld().at(busStop.featureId));
+                ++busStops;
+            }
+            for (std::size_t i = 1; i < features.crossRoads.size(); ++i) {
+                EXPECT_LE(features.crossRoads[i - 1].position, features.crossRoads[i].position);
+            }
+        }
+
+        // every static object is in exactly one feature list, and is still found in the world
+        EXPECT_EQ(sim.getLights().size(), lights);
+        EXPECT_EQ(sim.getBusstops().size(), busStops);
+        for (const std::pair<const id, LightEntity> &light : sim.getLights()) {
+            EXPECT_NE(sim.getWorld().end(), sim.getWorld().find(light.first));
+        }
+    }
+}
+
+TEST(SimulationTest, ProfilerCountsPhases) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    const std::ifstream xmlFile(kResPath + "test2.xml");
+    Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+    // built with SIM_NO_PROFILING there is nothing to check
+    if (!Profiler::enabled()) return;
+
+    // the vehicles of the scenario are no spawns
+    const Profiler &profiler = sim.getProfiler();
+    EXPECT_EQ(0u, profiler.getSpawns());
+    EXPECT_EQ(0u, profiler.get(EPhase::kGather).calls);
+
+    const std::size_t initialVehicles = sim.getVehicles().size();
+    std::ostringstream frames;
+    unsigned long long vehicleUpdates = 0;
+    const unsigned int ticks = 3000;
+    for (unsigned int i = 0; i < ticks; ++i) {
+        vehicleUpdates += sim.getVehicles().size();
+        sim.godTick();
+        vehicleUpdates -= sim.getCoastingVehicles();
+    }
+    Logger::logSimpleOutput(sim, frames);
+
+    // every phase of a tick ran once per tick and saw every vehicle that did not coast
+    for (const EPhase phase : {EPhase::kGather, EPhase::kUpdate, EPhase::kCommit, EPhase::kCrossRoads,
+                               EPhase::kMesoLinks, EPhase::kLights, EPhase::kGenerators}) {
+        EXPECT_EQ(ticks, profiler.get(phase).calls) << Profiler::phaseName(phase);
+    }
+    EXPECT_EQ(vehicleUpdates, profiler.get(EPhase::kGather).items);
+    EXPECT_EQ(1u, profiler.get(EPhase::kLogSimple).calls);
+    EXPECT_EQ(0u, profiler.get(EPhase::kLogJson).calls);
+
+    // the generator keeps spawning, vehicles that reached the end of their road are despawned
+    EXPECT_GT(profiler.getSpawns(), 0u);
+    EXPECT_GT(profiler.getDespawns(), 0u);
+    EXPECT_EQ(initialVehicles + profiler.getSpawns() - profiler.getDespawns(), sim.getVehicles().size());
+
+    std::ostringstream json;
+    profiler.writeJson(json);
+    const nlohmann::json parsed = nlohmann::json::parse(json.str());
+    EXPECT_EQ(ticks, parsed["phases"]["gather"]["calls"]);
+    EXPECT_EQ(profiler.getSpawns(), parsed["spawns"]);
+}
+
+TEST(SimulationTest, InjectedVehiclesAreSimulated) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    // ticking in one call is ticking one by one
+    std::ifstream xmlFile(kResPath + "test12.xml");
+    Simulation sim(xmlFile, 1.0 / 60.0, dummyStream);
+    xmlFile.close();
+    xmlFile.open(kResPath + "test12.xml");
+    Simulation reference(xmlFile, 1.0 / 60.0, dummyStream);
+    sim.setSeed(3);
+    reference.setSeed(3);
+    sim.godTicks(300);
+    for (unsigned int i = 0; i < 300; ++i) reference.godTick();
+    EXPECT_EQ(300u, sim.getIteration());
+    std::ostringstream output;
+    std::ostringstream referenceOutput;
+    Logger::logSimpleOutput(sim, output);
+    Logger::logSimpleOutput(reference, referenceOutput);
+    EXPECT_EQ(referenceOutput.str(), output.str());
+
+    const id rural = sim.getRoadMap().at("rural");
+    const std::size_t vehiclesBefore = sim.getRoadView(rural).size();
+    const std::optional<id> injected = sim.injectVehicle(rural, 2500, EVehicleEntityTypes::kBus);
+    ASSERT_TRUE(injected.has_value());
+    ASSERT_EQ(vehiclesBefore + 1, sim.getRoadView(rural).size());
+    // occupied or beyond the end of the road
+    EXPECT_FALSE(sim.injectVehicle(rural, 2495, EVehicleEntityTypes::kCar).has_value());
+    EXPECT_FALSE(sim.injectVehicle(rural, 3001, EVehicleEntityTypes::kCar).has_value());
+    EXPECT_EQ(vehiclesBefore + 1, sim.getRoadView(rural).size());
+
+    const auto findInjected = [&]() {
+        for (const RoadVehicle vehicle : sim.getRoadView(rural)) {
+            if (vehicle.vehicleId == *injected) return vehicle;
+        }
+        return RoadVehicle{0, -1, -1, EVehicleEntityTypes::kCar};
+    };
+    RoadVehicle vehicle = findInjected();
+    EXPECT_EQ(2500, vehicle.position);
+    EXPECT_EQ(0, vehicle.velocity);
+    EXPECT_EQ(EVehicleEntityTypes::kBus, vehicle.type);
+
+    // it drives off like every other vehicle
+    sim.godTicks(120);
+    vehicle = findInjected();
+    EXPECT_GT(vehicle.position, 2500);
+    EXPECT_GT(vehicle.velocity, 0);
+
+    EXPECT_TRUE(sim.removeVehicle(*injected));
+    EXPECT_FALSE(sim.removeVehicle(*injected));
+    EXPECT_EQ(0u, sim.getVehicles().count(*injected));
+    EXPECT_EQ(-1, findInjected().position);
+    sim.godTicks(60);
+
+    // a mesoscopic road has no vehicles of its own
+    xmlFile.close();
+    xmlFile.open(kResPath + "test14.xml");
+    Simulation meso(xmlFile, 1.0 / 60.0, dummyStream);
+    EXPECT_FALSE(meso.injectVehicle(meso.getRoadMap().at("ring"), 10, EVehicleEntityTypes::kCar).has_value());
+}
+
+TEST(SimulationTest, RoadViewsMatchDatabases) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::stringstream xml(makeBusyScenario(200, false, false));
+    Simulation sim(xml, 1.0 / 60.0, dummyStream);
+
+    // every vehicle and light of the databases is in the view of its road, in the spans of its attributes
+    const auto checkViews = [](const Simulation &sim) {
+        std::size_t vehicles = 0;
+        std::size_t lights = 0;
+        for (const std::pair<const id, RoadObject> &road : sim.getRoads()) {
+            const RoadView view = sim.getRoadView(road.first);
+            const Span<id> vehicleIds = view.getVehicleIds();
+            const Span<double> positions = view.getPositions();
+            ASSERT_EQ(sim.getVehiclesOnRoads().at(road.first).size(), view.size());
+            ASSERT_EQ(view.size(), positions.size());
+            ASSERT_EQ(view.size(), view.getVelocities().size());
+            ASSERT_EQ(view.size(), view.getTypes().size());
+            EXPECT_TRUE(std::is_sorted(positions.begin(), positions.end()));
+            for (std::size_t i = 0; i < view.size(); ++i) {
+                const VehicleEntity &vehicle = sim.getVehicles().at(vehicleIds[i]);
+                EXPECT_EQ(road.first, sim.getWorld().at(vehicleIds[i]).first);
+                EXPECT_EQ(sim.getWorld().at(vehicleIds[i]).second, positions[i]);
+                EXPECT_EQ(vehicle.getVelocity(), view.getVelocities()[i]);
+                EXPECT_EQ(vehicle.getType(), view.getTypes()[i]);
+            }
+            vehicles += view.size();
+
+            const RoadFeatures &features = sim.getRoadFeatures(road.first);
+            ASSERT_EQ(features.lights.size(), view.getLightIds().size());
+            for (std::size_t i = 0; i < features.lights.size(); ++i) {
+                EXPECT_EQ(features.lights[i].featureId, view.getLightIds()[i]);
+                EXPECT_EQ(features.lights[i].position, view.getLightPositions()[i]);
+                EXPECT_EQ(features.lights[i].entity->isGreen(), view.getLightsGreen()[i] == 1);
+            }
+            lights += view.getLightIds().size();
+        }
+        EXPECT_EQ(sim.getVehicles().size(), vehicles);
+        EXPECT_EQ(sim.getLights().size(), lights);
+    };
+
+    checkViews(sim);
+    const id road = sim.getRoadMap().at("r0");
+    const bool wasGreen = sim.getRoadView(road).getLightsGreen()[0] == 1;
+    bool toggled = false;
+    for (unsigned int i = 0; i < 1500; ++i) {
+        sim.godTick();
+        toggled = toggled || (sim.getRoadView(road).getLightsGreen()[0] == 1) != wasGreen;
+    }
+    checkViews(sim);
+    EXPECT_TRUE(toggled);
+
+    // the views of a tick share one snapshot, iterating a view visits the same vehicles as the spans
+    EXPECT_EQ(sim.getRoadView(road).getPositions().data(), sim.getRoadView(road).getPositions().data());
+    std::size_t index = 0;
+    const RoadView view = sim.getRoadView(road);
+    for (const RoadVehicle vehicle : view) {
+        EXPECT_EQ(view.getVehicleIds()[index], vehicle.vehicleId);
+        EXPECT_EQ(view.getPositions()[index], vehicle.position);
+        ++index;
+    }
+    EXPECT_EQ(view.size(), index);
+
+    // the snapshot keeps its storage, so the views of the next ticks do not allocate
+    const std::size_t allocationsBefore = AllocationCounter::count();
+    for (unsigned int i = 0; i < 100; ++i) {
+        sim.godTick();
+        for (const std::pair<const id, RoadObject> &other : sim.getRoads()) sim.getRoadView(other.first);
+    }
+    const std::size_t allocationsAfter = AllocationCounter::count();
+    EXPECT_EQ(allocationsBefore, allocationsAfter);
+
+    // a removed vehicle leaves the view before the next tick
+    const id removed = sim.getRoadView(road).getVehicleIds()[0];
+    ASSERT_TRUE(sim.removeVehicle(removed));
+    const Span<id> vehicleIds = sim.getRoadView(road).getVehicleIds();
+    EXPECT_EQ(vehicleIds.end(), std::find(vehicleIds.begin(), vehicleIds.end(), removed));
+    checkViews(sim);
+
+    // the ticks keep the views up to date while vehicles are spawned, cross to other roads and leave the roads
+    const std::string kResPath =
+      std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + "/res/";
+    std::stringstream crossingXml(makeBusyScenario(200, false, true));
+    Simulation crossing(crossingXml, 1.0 / 60.0, dummyStream);
+    const std::ifstream generatorXml(kResPath + "test2.xml");
+    Simulation generating((std::istream &) generatorXml, 1.0 / 60.0, dummyStream);
+    for (Simulation *changing : {&crossing, &generating}) {
+        changing->setSeed(1234);
+        checkViews(*changing);
+        for (unsigned int i = 0; i < 60; ++i) {
+            changing->godTicks(25);
+            checkViews(*changing);
+        }
+    }
+}
+
+TEST(SimulationTest, FramesUseTheStepSize) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::ifstream xmlFile(kResPath + "test12.xml");
+    Simulation sim(xmlFile, 0.1, dummyStream);
+    sim.godTicks(25);
+
+    std::ostringstream json;
+    Logger::logAsJson(sim, json);
+    EXPECT_DOUBLE_EQ(2.5, nlohmann::json::parse(json.str())["time"].get<double>());
+
+    std::ostringstream simple;
+    Logger::logSimpleOutput(sim, simple);
+    EXPECT_EQ(0u, simple.str().find("Time: 2.5s\n"));
+}
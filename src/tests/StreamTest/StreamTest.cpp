@@ -0,0 +1,359 @@
+//============================================================================
+// Name        : StreamTest.cpp
+// Description : Test file of the frame stream server, its delta encoding and the reference client
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "../../Simulation.h"
+#include "../../lib/logger/LogPolicy.h"
+#include "../../lib/logger/Logger.h"
+#include "../../lib/nlohmann-json/json.hpp"
+#include "../../lib/stream/DeltaDecoder.h"
+#include "../../lib/stream/DeltaEncoder.h"
+#include "../../lib/stream/RecordingReader.h"
+#include "../../lib/stream/RecordingWriter.h"
+#include "../../lib/stream/StreamClient.h"
+#include "../../lib/stream/StreamServer.h"
+
+namespace {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "../SimulationTest/res/";
+
+    /// a Unix domain socket of this test run, short enough for sun_path
+    std::string socketAddress(const std::string &name) {
+        return "unix:/tmp/sim_stream_" + std::to_string(::getpid()) + '_' + name + ".sock";
+    }
+
+    /// a recording file of this test run
+    std::string recordingPath(const std::string &name) {
+        return "/tmp/sim_recording_" + std::to_string(::getpid()) + '_' + name + ".jsonl";
+    }
+
+    /// a json frame with the car positions in units of the delta encoder and the cars of every road sorted, so frames
+    /// can be compared
+    nlohmann::json sortedFrame(nlohmann::json frame) {
+        for (nlohmann::json &road : frame["roads"]) {
+            for (nlohmann::json &car : road["cars"]) {
+                car["x"] = std::llround(car["x"].get<double>() / DeltaEncoder::kDefaultResolution);
+            }
+            std::sort(road["cars"].begin(), road["cars"].end(), [](const nlohmann::json &a, const nlohmann::json &b) {
+                return std::make_pair(a["x"].get<long long>(), a["type"].get<std::string>()) <
+                       std::make_pair(b["x"].get<long long>(), b["type"].get<std::string>());
+            });
+        }
+        return frame;
+    }
+
+    nlohmann::json loggedFrame(const Simulation &sim) {
+        std::ostringstream frame;
+        Logger::logAsJson(sim, frame);
+        return sortedFrame(nlohmann::json::parse(frame.str()));
+    }
+
+    /// four long roads with lights and bus stops, full of vehicles, so every delta is large
+    std::string makeCrowdedScenario(int vehicles) {
+        std::stringstream xml;
+        xml << "<ROOT>\n";
+        for (int road = 0; road < 4; ++road) {
+            xml << "<BAAN><naam>r" << road << "</naam><lengte>5000</lengte></BAAN>\n";
+            xml << "<VERKEERSLICHT><baan>r" << road << "</baan><positie>4100</positie><cyclus>" << 2 + road
+                << "</cyclus></VERKEERSLICHT>\n";
+            xml << "<BUSHALTE><baan>r" << road << "</baan><positie>4500</positie><wachttijd>5</wachttijd></BUSHALTE>\n";
+        }
+        for (int vehicle = 0; vehicle < vehicles; ++vehicle) {
+            xml << "<VOERTUIG><baan>r" << vehicle % 4 << "</baan><positie>" << 5 + 20 * (vehicle / 4)
+                << "</positie><type>" << (vehicle % 10 == 0 ? "bus" : "auto") << "</type></VOERTUIG>\n";
+        }
+        xml << "</ROOT>\n";
+        return xml.str();
+    }
+}  // namespace
+
+TEST(StreamTest, DecodedDeltasMatchJsonFrames) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    // vehicles that spawn, cross, turn and leave (test7, test10) and lights that toggle (test8, test10)
+    for (const char *scenario : {"test7.xml", "test8.xml", "test10.xml"}) {
+        std::ifstream xmlFile(kResPath + scenario);
+        Simulation sim(xmlFile, 1.0 / 60.0, dummyStream);
+        sim.setSeed(3);
+
+        DeltaEncoder encoder(sim);
+        DeltaDecoder decoder;
+        EXPECT_FALSE(decoder.apply(encoder.topology()));
+        EXPECT_FALSE(decoder.hasFrame());
+
+        // a reader that only has deltas is not in sync
+        const std::string first = encoder.delta(sim);
+        EXPECT_THROW(decoder.apply(first), std::runtime_error);
+        EXPECT_TRUE(decoder.apply(encoder.keyframe()));
+
+        for (unsigned int i = 0; i < 1500; ++i) {
+            sim.godTick();
+            ASSERT_TRUE(decoder.apply(encoder.delta(sim)));
+            if (i % 100 != 0) continue;
+            EXPECT_EQ(loggedFrame(sim), sortedFrame(decoder.frame())) << scenario << " tick " << i;
+            EXPECT_EQ(sim.getIteration(), decoder.getTick());
+        }
+        EXPECT_EQ(loggedFrame(sim), sortedFrame(decoder.frame())) << scenario;
+    }
+}
+
+TEST(StreamTest, DeltaFramesExpandToJsonFrames) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::ifstream xmlFile(kResPath + "test8.xml");
+    Simulation sim(xmlFile, 1.0 / 60.0, dummyStream);
+
+    // every 7th frame, a delta spans the ticks since the previous written frame, every 40th frame is a keyframe
+    RecordingWriter recording(sim, DeltaEncoder::kDefaultResolution, 40);
+    LogPolicy deltaPolicy;
+    LogPolicy jsonPolicy;
+    deltaPolicy.everyTicks(7);
+    jsonPolicy.everyTicks(7);
+
+    std::ostringstream deltaOutput;
+    std::ostringstream jsonOutput;
+    for (unsigned int i = 0; i < 2000; ++i) {
+        Logger::logAsDelta(sim, deltaOutput, recording, deltaPolicy);
+        Logger::logAsJson(sim, jsonOutput, jsonPolicy);
+        sim.godTick();
+    }
+    recording.finish(deltaOutput);
+    EXPECT_EQ(8u, recording.getKeyframes());
+
+    // the first line is the topology, the second one a keyframe, the index at the end is no frame
+    std::istringstream deltaLines(deltaOutput.str());
+    std::istringstream jsonLines(jsonOutput.str());
+    DeltaDecoder decoder;
+    std::string deltaLine;
+    std::string jsonLine;
+    unsigned int frames = 0;
+    while (std::getline(deltaLines, deltaLine)) {
+        if (!decoder.apply(deltaLine)) continue;
+        ASSERT_TRUE(static_cast<bool>(std::getline(jsonLines, jsonLine)));
+        EXPECT_EQ(sortedFrame(nlohmann::json::parse(jsonLine)), sortedFrame(decoder.frame())) << "frame " << frames;
+        ++frames;
+    }
+    EXPECT_EQ(286u, frames);
+    EXPECT_FALSE(static_cast<bool>(std::getline(jsonLines, jsonLine)));
+
+    // only what changed is written
+    EXPECT_LT(deltaOutput.str().size() * 3, jsonOutput.str().size());
+}
+
+TEST(StreamTest, DecodedFramesUseTheStepSize) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::ifstream xmlFile(kResPath + "test8.xml");
+    Simulation sim(xmlFile, 0.1, dummyStream);
+
+    DeltaEncoder encoder(sim);
+    DeltaDecoder decoder;
+    EXPECT_EQ(0.1, nlohmann::json::parse(encoder.topology())["stepSize"].get<double>());
+    decoder.apply(encoder.topology());
+    encoder.delta(sim);
+    decoder.apply(encoder.keyframe());
+    for (unsigned int i = 0; i < 300; ++i) {
+        sim.godTick();
+        decoder.apply(encoder.delta(sim));
+    }
+    EXPECT_EQ(loggedFrame(sim), sortedFrame(decoder.frame()));
+    EXPECT_DOUBLE_EQ(30, decoder.frame()["time"].get<double>());
+}
+
+TEST(StreamTest, RecordingSeeksToAnyTick) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::ifstream xmlFile(kResPath + "test10.xml");
+    Simulation sim(xmlFile, 1.0 / 60.0, dummyStream);
+    sim.setSeed(5);
+
+    // a frame every 3 ticks, a keyframe every 25 frames
+    const std::string path = recordingPath("seek");
+    std::map<unsigned int, nlohmann::json> frames;
+    {
+        std::ofstream file(path, std::ios::binary);
+        RecordingWriter recording(sim, DeltaEncoder::kDefaultResolution, 25);
+        LogPolicy policy;
+        policy.everyTicks(3);
+        for (unsigned int i = 0; i < 3000; ++i) {
+            if (Logger::logAsDelta(sim, file, recording, policy)) frames[sim.getIteration()] = loggedFrame(sim);
+            sim.godTick();
+        }
+        recording.finish(file);
+    }
+
+    RecordingReader reader(path);
+    EXPECT_EQ(40u, reader.getKeyframes());
+    EXPECT_EQ(0u, reader.getFirstTick());
+
+    // out of order, on keyframes, between keyframes and between frames
+    for (const unsigned int tick : {2500u, 0u, 75u, 74u, 1202u, 2999u, 1u, 225u, 226u, 1800u}) {
+        ASSERT_TRUE(reader.seek(tick));
+        const std::map<unsigned int, nlohmann::json>::const_iterator expected = --frames.upper_bound(tick);
+        EXPECT_EQ(expected->first, reader.getDecoder().getTick()) << "tick " << tick;
+        EXPECT_EQ(expected->second, sortedFrame(reader.getDecoder().frame())) << "tick " << tick;
+    }
+
+    // the frames after a seek follow each other
+    ASSERT_TRUE(reader.seek(1000));
+    for (std::map<unsigned int, nlohmann::json>::const_iterator it = frames.upper_bound(1000); it != frames.end();
+         ++it) {
+        ASSERT_TRUE(reader.next());
+        EXPECT_EQ(it->first, reader.getDecoder().getTick());
+        EXPECT_EQ(it->second, sortedFrame(reader.getDecoder().frame()));
+    }
+    EXPECT_FALSE(reader.next());
+    std::remove(path.c_str());
+}
+
+TEST(StreamTest, UnfinishedRecordingsAreRejected) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::ifstream xmlFile(kResPath + "test10.xml");
+    Simulation sim(xmlFile, 1.0 / 60.0, dummyStream);
+
+    // a run that stopped before the index was written
+    const std::string path = recordingPath("unfinished");
+    {
+        std::ofstream file(path, std::ios::binary);
+        RecordingWriter recording(sim);
+        for (unsigned int i = 0; i < 100; ++i) {
+            Logger::logAsDelta(sim, file, recording);
+            sim.godTick();
+        }
+    }
+    EXPECT_THROW(RecordingReader reader(path), std::runtime_error);
+    EXPECT_THROW(RecordingReader reader(recordingPath("missing")), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(StreamTest, ClientGetsKeyframeThenDeltas) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::ifstream xmlFile(kResPath + "test10.xml");
+    Simulation sim(xmlFile, 1.0 / 60.0, dummyStream);
+
+    const std::string address = socketAddress("keyframe");
+    StreamServer server(address);
+    for (unsigned int i = 0; i < 30; ++i) {
+        server.publish(sim);
+        sim.godTick();
+    }
+    EXPECT_EQ(0u, server.getClientCount());
+
+    // a client that joins during the run starts from the current state
+    StreamClient client(address);
+    DeltaDecoder decoder;
+    std::string line;
+    server.publish(sim);
+    EXPECT_EQ(1u, server.getClientCount());
+    ASSERT_TRUE(client.readLine(line, 1000));
+    EXPECT_EQ("topology", nlohmann::json::parse(line)["type"]);
+    EXPECT_FALSE(decoder.apply(line));
+    ASSERT_TRUE(client.readLine(line, 1000));
+    EXPECT_EQ("key", nlohmann::json::parse(line)["type"]);
+    EXPECT_TRUE(decoder.apply(line));
+    EXPECT_EQ(loggedFrame(sim), sortedFrame(decoder.frame()));
+
+    for (unsigned int i = 0; i < 200; ++i) {
+        sim.godTick();
+        server.publish(sim);
+        ASSERT_TRUE(client.readLine(line, 1000));
+        EXPECT_EQ("delta", nlohmann::json::parse(line)["type"]);
+        decoder.apply(line);
+    }
+    EXPECT_EQ(loggedFrame(sim), sortedFrame(decoder.frame()));
+    EXPECT_EQ(1u, server.getKeyframes());
+    EXPECT_EQ(0u, server.getDropped());
+}
+
+TEST(StreamTest, SlowClientDropsFramesAndResyncs) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::stringstream xml(makeCrowdedScenario(400));
+    Simulation sim(xml, 1.0 / 60.0, dummyStream);
+
+    const std::string address = socketAddress("slow");
+    StreamServer server(address, 16u << 10);
+    StreamClient slow(address);
+    StreamClient fast(address);
+
+    // the slow client does not read while the simulation runs, the fast one keeps up
+    DeltaDecoder fastDecoder;
+    std::string line;
+    for (unsigned int i = 0; i < 200; ++i) {
+        server.publish(sim);
+        while (fast.readLine(line, 0)) { fastDecoder.apply(line); }
+        sim.godTick();
+    }
+    EXPECT_EQ(2u, server.getClientCount());
+    EXPECT_GT(server.getDropped(), 0u);
+
+    // once it reads again it gets a keyframe and is back in sync
+    DeltaDecoder slowDecoder;
+    const std::uint64_t keyframesBefore = server.getKeyframes();
+    unsigned int rounds = 0;
+    for (; rounds < 400 && !(slowDecoder.hasFrame() && slowDecoder.getTick() == sim.getIteration()); ++rounds) {
+        server.publish(sim);
+        // the deltas it still had queued end where its frames were dropped, the keyframe follows them
+        while (slow.readLine(line, 10)) { slowDecoder.apply(line); }
+        while (fast.readLine(line, 0)) { fastDecoder.apply(line); }
+        if (slowDecoder.getTick() != sim.getIteration()) sim.godTick();
+    }
+    EXPECT_GT(server.getKeyframes(), keyframesBefore);
+    ASSERT_TRUE(slowDecoder.hasFrame());
+    EXPECT_EQ(sim.getIteration(), slowDecoder.getTick());
+    EXPECT_EQ(loggedFrame(sim), sortedFrame(slowDecoder.frame()));
+
+    // the fast client never lost a frame
+    EXPECT_EQ(sim.getIteration(), fastDecoder.getTick());
+    EXPECT_EQ(loggedFrame(sim), sortedFrame(fastDecoder.frame()));
+}
+
+TEST(StreamTest, DisconnectedClientsAreForgotten) {
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::ifstream xmlFile(kResPath + "test10.xml");
+    Simulation sim(xmlFile, 1.0 / 60.0, dummyStream);
+
+    const std::string address = socketAddress("disconnect");
+    StreamServer server(address);
+    {
+        StreamClient client(address);
+        server.publish(sim);
+        EXPECT_EQ(1u, server.getClientCount());
+    }
+    for (unsigned int i = 0; i < 3; ++i) {
+        sim.godTick();
+        server.publish(sim);
+    }
+    EXPECT_EQ(0u, server.getClientCount());
+
+    EXPECT_THROW(StreamServer("tcp:none"), std::runtime_error);
+    EXPECT_THROW(StreamServer("localhost:8080"), std::runtime_error);
+    EXPECT_THROW(StreamClient("unix:/tmp/sim_stream_missing.sock"), std::runtime_error);
+}
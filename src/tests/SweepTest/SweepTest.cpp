@@ -0,0 +1,214 @@
+//============================================================================
+// Name        : SweepTest.cpp
+// Description : Test file of the parameter sweep: its specification, the overrides and the forked workers
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "../../lib/sweep/SweepRunner.h"
+#include "../../lib/sweep/SweepSpec.h"
+#include "../../lib/xml-validator/Validator.h"
+
+namespace {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "../SimulationTest/res/";
+
+    /// writes the text to a spec file of this test run and reads it
+    SweepSpec readSpec(const std::string &text) {
+        const std::string path = "/tmp/sim_sweep_" + std::to_string(::getpid()) + ".ini";
+        std::ofstream(path) << text;
+        try {
+            SweepSpec spec = SweepSpec::read(path);
+            std::remove(path.c_str());
+            return spec;
+        } catch (const std::runtime_error &) {
+            std::remove(path.c_str());
+            throw;
+        }
+    }
+
+    Validator::ValMap validate(const std::string &scenario) {
+        std::ostream dummyStream(nullptr);
+        std::ifstream xmlFile(kResPath + scenario);
+        return Validator::validate(xmlFile, dummyStream);
+    }
+
+    const std::string &attribute(const Validator::ValMap &network, Validator::EObjectTypes type,
+                                 Validator::EAttributes key) {
+        return network.at(type).front().at(key).str();
+    }
+}  // namespace
+
+TEST(SweepTest, SpecIsReadFromIni) {
+    const SweepSpec spec = readSpec("[sweep]\n"
+                                    "scenario = scenario.xml\n"
+                                    "ticks = 500\n"
+                                    "workers = 3\n"
+                                    "budget = 2.5\n"
+                                    "retries = 0\n"
+                                    "[parameters]\n"
+                                    "step = 1/60, 0.05\n"
+                                    "seed = 1, 2, 3\n"
+                                    "light_cycle@Rural = 10, 20\n");
+    EXPECT_EQ("scenario.xml", spec.scenarioPath);
+    EXPECT_EQ(500u, spec.ticks);
+    EXPECT_EQ(3u, spec.workers);
+    EXPECT_DOUBLE_EQ(2.5, spec.budget);
+    EXPECT_EQ(0u, spec.retries);
+    EXPECT_EQ(1u, spec.threads);
+    ASSERT_EQ(3u, spec.parameters.size());
+    EXPECT_EQ(ESweepTarget::kLightCycle, spec.parameters[2].target);
+    EXPECT_EQ("rural", spec.parameters[2].road);
+    EXPECT_EQ("1/60", spec.parameters[0].texts[0]);
+
+    // every combination, the last parameter changes fastest
+    ASSERT_EQ(12u, spec.getRunCount());
+    const SweepRun run = spec.getRun(7);
+    EXPECT_EQ(7u, run.index);
+    EXPECT_EQ((std::vector<std::size_t>{1, 0, 1}), run.at);
+    EXPECT_DOUBLE_EQ(0.05, spec.valueOf(run, ESweepTarget::kStep, 0));
+    EXPECT_DOUBLE_EQ(1, spec.valueOf(run, ESweepTarget::kSeed, 0));
+    // a value for a single road is not the value for every road
+    EXPECT_DOUBLE_EQ(-1, spec.valueOf(run, ESweepTarget::kLightCycle, -1));
+    EXPECT_TRUE(spec.has(ESweepTarget::kLightCycle));
+    EXPECT_FALSE(spec.has(ESweepTarget::kGeneratorFrequency));
+
+    EXPECT_EQ(1u, readSpec("[sweep]\nscenario = a.xml\n").getRunCount());
+
+    for (const char *invalid :
+         {"[parameters]\nseed = 1\n", "[sweep]\nscenario = a.xml\nspeed = 3\n", "[sweep]\nscenario = a.xml\n[other]\n",
+          "[sweep]\nscenario = a.xml\n[parameters]\nseed@rural = 1\n",
+          "[sweep]\nscenario = a.xml\n[parameters]\nlight_cycle = 10, 0\n",
+          "[sweep]\nscenario = a.xml\n[parameters]\nstep = 1/0\n",
+          "[sweep]\nscenario = a.xml\n[parameters]\nseed = 1,,2\n",
+          "[sweep]\nscenario = a.xml\n[parameters]\nseed = 1.5\n", "[sweep]\nscenario = a.xml\nthreads = 0\n"}) {
+        EXPECT_THROW(readSpec(invalid), std::runtime_error) << invalid;
+    }
+    EXPECT_THROW(SweepSpec::read("/tmp/sim_sweep_missing.ini"), std::runtime_error);
+}
+
+TEST(SweepTest, OverridesChangeLightsAndGenerators) {
+    const Validator::ValMap network = validate("test12.xml");
+    ASSERT_FALSE(network.empty());
+    const Validator::EAttributes cycle(Validator::ELightAttributes::kCycleTime);
+    const Validator::EAttributes frequency(Validator::EVehicleGeneratorAttributes::kFrequency);
+    const Validator::EAttributes crossRoadLights(Validator::ECrossRoadAttributes::kLights);
+
+    SweepSpec spec = readSpec("[sweep]\n"
+                              "scenario = test12.xml\n"
+                              "[parameters]\n"
+                              "light_cycle@RURAL = 7\n"
+                              "light_cycle = 12, 14\n"
+                              "generator_frequency = 9\n");
+    Validator::ValMap changed = network;
+    SweepRunner::applyOverrides(spec, spec.getRun(1), changed);
+    // the value of the road wins, whatever the order in the spec
+    EXPECT_EQ("7", attribute(changed, Validator::EObjectTypes::kLight, cycle));
+    EXPECT_EQ(7, changed.at(Validator::EObjectTypes::kLight).front().at(cycle).toInt());
+    EXPECT_EQ("9", attribute(changed, Validator::EObjectTypes::kVehicleGenerator, frequency));
+    // a crossroad without lights keeps them off
+    EXPECT_EQ("-1", attribute(changed, Validator::EObjectTypes::kCrossRoad, crossRoadLights));
+    EXPECT_EQ("30", attribute(network, Validator::EObjectTypes::kLight, cycle));
+
+    Validator::ValMap unchanged = network;
+    std::ostream dummyStream(nullptr);
+    EXPECT_NO_THROW(SweepRunner(spec, unchanged, dummyStream));
+    EXPECT_TRUE(unchanged == network);
+
+    spec.parameters[0].road = "side";
+    EXPECT_THROW(SweepRunner(spec, unchanged, dummyStream), std::runtime_error);
+}
+
+TEST(SweepTest, WorkersMatchRunsInProcess) {
+    Validator::ValMap network = validate("test2.xml");
+    ASSERT_FALSE(network.empty());
+    const SweepSpec spec = readSpec("[sweep]\n"
+                                    "scenario = test2.xml\n"
+                                    "ticks = 600\n"
+                                    "workers = 3\n"
+                                    "[parameters]\n"
+                                    "seed = 4, 5\n"
+                                    "light_cycle = 5, 20\n"
+                                    "generator_frequency@geen inspiratie weg = 2, 6\n");
+    std::ostringstream errors;
+    SweepRunner runner(spec, network, errors);
+    const std::vector<RunResult> results = runner.run();
+    ASSERT_EQ(8u, results.size());
+    EXPECT_EQ("", errors.str());
+
+    for (const RunResult &result : results) {
+        ASSERT_EQ(ERunStatus::kOk, result.status) << result.message;
+        EXPECT_EQ(1u, result.attempts);
+        EXPECT_GT(result.metrics.wallSeconds, 0);
+        EXPECT_GT(result.metrics.ticksPerSecond, 0);
+
+        // every worker started from the network as it was loaded
+        Validator::ValMap copy = network;
+        const RunMetrics expected = SweepRunner::simulate(spec, result.run, copy);
+        EXPECT_EQ(expected.vehiclesEnd, result.metrics.vehiclesEnd);
+        EXPECT_DOUBLE_EQ(expected.vehiclesMean, result.metrics.vehiclesMean);
+        EXPECT_DOUBLE_EQ(expected.speedMean, result.metrics.speedMean);
+        EXPECT_DOUBLE_EQ(expected.stoppedShare, result.metrics.stoppedShare);
+    }
+    // a generator that spawns more often puts more vehicles on the road
+    EXPECT_GT(results[0].metrics.vehiclesMean, results[1].metrics.vehiclesMean);
+
+    std::ostringstream table;
+    SweepRunner::writeTable(spec, results, table);
+    std::string header;
+    std::string line;
+    std::istringstream lines(table.str());
+    ASSERT_TRUE(static_cast<bool>(std::getline(lines, header)));
+    EXPECT_EQ("run,status,attempts,seed,light_cycle,generator_frequency@geen inspiratie weg,wall_s,ticks_per_s,"
+              "vehicles_end,vehicles_mean,speed_mean,stopped_share,message",
+              header);
+    ASSERT_TRUE(static_cast<bool>(std::getline(lines, line)));
+    EXPECT_EQ("0,ok,1,4,5,2,", line.substr(0, 13));
+}
+
+TEST(SweepTest, FailedAndSlowRunsAreRetriedAndReported) {
+    Validator::ValMap network = validate("test2.xml");
+    ASSERT_FALSE(network.empty());
+
+    // far more ticks than fit in the budget
+    SweepSpec spec = readSpec("[sweep]\n"
+                              "scenario = test2.xml\n"
+                              "ticks = 4000000000\n"
+                              "budget = 0.2\n"
+                              "retries = 1\n");
+    std::ostringstream errors;
+    std::vector<RunResult> results = SweepRunner(spec, network, errors).run();
+    ASSERT_EQ(1u, results.size());
+    EXPECT_EQ(ERunStatus::kTimeout, results[0].status);
+    EXPECT_EQ(2u, results[0].attempts);
+    EXPECT_GE(results[0].metrics.wallSeconds, 0.2);
+    EXPECT_NE(std::string::npos, errors.str().find("retrying"));
+
+    // a light on a road that does not exist makes the simulation throw
+    network.at(Validator::EObjectTypes::kLight)
+      .front()
+      .at(Validator::EAttributes(Validator::ELightAttributes::kRoadName)) = "nowhere";
+    spec.ticks = 10;
+    spec.budget = 0;
+    spec.retries = 2;
+    errors.str("");
+    results = SweepRunner(spec, network, errors).run();
+    ASSERT_EQ(1u, results.size());
+    EXPECT_EQ(ERunStatus::kFailed, results[0].status);
+    EXPECT_EQ(3u, results[0].attempts);
+    EXPECT_FALSE(results[0].message.empty());
+
+    std::ostringstream table;
+    SweepRunner::writeTable(spec, results, table);
+    EXPECT_NE(std::string::npos, table.str().find("\n0,failed,3,"));
+}
@@ -0,0 +1,201 @@
+//============================================================================
+// Name        : TracerTest.cpp
+// Description : Test file of the span tracer
+// Author      : "Jonas Caluwé" <Jonas.Caluwe@student.uantwerpen.be> &&
+//               "Gilles Van pellicom" <Gilles.Vanpellicom@student.uantwerpen.be>
+// Date        : 2022/05/28
+// Version     : 1.0
+//============================================================================
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "../../Simulation.h"
+#include "../../lib/logger/Logger.h"
+#include "../../lib/nlohmann-json/json.hpp"
+#include "../../lib/profiler/Tracer.h"
+#include "../../lib/utils/Parallel.h"
+#include "../AllocationCounter.h"
+
+namespace {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "../SimulationTest/res/";
+
+    /// makes a tracer the active one for the lifetime of the guard, also when a check fails
+    class ActiveTracer {
+      public:
+        explicit ActiveTracer(Tracer &tracer) { Tracer::setActive(&tracer); }
+        ~ActiveTracer() { Tracer::setActive(nullptr); }
+    };
+
+    /// scenario with enough vehicles to split the vehicle updates over several threads
+    std::string makeWideScenario(unsigned int roads, unsigned int vehiclesPerRoad) {
+        std::ostringstream xml;
+        xml << "<ROOT>\n";
+        for (unsigned int road = 0; road < roads; ++road) {
+            xml << "<BAAN><naam>road" << road << "</naam><lengte>" << vehiclesPerRoad * 20 + 500
+                << "</lengte></BAAN>\n";
+            for (unsigned int vehicle = 0; vehicle < vehiclesPerRoad; ++vehicle) {
+                xml << "<VOERTUIG><baan>road" << road << "</baan><positie>" << vehicle * 20
+                    << "</positie><type>auto</type></VOERTUIG>\n";
+            }
+        }
+        xml << "</ROOT>\n";
+        return xml.str();
+    }
+}  // namespace
+
+TEST(TracerTest, RingBufferKeepsLastSpans) {
+    Tracer tracer(4);
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const char *const names[] = {"a", "b", "c", "d", "e", "f"};
+    for (unsigned int i = 0; i < 6; ++i) { tracer.record(names[i], now, now + std::chrono::microseconds(i)); }
+
+    EXPECT_EQ(6u, tracer.getRecorded());
+    const std::vector<Tracer::Event> events = tracer.getEvents();
+    ASSERT_EQ(4u, events.size());
+    EXPECT_STREQ("c", events.front().name);
+    EXPECT_STREQ("f", events.back().name);
+    EXPECT_EQ(5000, events.back().end - events.back().begin);
+}
+
+TEST(TracerTest, InactiveTracerRecordsNothing) {
+    Tracer tracer(16);
+    { const TraceScope scope("ignored"); }
+    EXPECT_EQ(0u, tracer.getRecorded());
+
+    {
+        const ActiveTracer active(tracer);
+        const TraceScope scope("recorded");
+    }
+    { const TraceScope scope("ignored"); }
+    ASSERT_EQ(1u, tracer.getRecorded());
+    EXPECT_STREQ("recorded", tracer.getEvents().front().name);
+}
+
+TEST(TracerTest, TracesLoadingTicksAndLogging) {
+    if (!Profiler::enabled()) return;
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    Tracer tracer(1024);
+    const ActiveTracer active(tracer);
+
+    const std::ifstream xmlFile(kResPath + "test10.xml");
+    Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+
+    // recording a tick does not allocate, also when the buffer wraps around
+    const std::size_t allocationsBefore = AllocationCounter::count();
+    for (unsigned int i = 0; i < 200; ++i) { sim.godTick(); }
+    const std::size_t allocationsAfter = AllocationCounter::count();
+    EXPECT_EQ(allocationsBefore, allocationsAfter);
+    EXPECT_GT(tracer.getRecorded(), 1024u);
+
+    std::ostringstream frame;
+    Logger::logAsJson(sim, frame);
+
+    std::set<std::string> names;
+    for (const Tracer::Event &event : tracer.getEvents()) {
+        EXPECT_LE(event.begin, event.end);
+        names.insert(event.name);
+    }
+    for (const char *name : {"godTick", "gatherChunk", "gather", "update", "crossRoads", "lights", "logJson"}) {
+        EXPECT_EQ(1u, names.count(name)) << name;
+    }
+
+    // the Chrome trace is valid json with a complete event per span
+    std::ostringstream json;
+    tracer.writeJson(json);
+    const nlohmann::json trace = nlohmann::json::parse(json.str());
+    unsigned int spans = 0;
+    for (const nlohmann::json &event : trace["traceEvents"]) {
+        if (event["ph"] == "X") ++spans;
+    }
+    EXPECT_EQ(1024u, spans);
+}
+
+TEST(TracerTest, LoadingIsTraced) {
+    if (!Profiler::enabled()) return;
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    Tracer tracer(64);
+    const ActiveTracer active(tracer);
+
+    const std::ifstream xmlFile(kResPath + "test0.xml");
+    const Simulation sim((std::istream &) xmlFile, 1.0 / 60.0, dummyStream);
+
+    const std::vector<Tracer::Event> events = tracer.getEvents();
+    ASSERT_EQ(2u, events.size());
+    EXPECT_STREQ("Validator::validate", events[0].name);
+    EXPECT_STREQ("Simulation::parse", events[1].name);
+}
+
+TEST(TracerTest, ThreadsGetTheirOwnTrack) {
+    Tracer tracer(4096);
+    const ActiveTracer active(tracer);
+
+    // four chunks on four threads, every chunk records a span on its own thread
+    Utils::WorkerPool pool(4);
+    pool.parallelFor(4 * Utils::kMinParallelChunk, [](std::size_t, std::size_t) { SIM_TRACE_SCOPE("chunk"); });
+
+    if (!Profiler::enabled()) return;
+    std::set<std::uint32_t> threads;
+    for (const Tracer::Event &event : tracer.getEvents()) { threads.insert(event.thread); }
+    EXPECT_EQ(4u, threads.size());
+}
+
+TEST(TracerTest, TracksStayBoundedOverManyTicks) {
+    Tracer tracer(1 << 16);
+    const ActiveTracer active(tracer);
+
+    // threads that do not run at the same time share a track, also when every one is a new thread
+    for (unsigned int i = 0; i < 50; ++i) {
+        std::thread thread([]() { const TraceScope scope("shortLived"); });
+        thread.join();
+    }
+    std::set<std::uint32_t> threads;
+    for (const Tracer::Event &event : tracer.getEvents()) { threads.insert(event.thread); }
+    EXPECT_EQ(1u, threads.size());
+
+    if (!Profiler::enabled()) return;
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    std::istringstream xml(makeWideScenario(4, 3 * Utils::kMinParallelChunk / 4 + 10));
+    Simulation sim(xml, 1.0 / 60.0, dummyStream);
+    sim.setThreadCount(3);
+    for (unsigned int i = 0; i < 300; ++i) { sim.godTick(); }
+
+    // the chunks of every tick run on the same three threads
+    threads.clear();
+    std::set<std::uint32_t> chunkThreads;
+    for (const Tracer::Event &event : tracer.getEvents()) {
+        threads.insert(event.thread);
+        if (std::string(event.name) == "gatherChunk") chunkThreads.insert(event.thread);
+    }
+    EXPECT_EQ(3u, chunkThreads.size());
+    EXPECT_LE(threads.size(), 4u);
+
+    // only the tracks with spans are named, the thread that created the tracer is the main one
+    std::ostringstream json;
+    tracer.writeJson(json);
+    const nlohmann::json trace = nlohmann::json::parse(json.str());
+    std::set<std::uint32_t> named;
+    unsigned int mainTracks = 0;
+    for (const nlohmann::json &event : trace["traceEvents"]) {
+        if (event["ph"] != "M") continue;
+        named.insert(event["tid"].get<std::uint32_t>());
+        if (event["args"]["name"] == "main") ++mainTracks;
+    }
+    EXPECT_EQ(threads, named);
+    EXPECT_EQ(1u, mainTracks);
+}
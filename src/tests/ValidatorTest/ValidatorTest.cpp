@@ -552,4 +552,94 @@ TEST(ValidatorTest, ExpectedErrorMessageCompare18) {
     Validator::validate((std::istream &) xmlFile, (std::ostream &) errOut);
 
     EXPECT_EQ(expectedErr.str(), errOut.str());
-}
\ No newline at end of file
+}
+
+TEST(ValidatorTest, RoadLevels) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    const std::ifstream file(kResPath + "test26.xml");
+
+    Validator::ValMap result = Validator::validate((std::istream &) file, (std::ostream &) dummyStream);
+    ASSERT_EQ(3u, result[Validator::EObjectTypes::kRoad].size());
+
+    const std::vector<Validator::Object> &roads = result[Validator::EObjectTypes::kRoad];
+    EXPECT_EQ("meso", roads[0].at(Validator::ERoadAttributes::kLevel));
+    EXPECT_EQ("micro", roads[1].at(Validator::ERoadAttributes::kLevel));
+    EXPECT_EQ(roads[2].end(), roads[2].find(Validator::ERoadAttributes::kLevel));
+}
+
+TEST(ValidatorTest, ExpectedErrorMessageCompare19) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // load the xml file
+    const std::ifstream xmlFile(kResPath + "test27.xml");
+
+    // create stream to write the error messages to
+    std::stringstream errOut("");
+
+    // convert expectedErrFile ifstream to stringstream
+    const std::ifstream expectedErrFile(kBasePath + "expected/ExpectedErrorMessageCompare19.txt");
+    std::stringstream expectedErr;
+    expectedErr << expectedErrFile.rdbuf();
+
+    // std::ofstream tmp(kBasePath + "expected/ExpectedErrorMessageCompare19.txt");
+
+    Validator::validate((std::istream &) xmlFile, (std::ostream &) errOut);
+
+    EXPECT_EQ(expectedErr.str(), errOut.str());
+}
+
+TEST(ValidatorTest, ExpectedErrorMessageCompare20) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // load the xml file
+    const std::ifstream xmlFile(kResPath + "test28.xml");
+
+    // create stream to write the error messages to
+    std::stringstream errOut("");
+
+    // convert expectedErrFile ifstream to stringstream
+    const std::ifstream expectedErrFile(kBasePath + "expected/ExpectedErrorMessageCompare20.txt");
+    std::stringstream expectedErr;
+    expectedErr << expectedErrFile.rdbuf();
+
+    // the lights of a crossroad stand one meter before it, a crossroad at position 0 has no room for them
+    const Validator::ValMap result = Validator::validate((std::istream &) xmlFile, (std::ostream &) errOut);
+
+    EXPECT_TRUE(result.empty());
+    EXPECT_EQ(expectedErr.str(), errOut.str());
+}
+
+TEST(ValidatorTest, NumbersParsedOnce) {
+    const std::string kBasePath = std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + '/';
+    const std::string kResPath = kBasePath + "res/";
+
+    // stream to send error messages to when we are not interested in them
+    std::ostream dummyStream(nullptr);
+
+    const std::ifstream file(kResPath + "test0.xml");
+
+    Validator::ValMap result = Validator::validate((std::istream &) file, (std::ostream &) dummyStream);
+    ASSERT_EQ(1u, result[Validator::EObjectTypes::kRoad].size());
+
+    // numbers carry their value, other attributes only their text
+    const Validator::Object &road = result[Validator::EObjectTypes::kRoad][0];
+    EXPECT_TRUE(road.at(Validator::ERoadAttributes::kLength).isInt());
+    EXPECT_EQ(500, road.at(Validator::ERoadAttributes::kLength).toInt());
+    EXPECT_FALSE(road.at(Validator::ERoadAttributes::kName).isInt());
+    EXPECT_THROW(road.at(Validator::ERoadAttributes::kName).toInt(), std::runtime_error);
+
+    // the whole text has to be a number
+    EXPECT_FALSE(Validator::Value("12abc").isInt());
+    EXPECT_FALSE(Validator::Value("").isInt());
+    EXPECT_FALSE(Validator::Value("-").isInt());
+    EXPECT_EQ(-1, Validator::Value("-1").toInt());
+    EXPECT_THROW(Utils::stod("1.5x"), std::runtime_error);
+    EXPECT_DOUBLE_EQ(1.5, Utils::stod("1.5"));
+}